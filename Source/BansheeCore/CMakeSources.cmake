@@ -197,6 +197,7 @@ set(BS_BANSHEECORE_INC_RESOURCES
 	"Include/BsVertexDataDesc.h"
 	"Include/BsTransientMesh.h"
 	"Include/BsTextureManager.h"
+	"Include/BsTextureStreamingManager.h"
 	"Include/BsTexture.h"
 	"Include/BsResources.h"
 	"Include/BsResourceManifest.h"
@@ -230,6 +231,8 @@ set(BS_BANSHEECORE_INC_TEXT
 	"Include/BsFontImportOptions.h"
 	"Include/BsFontDesc.h"
 	"Include/BsFont.h"
+	"Include/BsFontRasterizer.h"
+	"Include/BsFontGlyphCache.h"
 )
 
 set(BS_BANSHEECORE_SRC_PROFILING
@@ -393,6 +396,7 @@ set(BS_BANSHEECORE_SRC_RESOURCES
 	"Source/BsResources.cpp"
 	"Source/BsTexture.cpp"
 	"Source/BsTextureManager.cpp"
+	"Source/BsTextureStreamingManager.cpp"
 	"Source/BsTransientMesh.cpp"
 	"Source/BsVertexDataDesc.cpp"
 	"Source/BsResourceMetaData.cpp"
@@ -430,6 +434,7 @@ set(BS_BANSHEECORE_SRC_TEXT
 	"Source/BsFont.cpp"
 	"Source/BsFontImportOptions.cpp"
 	"Source/BsFontManager.cpp"
+	"Source/BsFontGlyphCache.cpp"
 	"Source/BsTextData.cpp"
 )
 
@@ -570,6 +575,10 @@ set(BS_BANSHEECORE_INC_PLATFORM_WIN32
 	"Include/Win32/BsWin32Platform.h"
 )
 
+set(BS_BANSHEECORE_INC_PLATFORM_LINUX
+	"Include/Linux/BsLinuxFolderMonitor.h"
+)
+
 set(BS_BANSHEECORE_SRC_PLATFORM
 	"Source/BsPlatform.cpp"
 )
@@ -580,9 +589,16 @@ set(BS_BANSHEECORE_SRC_PLATFORM_WIN32
 	"Source/Win32/BsWin32BrowseDialogs.cpp"
 )
 
+set(BS_BANSHEECORE_SRC_PLATFORM_LINUX
+	"Source/Linux/BsLinuxFolderMonitor.cpp"
+)
+
 if(WIN32)
 	list(APPEND BS_BANSHEECORE_INC_PLATFORM ${BS_BANSHEECORE_INC_PLATFORM_WIN32})
 	list(APPEND BS_BANSHEECORE_SRC_PLATFORM ${BS_BANSHEECORE_SRC_PLATFORM_WIN32})
+elseif(UNIX AND NOT APPLE)
+	list(APPEND BS_BANSHEECORE_INC_PLATFORM ${BS_BANSHEECORE_INC_PLATFORM_LINUX})
+	list(APPEND BS_BANSHEECORE_SRC_PLATFORM ${BS_BANSHEECORE_SRC_PLATFORM_LINUX})
 endif()
 
 source_group("Header Files\\Components" FILES ${BS_BANSHEECORE_INC_COMPONENTS})
@@ -492,7 +492,12 @@ namespace bs
 	/**	Flags that may be assigned to a shader that let the renderer know how to interpret the shader. */
 	enum class ShaderFlags
 	{
-		Transparent = 0x1 /**< Signifies that the shader is rendering a transparent object. */
+		Transparent = 0x1, /**< Signifies that the shader is rendering a transparent object. */
+		/** 
+		 * Prevents the renderer from batching objects using this shader into instanced draw calls, even if the shader
+		 * supports instancing. 
+		 */
+		DisableInstancing = 0x2
 	};
 
 	/** Valid types of a mesh used for physics. */
@@ -26,6 +26,10 @@ namespace bs
 		RENDER_WINDOW_DESC primaryWindowDesc; /**< Describes the window to create during start-up. */
 
 		Vector<String> importers; /**< A list of importer plugins to load. */
+
+		Path logFile; /**< File to stream the log messages to, rotated as it grows. Leave empty to not write a log file. */
+		UINT32 logMaxEntries = 10000; /**< Maximum number of log entries to keep in memory. Zero means no limit. */
+		UINT32 logChannels = 0xFFFFFFFF; /**< Mask with a bit set for each log channel whose messages should be recorded. */
 	};
 
 	/**
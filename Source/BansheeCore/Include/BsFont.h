@@ -8,6 +8,8 @@
 
 namespace bs
 {
+	class FontGlyphCache;
+
 	/** @addtogroup Text
 	 *  @{
 	 */
@@ -37,14 +39,20 @@ namespace bs
 	// Also, changing the source texture will not automatically update the font because there is no direct link between them.
 	// -- This is probably not a large problem, but it is something to keep an eye out.
 
-	/**	Font resource containing data about textual characters and how to render text. */
+	/**
+	 * Font resource containing data about textual characters and how to render text.
+	 *
+	 * Font can either be static, containing a pre-rasterized set of characters for a fixed set of sizes, or dynamic,
+	 * containing source font data from which characters are rasterized on demand, for any size.
+	 */
 	class BS_CORE_EXPORT Font : public Resource
 	{
 	public:
 		virtual ~Font();
 
 		/**
-		 * Returns font bitmap for a specific size if it exists, null otherwise.
+		 * Returns font bitmap for a specific size if it exists, null otherwise. For dynamic fonts the bitmap will only
+		 * contain characters that have been cached using _cacheGlyphs().
 		 *
 		 * @param[in]	size	Size of the bitmap in points.
 		 */
@@ -53,9 +61,24 @@ namespace bs
 		/**	Finds the available font bitmap size closest to the provided size. */
 		INT32 getClosestSize(UINT32 size) const;
 
+		/** Checks is the font dynamic, meaning its characters are rasterized on demand. */
+		bool isDynamic() const { return mDynamic; }
+
 		/**	Creates a new font from the provided per-size font data. */
 		static HFont create(const Vector<SPtr<FontBitmap>>& fontInitData);
 
+		/**
+		 * Creates a new dynamic font that rasterizes characters on demand.
+		 *
+		 * @param[in]	fontData	Contents of a font file (e.g. TrueType or OpenType) in a format supported by the
+		 *							registered font rasterizer.
+		 * @param[in]	dpi			Dots per inch resolution to use when rendering the characters.
+		 * @param[in]	renderMode	Determines how are the characters rendered into a bitmap.
+		 * @param[in]	sdf			If true the characters will be rendered as signed distance fields, allowing a single
+		 *							rasterized character to be used for all font sizes.
+		 */
+		static HFont createDynamic(const SPtr<DataStream>& fontData, UINT32 dpi, FontRenderMode renderMode, bool sdf);
+
 	public: // ***** INTERNAL ******
 		using Resource::initialize;
 
@@ -70,9 +93,53 @@ namespace bs
 		 */
 		void initialize(const Vector<SPtr<FontBitmap>>& fontData);
 
+		/**
+		 * Initializes a dynamic font with the provided font file data.
+		 *
+		 * @note	Internal method. Factory methods will call this automatically for you.
+		 */
+		void initialize(const SPtr<DataStream>& fontData, UINT32 dpi, FontRenderMode renderMode, bool sdf);
+
+		/**
+		 * Makes sure all characters of the provided text are present in the bitmap of the specified size, rasterizing
+		 * them if needed. Must be called before using the bitmap of a dynamic font. Does nothing for static fonts.
+		 */
+		void _cacheGlyphs(UINT32 size, const WString& text);
+
+		/** 
+		 * Returns a counter incremented whenever characters of a dynamic font are evicted from its cache. Text laid out
+		 * using an earlier version might reference evicted characters. Always zero for static fonts.
+		 */
+		UINT32 _getGlyphCacheVersion() const;
+
+		/**
+		 * Notifies a dynamic font that text displaying characters from the provided cache pages has been created. Pages
+		 * displayed by existing text are evicted from the cache only if no other pages can be. Must be matched with a 
+		 * call to _removePageReferences() once the text is destroyed or laid out again. Does nothing for static fonts.
+		 *
+		 * @param[in]	pageMask	Mask with a bit set for each referenced page, as used by FontBitmap::texturePages.
+		 */
+		void _addPageReferences(UINT32 pageMask);
+
+		/** Releases page references previously added with _addPageReferences(). */
+		void _removePageReferences(UINT32 pageMask);
+
+		/** Marks the provided glyph cache pages as used in the current frame. Does nothing for static fonts. */
+		void _markPagesUsed(UINT32 pageMask);
+
+		/** 
+		 * Triggered when characters of a dynamic font are evicted from its cache, in order to make room for new ones.
+		 * Any text laid out using the font before the eviction needs to be laid out again.
+		 */
+		static Event<void(const Font&)> onGlyphsEvicted;
+
 		/** Creates a new font as a pointer instead of a resource handle. */
 		static SPtr<Font> _createPtr(const Vector<SPtr<FontBitmap>>& fontInitData);
 
+		/** Creates a new dynamic font as a pointer instead of a resource handle. */
+		static SPtr<Font> _createDynamicPtr(const SPtr<DataStream>& fontData, UINT32 dpi, FontRenderMode renderMode, 
+			bool sdf);
+
 		/** @} */
 
 	protected:
@@ -87,8 +154,18 @@ namespace bs
 		void getCoreDependencies(Vector<CoreObject*>& dependencies) override;
 
 	private:
+		/** Returns the cache holding rasterized characters of a dynamic font, creating it on first use. */
+		FontGlyphCache* getGlyphCache() const;
+
 		Map<UINT32, SPtr<FontBitmap>> mFontDataPerSize;
 
+		bool mDynamic;
+		bool mSDF;
+		UINT32 mDPI;
+		FontRenderMode mRenderMode;
+		Vector<UINT8> mSourceData;
+		mutable SPtr<FontGlyphCache> mGlyphCache;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
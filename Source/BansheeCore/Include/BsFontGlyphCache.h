@@ -0,0 +1,166 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsFont.h"
+#include "BsTextureAtlasLayout.h"
+#include "BsPixelVolume.h"
+
+namespace bs
+{
+	class FontFace;
+	struct RASTERIZED_GLYPH;
+
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Rasterizes characters of a dynamic font on demand and stores them in a set of atlas textures shared by all font
+	 * sizes. When the atlas runs out of space the least recently used atlas page is cleared and reused.
+	 *
+	 * Characters can optionally be stored as signed distance fields. In that case each character is rasterized only
+	 * once, at a fixed size, and the same atlas entry is scaled to serve all font sizes.
+	 */
+	class BS_CORE_EXPORT FontGlyphCache
+	{
+		/** Information about a single character stored in the atlas. */
+		struct Glyph
+		{
+			UINT32 page;
+			UINT32 x, y;
+			UINT32 width, height;
+			INT32 xOffset, yOffset;
+			INT32 xAdvance, yAdvance;
+		};
+
+		/** A single atlas texture, along with its layout and a CPU copy of its contents. */
+		struct Page
+		{
+			/** Extends the area that needs to be uploaded to the texture, so it includes the provided area. */
+			void markDirty(const PixelVolume& area);
+
+			TextureAtlasLayout layout;
+			SPtr<PixelData> pixels;
+			HTexture texture;
+			Vector<UINT64> glyphs;
+			UINT64 lastUsedFrame = 0;
+			UINT32 numReferences = 0;
+			PixelVolume dirtyArea;
+			bool dirty = false;
+		};
+
+	public:
+		/**
+		 * Creates a new glyph cache.
+		 *
+		 * @param[in]	face	Font face used for rasterizing the characters.
+		 * @param[in]	sdf		If true the characters will be stored as signed distance fields, otherwise they will be
+		 *						stored as a separate bitmap for each font size.
+		 */
+		FontGlyphCache(const SPtr<FontFace>& face, bool sdf);
+
+		/**
+		 * Returns the font bitmap for the specified size, creating it if it doesn't exist. The bitmap contains only the
+		 * characters cached so far. Call cacheGlyphs() to make sure the characters you need are present.
+		 */
+		SPtr<FontBitmap> getBitmap(UINT32 size);
+
+		/**
+		 * Rasterizes any characters from the provided text not yet present in the bitmap of the specified size and marks
+		 * all of them as used in the current frame. Characters used in the current frame will not be evicted from the
+		 * atlas until the next frame.
+		 */
+		void cacheGlyphs(UINT32 size, const WString& text);
+
+		/**
+		 * Notifies the cache that text displaying characters from the provided pages has been created. Such pages are
+		 * only evicted when all other pages are in use as well. Each call must be matched with a call to 
+		 * removePageReferences() once the text is destroyed or changed.
+		 *
+		 * @param[in]	pageMask	Mask with a bit set for each referenced page.
+		 */
+		void addPageReferences(UINT32 pageMask);
+
+		/** Releases page references previously added with addPageReferences(). */
+		void removePageReferences(UINT32 pageMask);
+
+		/** Marks the provided pages as used in the current frame, making them the last candidates for eviction. */
+		void markPagesUsed(UINT32 pageMask);
+
+		/**
+		 * Returns a counter incremented whenever characters are evicted from the atlas. Text laid out using an earlier
+		 * version might reference characters that are no longer present.
+		 */
+		UINT32 getVersion() const { return mVersion; }
+
+		/** Width/height of a single atlas page, in pixels. */
+		static const UINT32 PAGE_SIZE = 1024;
+
+		/**
+		 * Number of atlas pages after which the least recently used page will be cleared and reused, instead of a new
+		 * page being created.
+		 */
+		static const UINT32 MAX_PAGES = 8;
+
+		/** Font size at which characters are rasterized when using signed distance fields. */
+		static const UINT32 SDF_SIZE = 48;
+
+		/** Maximum distance encoded in a signed distance field, in pixels at SDF_SIZE. */
+		static const UINT32 SDF_SPREAD = 6;
+
+	private:
+		/** Finds the character in the atlas, rasterizing it if not present. Returns null if the font lacks the character. */
+		const Glyph* findOrCreateGlyph(UINT32 charId, UINT32 size);
+
+		/**
+		 * Finds space for a bitmap of the provided size in the atlas, creating or evicting pages if needed. Returns false
+		 * if the bitmap cannot fit in any page.
+		 */
+		bool allocate(UINT32 width, UINT32 height, UINT32& page, UINT32& x, UINT32& y);
+
+		/** Creates a new empty atlas page. */
+		void createPage();
+
+		/** Removes all characters from the specified page, from the atlas and all the bitmaps referencing it. */
+		void evictPage(UINT32 pageIdx);
+
+		/** Fills out the character description for the specified font size from the cached character. */
+		void fillCharDesc(UINT32 charId, const Glyph& glyph, UINT32 size, CHAR_DESC& output) const;
+
+		/** 
+		 * Calculates kerning for all pairs of adjacent characters in the provided text, unless already calculated. Only
+		 * pairs that are actually displayed are queried, instead of all possible pairs of cached characters.
+		 */
+		void updateKerning(FontBitmap& bitmap, const WString& text);
+
+		/** Uploads the modified areas of all pages to their textures. */
+		void updateTextures();
+
+		/** Converts a coverage bitmap into a signed distance field with SDF_SPREAD pixels of padding on every side. */
+		static void generateSDF(RASTERIZED_GLYPH& glyph);
+
+		/** Returns a key used for looking up a character of the provided size. */
+		UINT64 getGlyphKey(UINT32 charId, UINT32 size) const { return ((UINT64)(mSDF ? 0 : size) << 32) | charId; }
+
+		/** Returns a key used for looking up if kerning for a pair of characters of the provided size was calculated. */
+		static UINT64 getKerningKey(UINT32 leftCharId, UINT32 rightCharId, UINT32 size)
+		{
+			// Unicode code points fit in 21 bits
+			return ((UINT64)size << 42) | ((UINT64)(leftCharId & 0x1FFFFF) << 21) | (rightCharId & 0x1FFFFF);
+		}
+
+		SPtr<FontFace> mFace;
+		bool mSDF;
+		UINT32 mVersion;
+
+		Vector<Page> mPages;
+		UnorderedMap<UINT64, Glyph> mGlyphs;
+		UnorderedSet<UINT64> mMissingGlyphs;
+		UnorderedSet<UINT64> mKerningPairs;
+		Map<UINT32, SPtr<FontBitmap>> mBitmaps;
+	};
+
+	/** @} */
+}
\ No newline at end of file
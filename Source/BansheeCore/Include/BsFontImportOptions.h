@@ -12,15 +12,6 @@ namespace bs
 	 *  @{
 	 */
 
-	/**	Determines how is a font rendered into the bitmap texture. */
-	enum class FontRenderMode
-	{
-		Smooth, /*< Render antialiased fonts without hinting (slightly more blurry). */
-		Raster, /*< Render non-antialiased fonts without hinting (slightly more blurry). */
-		HintedSmooth, /*< Render antialiased fonts with hinting. */
-		HintedRaster /*< Render non-antialiased fonts with hinting. */
-	};
-
 	/**	Import options that allow you to control how is a font imported. */
 	class BS_CORE_EXPORT FontImportOptions : public ImportOptions
 	{
@@ -48,6 +39,21 @@ namespace bs
 		/**	Sets whether the italic font style should be used when rendering. */
 		void setItalic(bool italic) { mItalic = italic; }
 
+		/**
+		 * Sets whether the font should be imported as a dynamic font. Dynamic fonts don't rasterize any characters during
+		 * import and instead keep the source font data, rasterizing characters on demand as they are used. Any font
+		 * size can be used with a dynamic font, and font sizes and character ranges specified in the import options
+		 * are ignored.
+		 */
+		void setDynamic(bool dynamic) { mDynamic = dynamic; }
+
+		/**
+		 * Sets whether characters of a dynamic font should be rendered as signed distance fields. This allows a single
+		 * rasterized character to be used for all font sizes, at the cost of slightly less sharp small text. Only
+		 * relevant for dynamic fonts.
+		 */
+		void setSDF(bool sdf) { mSDF = sdf; }
+
 		/**	Gets the sizes that are to be imported. Ranges are defined as unicode numbers. */
 		Vector<UINT32> getFontSizes() const { return mFontSizes; }
 
@@ -66,6 +72,12 @@ namespace bs
 		/**	Sets whether the italic font style should be used when rendering. */
 		bool getItalic() const { return mItalic; }
 
+		/** Checks should the font be imported as a dynamic font. See setDynamic(). */
+		bool getDynamic() const { return mDynamic; }
+
+		/** Checks should characters of a dynamic font be rendered as signed distance fields. See setSDF(). */
+		bool getSDF() const { return mSDF; }
+
 		/** Creates a new import options object that allows you to customize how are fonts imported. */
 		static SPtr<FontImportOptions> create();
 
@@ -76,6 +88,8 @@ namespace bs
 		FontRenderMode mRenderMode;
 		bool mBold;
 		bool mItalic;
+		bool mDynamic;
+		bool mSDF;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
@@ -34,6 +34,12 @@ namespace bs
 		bool& getItalic(FontImportOptions* obj) { return obj->mItalic; }
 		void setItalic(FontImportOptions* obj, bool& value) { obj->mItalic = value; }
 
+		bool& getDynamic(FontImportOptions* obj) { return obj->mDynamic; }
+		void setDynamic(FontImportOptions* obj, bool& value) { obj->mDynamic = value; }
+
+		bool& getSDF(FontImportOptions* obj) { return obj->mSDF; }
+		void setSDF(FontImportOptions* obj, bool& value) { obj->mSDF = value; }
+
 	public:
 		FontImportOptionsRTTI()
 		{
@@ -43,6 +49,8 @@ namespace bs
 			addPlainField("mRenderMode", 3, &FontImportOptionsRTTI::getRenderMode, &FontImportOptionsRTTI::setRenderMode);
 			addPlainField("mBold", 4, &FontImportOptionsRTTI::getBold, &FontImportOptionsRTTI::setBold);
 			addPlainField("mItalic", 5, &FontImportOptionsRTTI::getItalic, &FontImportOptionsRTTI::setItalic);
+			addPlainField("mDynamic", 6, &FontImportOptionsRTTI::getDynamic, &FontImportOptionsRTTI::setDynamic);
+			addPlainField("mSDF", 7, &FontImportOptionsRTTI::getSDF, &FontImportOptionsRTTI::setSDF);
 		}
 
 		const String& getRTTIName() override
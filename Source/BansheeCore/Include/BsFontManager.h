@@ -4,9 +4,12 @@
 
 #include "BsCorePrerequisites.h"
 #include "BsModule.h"
+#include "BsFontDesc.h"
 
 namespace bs
 {
+	class FontRasterizer;
+
 	/** @addtogroup Text-Internal
 	 *  @{
 	 */
@@ -18,12 +21,24 @@ namespace bs
 		/**	Creates a new font from the provided populated font data structure. */
 		SPtr<Font> create(const Vector<SPtr<FontBitmap>>& fontData) const;
 
+		/** @copydoc Font::createDynamic */
+		SPtr<Font> createDynamic(const SPtr<DataStream>& fontData, UINT32 dpi, FontRenderMode renderMode, bool sdf) const;
+
+		/** Returns the rasterizer used for rasterizing characters of dynamic fonts, or null if none is registered. */
+		const SPtr<FontRasterizer>& getRasterizer() const { return mRasterizer; }
+
+		/** Registers a rasterizer that will be used for rasterizing characters of dynamic fonts. */
+		void _setRasterizer(const SPtr<FontRasterizer>& rasterizer) { mRasterizer = rasterizer; }
+
 		/**
 		 * Creates an empty font.
 		 *
 		 * @note	Internal method. Used by factory methods.
 		 */
 		SPtr<Font> _createEmpty() const;
+
+	private:
+		SPtr<FontRasterizer> mRasterizer;
 	};
 
 	/** @} */
@@ -7,6 +7,7 @@
 #include "BsFont.h"
 #include "BsFontManager.h"
 #include "BsTexture.h"
+#include "BsDataStream.h"
 
 namespace bs
 {
@@ -95,10 +96,39 @@ namespace bs
 			initData->fontDataPerSize.resize(size);
 		}
 
+		bool& getDynamic(Font* obj) { return obj->mDynamic; }
+		void setDynamic(Font* obj, bool& value) { obj->mDynamic = value; }
+
+		bool& getSDF(Font* obj) { return obj->mSDF; }
+		void setSDF(Font* obj, bool& value) { obj->mSDF = value; }
+
+		UINT32& getDPI(Font* obj) { return obj->mDPI; }
+		void setDPI(Font* obj, UINT32& value) { obj->mDPI = value; }
+
+		FontRenderMode& getRenderMode(Font* obj) { return obj->mRenderMode; }
+		void setRenderMode(Font* obj, FontRenderMode& value) { obj->mRenderMode = value; }
+
+		SPtr<DataStream> getSourceData(Font* obj, UINT32& size)
+		{
+			size = (UINT32)obj->mSourceData.size();
+			return bs_shared_ptr_new<MemoryDataStream>(obj->mSourceData.data(), obj->mSourceData.size(), false);
+		}
+
+		void setSourceData(Font* obj, const SPtr<DataStream>& value, UINT32 size)
+		{
+			obj->mSourceData.resize(size);
+			value->read(obj->mSourceData.data(), size);
+		}
+
 	public:
 		FontRTTI()
 		{
 			addReflectableArrayField("mBitmaps", 0, &FontRTTI::getBitmap, &FontRTTI::getNumBitmaps, &FontRTTI::setBitmap, &FontRTTI::setNumBitmaps);
+			addPlainField("mDynamic", 1, &FontRTTI::getDynamic, &FontRTTI::setDynamic);
+			addPlainField("mSDF", 2, &FontRTTI::getSDF, &FontRTTI::setSDF);
+			addPlainField("mDPI", 3, &FontRTTI::getDPI, &FontRTTI::setDPI);
+			addPlainField("mRenderMode", 4, &FontRTTI::getRenderMode, &FontRTTI::setRenderMode);
+			addDataBlockField("mSourceData", 5, &FontRTTI::getSourceData, &FontRTTI::setSourceData, 0);
 		}
 
 		const String& getRTTIName() override
@@ -0,0 +1,87 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsFontDesc.h"
+
+namespace bs
+{
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/** Bitmap and metrics of a single character, as output by FontFace::rasterize(). */
+	struct RASTERIZED_GLYPH
+	{
+		UINT32 width = 0; /**< Width of the bitmap in pixels. */
+		UINT32 height = 0; /**< Height of the bitmap in pixels. */
+		INT32 xOffset = 0; /**< Horizontal offset from the pen position to the left edge of the bitmap, in pixels. */
+		INT32 yOffset = 0; /**< Vertical offset from the baseline to the top edge of the bitmap, in pixels. */
+		INT32 xAdvance = 0; /**< Determines how much to advance the pen horizontally after the character, in pixels. */
+		INT32 yAdvance = 0; /**< Determines how much to advance the pen vertically after the character, in pixels. */
+
+		/** Coverage of each pixel in the bitmap, row by row, one byte per pixel. */
+		Vector<UINT8> pixels;
+	};
+
+	/** Font data loaded from a font file, able to rasterize characters of any size. */
+	class BS_CORE_EXPORT FontFace
+	{
+	public:
+		virtual ~FontFace() { }
+
+		/**
+		 * Returns metrics that apply to all characters of the specified size.
+		 *
+		 * @param[in]	size			Size of the font in points.
+		 * @param[out]	baselineOffset	Y offset from the top of the line to the baseline, in pixels.
+		 * @param[out]	lineHeight		Height of a single line of the font, in pixels.
+		 * @param[out]	spaceWidth		Width of a space character, in pixels.
+		 */
+		virtual void getMetrics(UINT32 size, INT32& baselineOffset, UINT32& lineHeight, UINT32& spaceWidth) = 0;
+
+		/**
+		 * Rasterizes a single character.
+		 *
+		 * @param[in]	charId	Unicode key of the character to rasterize, or MISSING_GLYPH to rasterize the glyph the
+		 *						font uses for characters it doesn't contain.
+		 * @param[in]	size	Size of the font in points.
+		 * @param[out]	output	Bitmap and metrics of the character.
+		 * @return				False if the font doesn't contain the character.
+		 */
+		virtual bool rasterize(UINT32 charId, UINT32 size, RASTERIZED_GLYPH& output) = 0;
+
+		/** Checks does the font contain any kerning information. */
+		virtual bool hasKerning() const = 0;
+
+		/** Returns the horizontal kerning offset to apply between the provided character pair, in pixels. */
+		virtual INT32 getKerning(UINT32 leftCharId, UINT32 rightCharId, UINT32 size) = 0;
+
+		/** Character ID that can be provided to rasterize() in order to rasterize the missing glyph. */
+		static const UINT32 MISSING_GLYPH = (UINT32)-1;
+	};
+
+	/**
+	 * Creates font faces from font file data. Implementation is provided by a plugin and registered with the
+	 * FontManager.
+	 */
+	class BS_CORE_EXPORT FontRasterizer
+	{
+	public:
+		virtual ~FontRasterizer() { }
+
+		/**
+		 * Creates a new font face from the contents of a font file.
+		 *
+		 * @param[in]	data		Contents of the font file. Must remain valid for the lifetime of the face.
+		 * @param[in]	size		Size of the @p data buffer, in bytes.
+		 * @param[in]	dpi			Dots per inch resolution to use when rendering the characters.
+		 * @param[in]	renderMode	Determines how are the characters rendered into a bitmap.
+		 * @return					New font face, or null if the data isn't in a supported format.
+		 */
+		virtual SPtr<FontFace> createFace(const UINT8* data, UINT32 size, UINT32 dpi, FontRenderMode renderMode) = 0;
+	};
+
+	/** @} */
+}
\ No newline at end of file
@@ -138,13 +138,15 @@ namespace bs
 
 	private:
 		UINT64 mNextAvailableID; // 0 is not a valid ID
-		Map<UINT64, GameObjectHandleBase> mObjects;
-		Map<UINT64, GameObjectHandleBase> mQueuedForDestroy;
+		UnorderedMap<UINT64, GameObjectHandleBase> mObjects;
+		Vector<std::pair<UINT64, GameObjectHandleBase>> mQueuedForDestroy;
+		UnorderedSet<UINT64> mQueuedForDestroyIds;
+		Vector<std::pair<UINT64, GameObjectHandleBase>> mDestroyingObjects;
 
 		GameObject* mActiveDeserializedObject;
 		bool mIsDeserializationActive;
-		Map<UINT64, UINT64> mIdMapping;
-		Map<UINT64, SPtr<GameObjectHandleData>> mUnresolvedHandleData;
+		UnorderedMap<UINT64, UINT64> mIdMapping;
+		UnorderedMap<UINT64, SPtr<GameObjectHandleData>> mUnresolvedHandleData;
 		Vector<UnresolvedHandle> mUnresolvedHandles;
 		Vector<std::function<void()>> mEndCallbacks;
 		UINT32 mGODeserializationMode;
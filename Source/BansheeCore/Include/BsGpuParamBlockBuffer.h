@@ -108,7 +108,7 @@ namespace bs
 		 * Write some data to the specified offset in the buffer. 
 		 *
 		 * @note	All values are in bytes. Actual hardware buffer update is delayed until rendering or until 
-		 *			flushToGPU() is called.
+		 *			flushToGPU() is called. Writing data identical to the current contents doesn't trigger an update.
 		 */
 		void write(UINT32 offset, const void* data, UINT32 size);
 
@@ -677,6 +677,12 @@ namespace bs
 		/** Creates a new material with the specified shader. */
 		static SPtr<Material> create(const SPtr<Shader>& shader);
 
+		/** 
+		 * Returns streaming identifiers of all streamed textures bound to the material's parameters. The list is cached
+		 * and only rebuilt once the parameters change.
+		 */
+		const Vector<UINT32>& _getStreamedTextures() const;
+
 	private:
 		friend class bs::Material;
 
@@ -687,6 +693,10 @@ namespace bs
 
 		/** @copydoc CoreObject::syncToCore */
 		void syncToCore(const CoreSyncData& data) override;
+
+		mutable Vector<UINT32> mStreamedTextures;
+		mutable UINT64 mStreamedTexturesParamVersion = 0;
+		mutable UINT32 mStreamedTexturesIdVersion = 0;
 	};
 
 	/** @} */	
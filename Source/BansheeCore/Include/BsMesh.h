@@ -39,6 +39,18 @@ namespace bs
 		 */
 		Vector<SubMesh> subMeshes;
 
+		/**
+		 * Sub-meshes for additional levels of detail, if any. Must contain subMeshes.size() entries for each level after
+		 * the first, ordered by level, each referencing the same vertex and index buffers as @p subMeshes.
+		 */
+		Vector<SubMesh> lodSubMeshes;
+
+		/** 
+		 * Screen size below which each additional level of detail is used, one entry per level after the first. See 
+		 * MeshProperties::getLODScreenSize.
+		 */
+		Vector<float> lodScreenSizes;
+
 		/** Optimizes performance depending on planned usage of the mesh. */
 		INT32 usage = MU_STATIC; 
 
@@ -125,6 +137,9 @@ namespace bs
 		BS_SCRIPT_EXPORT(pr:getter,n:MorphShapes)
 		SPtr<MorphShapes> getMorphShapes() const { return mMorphShapes; }
 
+		/** Returns the usage flags the mesh was created with, as MeshUsage flags. */
+		int getUsage() const { return mUsage; }
+
 		/** Retrieves a core implementation of a mesh usable only from the core thread. */
 		SPtr<ct::Mesh> getCore() const;
 
@@ -299,6 +314,15 @@ namespace bs
 		/** Returns an object containing all shapes used for morph animation, if any are available. */
 		SPtr<MorphShapes> getMorphShapes() const { return mMorphShapes; }
 
+		/** Returns the usage flags the mesh was created with, as a combination of MeshUsage flags. */
+		int getUsage() const { return mUsage; }
+
+		/** 
+		 * Returns the data the mesh was initialized with. Only available for meshes created with MU_CPUCACHED usage and
+		 * initial data. Any data written to the mesh after creation will not be reflected in this data.
+		 */
+		SPtr<MeshData> getCachedData() const { return mCachedData; }
+
 		/**
 		 * Updates the current mesh with the provided data.
 		 *
@@ -394,6 +418,7 @@ namespace bs
 		IndexType mIndexType;
 		GpuDeviceFlags mDeviceMask;
 		SPtr<MeshData> mTempInitialMeshData;
+		SPtr<MeshData> mCachedData;
 		SPtr<Skeleton> mSkeleton; // Immutable
 		SPtr<MorphShapes> mMorphShapes; // Immutable
 	};
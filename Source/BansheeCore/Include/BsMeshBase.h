@@ -45,6 +45,27 @@ namespace bs
 		/** Retrieves a total number of sub-meshes in this mesh. */
 		UINT32 getNumSubMeshes() const;
 
+		/** 
+		 * Returns the number of levels of detail the mesh contains. Level 0 is the full detail mesh, and is always
+		 * present.
+		 */
+		UINT32 getNumLODs() const { return (UINT32)mLODScreenSizes.size() + 1; }
+
+		/**
+		 * Retrieves a sub-mesh for the specified level of detail. Every level of detail has the same number of sub-meshes
+		 * as the full detail mesh, and each is meant to be rendered with the same material as the full detail sub-mesh 
+		 * at the same index. Sub-meshes of all levels reference the same vertex and index buffers. Sub-mesh of a level
+		 * of detail can be empty, in which case nothing should be rendered for it.
+		 */
+		const SubMesh& getSubMesh(UINT32 subMeshIdx, UINT32 lod) const;
+
+		/** 
+		 * Returns the screen size below which the specified level of detail should be used. Screen size is the ratio 
+		 * between the diameter of the mesh's bounding sphere and the height of the view it is rendered in. Always 
+		 * returns 1 for level 0.
+		 */
+		float getLODScreenSize(UINT32 lod) const;
+
 		/**	Returns maximum number of vertices the mesh may store. */
 		UINT32 getNumVertices() const { return mNumVertices; }
 
@@ -64,6 +85,8 @@ namespace bs
 		friend class MeshBaseRTTI;
 
 		Vector<SubMesh> mSubMeshes;
+		Vector<SubMesh> mLODSubMeshes;
+		Vector<float> mLODScreenSizes;
 		UINT32 mNumVertices;
 		UINT32 mNumIndices;
 		Bounds mBounds;
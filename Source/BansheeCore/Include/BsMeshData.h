@@ -239,17 +239,17 @@ namespace bs
 			return bs_shared_ptr_new<MeshData>(numVertices, numIndexes, vertexData, indexType);
 		}
 
-	protected:
-		/**	Returns the size of the internal buffer in bytes. */
-		UINT32 getInternalBufferSize() const override;
-
-	private:
 		/**	Returns a pointer to the start of the index buffer. */
 		UINT8* getIndexData() const { return getData(); }
 
 		/**	Returns a pointer to the start of the specified vertex stream. */
 		UINT8* getStreamData(UINT32 streamIdx) const;
 
+	protected:
+		/**	Returns the size of the internal buffer in bytes. */
+		UINT32 getInternalBufferSize() const override;
+
+	private:
 		/**	Returns an offset in bytes to the start of the index buffer from the start of the internal buffer. */
 		UINT32 getIndexBufferOffset() const;
 
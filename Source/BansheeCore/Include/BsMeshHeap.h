@@ -22,6 +22,8 @@ namespace bs
 	 * normal meshes may introduce GPU-CPU sync points which may severely limit performance. Primary purpose of this class
 	 * is to avoid those sync points by not forcing you to discard contents.
 	 * Downside is that this class may allocate 2-3x (or more) memory than it is actually needed for your data.
+	 * When the heap runs out of space it adds new buffers instead of resizing the existing ones, so meshes never need to
+	 * be moved.
 	 * @note
 	 * Sim thread only
 	 */
@@ -65,6 +67,12 @@ namespace bs
 		/** @copydoc CoreObject::createCore */
 		SPtr<ct::CoreObject> createCore() const override;
 
+		/**
+		 * Queues a fence on the core thread, the first time it is called in a frame. The fence is queued after all the
+		 * rendering from the previous frame, allowing meshes used by it to be released once it is reached by the GPU.
+		 */
+		void queueFence();
+
 	private:
 		UINT32 mNumVertices;
 		UINT32 mNumIndices;
@@ -72,8 +80,9 @@ namespace bs
 		SPtr<VertexDataDesc> mVertexDesc;
 		IndexType mIndexType;
 
-		Map<UINT32, SPtr<TransientMesh>> mMeshes;
+		UnorderedMap<UINT32, SPtr<TransientMesh>> mMeshes;
 		UINT32 mNextFreeId;
+		UINT64 mLastFenceFrame;
 	};
 
 	/** @} */
@@ -91,37 +100,58 @@ namespace bs
 	 */
 	class BS_CORE_EXPORT MeshHeap : public CoreObject
 	{
-		/**	Signifies how is a data chunk used. */
-		enum class UseFlags
+		/**
+		 * Keeps track of free ranges of elements in a vertex or index buffer. Ranges are kept sorted both by their
+		 * position, so freed ranges can be merged with their neighbours, and by their size, so the smallest range that
+		 * fits an allocation can be found without searching through all of them.
+		 */
+		struct FreeList
 		{
-			Used, /**< Data chunk is used by both CPU and GPU. */
-			CPUFree, /**< Data chunk was released by CPU but not GPU. */
-			GPUFree, /**< Data chunk was released by GPU but not CPU. */
-			Free /**< Data chunk was released by both CPU and GPU. */
+			/** Clears the list and adds a single free range of @p size elements. */
+			void init(UINT32 size);
+
+			/**
+			 * Finds the smallest free range that can hold @p size elements and allocates them from its start. Returns
+			 * false if no free range is large enough.
+			 */
+			bool alloc(UINT32 size, UINT32& start);
+
+			/** Releases a previously allocated range of elements, merging it with any adjacent free ranges. */
+			void free(UINT32 start, UINT32 size);
+
+			Map<UINT32, UINT32> rangesByStart; /**< Maps range start to its size. */
+			Set<std::pair<UINT32, UINT32>> rangesBySize; /**< Contains (size, start) pairs of all ranges. */
 		};
 
-		/**	Represents a continuous chunk of memory. */
-		struct ChunkData
+		/** A set of vertex and index buffers that meshes can be allocated from. */
+		struct Page
 		{
-			UINT32 start, size;
+			SPtr<VertexData> vertexData;
+			SPtr<IndexBuffer> indexBuffer;
+
+			FreeList freeVertices;
+			FreeList freeIndices;
 		};
 
 		/**	Represents an allocated piece of data representing a mesh. */
 		struct AllocatedData
 		{
-			UINT32 vertChunkIdx;
-			UINT32 idxChunkIdx;
-
-			UseFlags useFlags;
-			UINT32 eventQueryIdx;
+			UINT32 page;
+			UINT32 vertexStart;
+			UINT32 numVertices;
+			UINT32 indexStart;
+			UINT32 numIndices;
+
+			/** Identifier of the fence following the last GPU use of the mesh, or 0 if it was never used. */
+			UINT32 lastUsedFence;
 			SPtr<TransientMesh> mesh;
 		};
 
-		/**	Data about a GPU query. */
-		struct QueryData
+		/**	Data about a fence issued on the GPU. */
+		struct FenceData
 		{
 			SPtr<EventQuery> query;
-			UINT32 queryId;
+			UINT32 fenceId;
 		};
 
 	public:
@@ -149,26 +179,26 @@ namespace bs
 		/** Deallocates the provided mesh. Freed memory will be re-used as soon as the GPU is done with the mesh. */
 		void dealloc(SPtr<TransientMesh> mesh);
 
-		/** Resizes the vertex buffers so they max contain the provided number of vertices. */
-		void growVertexBuffer(UINT32 numVertices);
+		/**
+		 * Adds a new page to the heap, with buffers large enough to hold at least the provided number of vertices and
+		 * indices. Existing pages are left untouched.
+		 */
+		void addPage(UINT32 numVertices, UINT32 numIndices);
 
-		/** Resizes the index buffer so they max contain the provided number of indices. */
-		void growIndexBuffer(UINT32 numIndices);
+		/** Returns the memory used by the provided allocation to the page it was allocated from. */
+		void release(const AllocatedData& allocData);
 
 		/**
-		 * Creates a new event query or returns an existing one from the pool if available. Returned value is an index 
-		 * into event query array.
+		 * Issues a fence on the GPU if any meshes were used since the last one was issued. Meshes deallocated since then
+		 * are released once the GPU processes the fence. Called at most once per frame.
 		 */
-		UINT32 createEventQuery();
+		void insertFence();
 
-		/** Frees the event query with the specified index and returns it to the pool so it may be reused later. */
-		void freeEventQuery(UINT32 idx);
+		/**	Gets internal vertex data for the mesh with the provided ID. */
+		SPtr<VertexData> getVertexData(UINT32 meshId) const;
 
-		/**	Gets internal vertex data for all the meshes. */
-		SPtr<VertexData> getVertexData() const;
-
-		/**	Gets internal index data for all the meshes. */
-		SPtr<IndexBuffer> getIndexBuffer() const;
+		/**	Gets internal index data for the mesh with the provided ID. */
+		SPtr<IndexBuffer> getIndexBuffer(UINT32 meshId) const;
 
 		/** Returns a structure that describes how are the vertices stored in the mesh's vertex buffer. */
 		SPtr<VertexDataDesc> getVertexDesc() const;
@@ -187,48 +217,30 @@ namespace bs
 		void notifyUsedOnGPU(UINT32 meshId);
 
 		/**
-		 * Called by an GPU event query when GPU processes the query. Normally signals the heap that the GPU is done with 
-		 * the mesh.
-		 */
-		static void queryTriggered(SPtr<MeshHeap> thisPtr, UINT32 meshId, UINT32 queryId);
-
-		/**
-		 * Attempts to reorganize the vertex and index buffer chunks in order to in order to make free memory contigous.
-		 *
-		 * @note	
-		 * This will not actually copy any data from index/vertex buffers, and will only modify the chunk descriptors.
+		 * Called by an GPU event query when GPU processes a fence. Releases the memory of all deallocated meshes that
+		 * were last used before the fence.
 		 */
-		void mergeWithNearbyChunks(UINT32 chunkVertIdx, UINT32 chunkIdxIdx);
+		static void fenceTriggered(SPtr<MeshHeap> thisPtr, UINT32 fenceId);
 
 	private:
 		UINT32 mNumVertices;
 		UINT32 mNumIndices;
 
-		Vector<UINT8*> mCPUVertexData;
-		UINT8* mCPUIndexData;
-
-		SPtr<VertexData> mVertexData;
-		SPtr<IndexBuffer> mIndexBuffer;
-
-		Map<UINT32, AllocatedData> mMeshAllocData;
+		Vector<Page> mPages;
+		UnorderedMap<UINT32, AllocatedData> mMeshAllocData;
+		Vector<UINT8> mScratchData;
 
 		SPtr<VertexDataDesc> mVertexDesc;
 		IndexType mIndexType;
 		GpuDeviceFlags mDeviceMask;
 
-		Vector<ChunkData> mVertChunks;
-		Vector<ChunkData> mIdxChunks;
-
-		Stack<UINT32> mEmptyVertChunks;
-		Stack<UINT32> mEmptyIdxChunks;
-
-		List<UINT32> mFreeVertChunks;
-		List<UINT32> mFreeIdxChunks;
-
-		Vector<QueryData> mEventQueries; 
-		Stack<UINT32> mFreeEventQueries;
+		Vector<FenceData> mActiveFences;
+		Vector<SPtr<EventQuery>> mFreeQueries;
+		Vector<UINT32> mPendingFrees;
 
-		UINT32 mNextQueryId;
+		UINT32 mNextFenceId;
+		UINT32 mLastCompletedFence;
+		bool mUsedSinceFence;
 
 		static const float GrowPercent;
 	};
@@ -162,6 +162,44 @@ namespace bs
 		 */
 		bool getImportRootMotion() const { return mImportRootMotion; }
 
+		/**
+		 * Sets the number of simplified levels of detail to generate for the mesh, in addition to the full detail mesh.
+		 * The renderer switches to lower levels of detail as the mesh gets smaller on screen. Ignored if the source file
+		 * contains its own LOD groups, in which case those are imported instead.
+		 */
+		void setNumLODs(UINT32 numLODs) { mNumLODs = numLODs; }
+
+		/**	Returns the number of generated levels of detail. @see setNumLODs */
+		UINT32 getNumLODs() const { return mNumLODs; }
+
+		/** 
+		 * Sets the portion of triangles, in range (0, 1), each generated level of detail keeps compared to the previous
+		 * level. 
+		 */
+		void setLODReduction(float reduction) { mLODReduction = reduction; }
+
+		/**	Returns the portion of triangles kept by each generated level of detail. @see setLODReduction */
+		float getLODReduction() const { return mLODReduction; }
+
+		/** 
+		 * Determines should the triangles and vertices of the mesh be reordered for more efficient use of the GPU's
+		 * vertex cache and faster vertex fetching. 
+		 */
+		void setOptimizeVertexOrder(bool optimize) { mOptimizeVertexOrder = optimize; }
+
+		/**	Checks should the triangles and vertices be reordered for efficient rendering. @see setOptimizeVertexOrder */
+		bool getOptimizeVertexOrder() const { return mOptimizeVertexOrder; }
+
+		/** 
+		 * Determines should the triangles of the mesh be additionally reordered to reduce overdraw when the mesh occludes
+		 * itself. This slightly reduces the efficiency of the vertex cache. Only relevant if vertex order optimization is
+		 * enabled.
+		 */
+		void setOptimizeOverdraw(bool optimize) { mOptimizeOverdraw = optimize; }
+
+		/**	Checks should the triangles be reordered to reduce overdraw. @see setOptimizeOverdraw */
+		bool getOptimizeOverdraw() const { return mOptimizeOverdraw; }
+
 		/** Creates a new import options object that allows you to customize how are meshes imported. */
 		static SPtr<MeshImportOptions> create();
 
@@ -176,6 +214,10 @@ namespace bs
 		bool mImportRootMotion;
 		float mImportScale;
 		CollisionMeshType mCollisionMeshType;
+		UINT32 mNumLODs;
+		float mLODReduction;
+		bool mOptimizeVertexOrder;
+		bool mOptimizeOverdraw;
 		Vector<AnimationSplitInfo> mAnimationSplits;
 		Vector<ImportedAnimationEvents> mAnimationEvents;
 
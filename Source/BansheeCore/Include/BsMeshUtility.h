@@ -177,6 +177,91 @@ namespace bs
 		 * @param[in]	stride			Distance between two entries in the @p source buffer, in bytes.
 		 */
 		static void unpackNormals(UINT8* source, Vector4* destination, UINT32 count, UINT32 stride);
+
+		/**
+		 * Reduces the number of triangles in a triangle list by repeatedly collapsing the edges whose removal introduces
+		 * the least amount of error, as measured by quadric error metrics. Edges are only ever collapsed onto one of their
+		 * existing vertices, which means the simplified triangle list can keep referencing the original vertex array.
+		 *
+		 * @param[in]	vertices			Set of vertices containing vertex positions.
+		 * @param[in]	indices				Set of indices containing indexes into vertex array for each triangle.
+		 * @param[in]	numVertices			Number of vertices in the @p vertices array.
+		 * @param[in]	numIndices			Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]	targetNumIndices	Number of indices the triangle list should be reduced to. The output can contain
+		 *									more indices than requested if the triangle list cannot be simplified any
+		 *									further without damaging its boundaries or flipping triangles.
+		 * @param[out]	output				Indices of the simplified triangle list.
+		 * @param[in]	indexSize			Size of a single index in the indices array, in bytes.
+		 *
+		 * @note	
+		 * Vertices on edges that aren't shared by exactly two triangles are never moved. Since vertices split along UV or
+		 * normal discontinuities result in such edges, this keeps seams and mesh borders intact.
+		 */
+		static void simplify(Vector3* vertices, UINT8* indices, UINT32 numVertices, UINT32 numIndices, 
+			UINT32 targetNumIndices, Vector<UINT32>& output, UINT32 indexSize = 4);
+
+		/**
+		 * Reorders triangles in a triangle list so that vertices shared between triangles are likely to still be in the
+		 * GPU's post-transform vertex cache when they are referenced again. Uses the Tipsify algorithm (Sander et al. 
+		 * 2007).
+		 *
+		 * @param[in, out]	indices		Set of indices containing indexes into vertex array for each triangle. Will be
+		 *								reordered in place.
+		 * @param[in]		numVertices	Number of vertices referenced by the @p indices array.
+		 * @param[in]		numIndices	Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]		cacheSize	Number of entries in the vertex cache to optimize for.
+		 * @param[in]		indexSize	Size of a single index in the indices array, in bytes.
+		 */
+		static void optimizeVertexCache(UINT8* indices, UINT32 numVertices, UINT32 numIndices, UINT32 cacheSize = 16,
+			UINT32 indexSize = 4);
+
+		/**
+		 * Reorders triangles in a triangle list so that triangles facing away from the mesh center are rendered first,
+		 * reducing overdraw when the mesh occludes itself. Triangles are moved in clusters, which are split only where
+		 * doing so doesn't significantly increase the vertex cache miss ratio. Should be called after 
+		 * optimizeVertexCache().
+		 *
+		 * @param[in]		vertices	Set of vertices containing vertex positions.
+		 * @param[in, out]	indices		Set of indices containing indexes into vertex array for each triangle. Will be
+		 *								reordered in place.
+		 * @param[in]		numVertices	Number of vertices in the @p vertices array.
+		 * @param[in]		numIndices	Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]		threshold	Maximum factor by which the vertex cache miss ratio of the triangle list is allowed
+		 *								to increase. Larger values result in more clusters and less overdraw.
+		 * @param[in]		cacheSize	Number of entries in the vertex cache to optimize for.
+		 * @param[in]		indexSize	Size of a single index in the indices array, in bytes.
+		 */
+		static void optimizeOverdraw(Vector3* vertices, UINT8* indices, UINT32 numVertices, UINT32 numIndices, 
+			float threshold = 1.05f, UINT32 cacheSize = 16, UINT32 indexSize = 4);
+
+		/**
+		 * Renumbers vertices in the order in which they are first referenced by the triangle list, so that the vertex
+		 * buffer is read mostly sequentially. Indices are updated in place, but the vertex data itself must be reordered
+		 * by the caller using the output remap table.
+		 *
+		 * @param[in, out]	indices		Set of indices containing indexes into vertex array for each triangle.
+		 * @param[in]		numVertices	Number of vertices referenced by the @p indices array.
+		 * @param[in]		numIndices	Number of indices in the @p indices array.
+		 * @param[out]		remap		Contains the new index of each vertex. Vertices that aren't referenced by any
+		 *								triangle are moved to the end.
+		 * @param[in]		indexSize	Size of a single index in the indices array, in bytes.
+		 */
+		static void optimizeVertexFetch(UINT8* indices, UINT32 numVertices, UINT32 numIndices, Vector<UINT32>& remap,
+			UINT32 indexSize = 4);
+
+		/**
+		 * Calculates the average number of vertices that need to be transformed per triangle (average cache miss ratio)
+		 * when rendering the provided triangle list, assuming a FIFO vertex cache of the specified size. Ranges from 3
+		 * (no vertex reuse) down to about 0.5 for optimally ordered regular meshes.
+		 *
+		 * @param[in]	indices		Set of indices containing indexes into vertex array for each triangle.
+		 * @param[in]	numVertices	Number of vertices referenced by the @p indices array.
+		 * @param[in]	numIndices	Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]	cacheSize	Number of entries in the vertex cache.
+		 * @param[in]	indexSize	Size of a single index in the indices array, in bytes.
+		 */
+		static float calculateACMR(UINT8* indices, UINT32 numVertices, UINT32 numIndices, UINT32 cacheSize = 16,
+			UINT32 indexSize = 4);
 	};
 
 	/** @} */
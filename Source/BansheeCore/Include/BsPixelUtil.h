@@ -55,6 +55,14 @@ namespace bs
 	typedef Flags<MirrorModeBits> MirrorMode;
 	BS_FLAGS_OPERATORS(MirrorModeBits);
 
+	/** Sets of SIMD instructions that pixel format conversion, scaling and mirroring can use. */
+	enum class PixelSIMDLevel
+	{
+		None, /*< Only scalar code is used. */
+		SSE2, /*< SSE2 code is used where available. */
+		AVX2 /*< AVX2 code is used where available, and SSE2 code elsewhere. */
+	};
+
 	/**	Options used to control texture compression. */
 	struct CompressionOptions
 	{
@@ -283,6 +291,25 @@ namespace bs
 		 * @param[in]	bpp		Number of bits per pixel of the pixels in the buffer.
 		 */
 		static void applyGamma(UINT8* buffer, float gamma, UINT32 size, UINT8 bpp);
+
+	public: // ***** INTERNAL ******
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Returns the most capable set of SIMD instructions supported by both the build and the CPU. */
+		static PixelSIMDLevel _getSupportedSIMDLevel();
+
+		/**
+		 * Limits the set of SIMD instructions used by pixel operations, allowing them to be compared against their scalar
+		 * versions. Levels not supported by the CPU are ignored. By default the most capable supported set is used.
+		 */
+		static void _setSIMDLevel(PixelSIMDLevel level);
+
+		/** Returns the set of SIMD instructions used by pixel operations. */
+		static PixelSIMDLevel _getSIMDLevel();
+
+		/** @} */
 	};
 
 	/** @} */
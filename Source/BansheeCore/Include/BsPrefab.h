@@ -92,11 +92,24 @@ namespace bs
 		/**	Creates an empty and uninitialized prefab. */
 		static SPtr<Prefab> createEmpty();
 
+		/** Frees the cached serialized copy of the prefab hierarchy. Must be called whenever the hierarchy changes. */
+		void clearCloneData();
+
+		/** 
+		 * Checks if the prefab instance with the provided root object, or any prefab instance nested within it, was
+		 * instantiated from an older version of its prefab. 
+		 */
+		static bool isInstanceOutOfDate(const HSceneObject& root);
+
 		HSceneObject mRoot;
 		UINT32 mHash;
 		String mUUID;
 		bool mIsScene;
 
+		// Serialized copy of mRoot, cached so it doesn't need to be re-encoded on every instantiation
+		UINT8* mCloneData;
+		UINT32 mCloneDataSize;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
@@ -25,6 +25,7 @@ namespace bs
 
 		UINT32 numVertices; /**< Total number of vertices sent to the GPU. */
 		UINT32 numPrimitives; /**< Total number of primitives sent to the GPU. */
+		UINT32 numInstances; /**< Total number of mesh instances drawn, including instances from instanced draw calls. */
 		UINT32 numDrawnSamples; /**< Number of samples drawn by the GPU. */
 
 		UINT32 numPipelineStateChanges; /**< How many times did the pipeline state change. */
@@ -29,7 +29,7 @@ namespace bs
 		RenderStatsData()
 		: numDrawCalls(0), numComputeCalls(0), numRenderTargetChanges(0), numPresents(0), numClears(0)
 		, numVertices(0), numPrimitives(0), numPipelineStateChanges(0), numGpuParamBinds(0), numVertexBufferBinds(0)
-		, numIndexBufferBinds(0)
+		, numIndexBufferBinds(0), numInstances(0)
 		{ }
 
 		UINT64 numDrawCalls;
@@ -47,6 +47,8 @@ namespace bs
 		UINT64 numVertexBufferBinds; 
 		UINT64 numIndexBufferBinds;
 
+		UINT64 numInstances;
+
 		UINT64 numResourceWrites;
 		UINT64 numResourceReads;
 
@@ -86,6 +88,12 @@ namespace bs
 		/** Increments primitive draw counter indicating how many primitives were sent to the pipeline. */
 		void addNumPrimitives(UINT32 count) { mData.numPrimitives += count; }
 
+		/** 
+		 * Increments instance draw counter indicating how many mesh instances were drawn. Non-instanced draw calls count
+		 * as a single instance.
+		 */
+		void addNumInstances(UINT32 count) { mData.numInstances += count; }
+
 		/** Increments pipeline state change counter indicating how many times was a pipeline state bound. */
 		void incNumPipelineStateChanges() { mData.numPipelineStateChanges++; }
 
@@ -169,6 +169,12 @@ namespace bs
 		/** Notifies the manager that a component is about to be destroyed. The manager triggers necessary callbacks. */
 		void _notifyComponentDestroyed(const HComponent& component);
 
+		/**
+		 * Triggered when the hierarchy of an instantiated scene object changes: a child is added or removed, or the object
+		 * is renamed, activated or deactivated, or has its prefab link changed. Provides the object that was modified.
+		 */
+		Event<void(const HSceneObject&)> onHierarchyModified;
+
 	protected:
 		friend class SceneObject;
 
@@ -68,6 +68,9 @@ namespace bs
 		/**	Returns a handle to this object. */
 		HSceneObject getHandle() const { return mThisHandle; }
 
+		/** Changes the name of the object. */
+		void setName(const String& name);
+
 		/**
 		 * Returns the UUID of the prefab this object is linked to, if any. 
 		 *
@@ -123,7 +126,7 @@ namespace bs
 		 * Allows you to change the prefab link UUID of this object. Normally this should be accompanied by reassigning the
 		 * link IDs.
 		 */
-		void _setPrefabLinkUUID(const String& UUID) { mPrefabLinkUUID = UUID; }
+		void _setPrefabLinkUUID(const String& UUID);
 
 		/**
 		 * Returns a prefab diff object containing instance specific modifications of this object compared to its prefab
@@ -140,6 +143,24 @@ namespace bs
 		/** Recursively disables the provided set of flags on this object and all children. */
 		void _unsetFlags(UINT32 flags);
 
+		/**
+		 * Serializes this object and its children into a buffer that can be used for creating any number of clones 
+		 * through _decodeClone(). 
+		 *
+		 * @param[in]	instantiate	If false, the cloned hierarchies will just be memory copies, but will not be present in
+		 *							the scene or otherwise active until instantiate() is called.
+		 * @param[out]	size		Size of the returned buffer, in bytes.
+		 * @return					Buffer containing the serialized hierarchy, allocated using the general allocator. Caller
+		 *							is responsible for freeing it with bs_free().
+		 */
+		UINT8* _encodeClone(bool instantiate, UINT32& size);
+
+		/** 
+		 * Creates a new copy of the hierarchy previously serialized by _encodeClone(). All objects in the copy are assigned
+		 * new IDs. 
+		 */
+		static HSceneObject _decodeClone(UINT8* data, UINT32 size);
+
 		/** @} */
 
 	private:
@@ -509,6 +530,9 @@ namespace bs
 		/** Changes the object active in hierarchy state, and triggers necessary events. */
 		void setActiveHierarchy(bool active, bool triggerEvents = true);
 
+		/** Notifies the scene manager the object's name, active state, prefab link or list of children changed. */
+		void notifyHierarchyModified();
+
 		/************************************************************************/
 		/* 								Component	                     		*/
 		/************************************************************************/
@@ -10,6 +10,9 @@
 
 namespace bs 
 {
+	struct TextureStreamData;
+	class TextureStreamingManager;
+
 	/** @addtogroup Resources
 	 *  @{
 	 */
@@ -171,7 +174,8 @@ namespace bs
 		 * Updates the texture with new data. Provided data buffer will be locked until the operation completes.
 		 *
 		 * @param[in]	data				Pixel data to write. User must ensure it is in format and size compatible with 
-		 *									the texture.
+		 *									the texture. If the data is smaller than the mip level, only the area 
+		 *									described by its extents is written to.
 		 * @param[in]	face				Texture face to write to.	
 		 * @param[in]	mipLevel			Mipmap level to write to.				
 		 * @param[in]	discardEntireBuffer When true the existing contents of the resource you are updating will be 
@@ -221,6 +225,23 @@ namespace bs
 		/**	Retrieves a core implementation of a texture usable only from the core thread. */
 		SPtr<ct::Texture> getCore() const;
 
+		/**
+		 * Enables or disables streaming of the texture's mip levels. When a streamable texture is saved its more detailed
+		 * mip levels are stored separately, and once the texture is loaded they are only read when the
+		 * TextureStreamingManager determines they are needed. Only 2D and cube textures with static usage and without
+		 * multisampling can be streamed.
+		 */
+		void setStreamable(bool streamable);
+
+		/** Checks are the texture's mip levels streamed. See setStreamable(). */
+		bool isStreamable() const { return mNumStreamedMips > 0; }
+
+		/**
+		 * Returns the most detailed mip level that is currently resident in memory. Only mip levels starting with this one
+		 * can be read or written. Always zero unless the texture is streamed.
+		 */
+		UINT32 getFirstResidentMip() const { return mFirstResidentMip; }
+
 		/************************************************************************/
 		/* 								STATICS		                     		*/
 		/************************************************************************/
@@ -265,6 +286,7 @@ namespace bs
 
     protected:
 		friend class TextureManager;
+		friend class TextureStreamingManager;
 
 		Texture(const TEXTURE_DESC& desc);
 		Texture(const TEXTURE_DESC& desc, const SPtr<PixelData>& pixelData);
@@ -275,6 +297,9 @@ namespace bs
 		/** @copydoc CoreObject::createCore */
 		SPtr<ct::CoreObject> createCore() const override;
 
+		/** @copydoc Resource::isCompressible */
+		bool isCompressible() const override { return mNumStreamedMips == 0; } // Streamed mips must be readable separately
+
 		/** Calculates the size of the texture, in bytes. */
 		UINT32 calculateSize() const;
 
@@ -293,6 +318,11 @@ namespace bs
 		TextureProperties mProperties;
 		mutable SPtr<PixelData> mInitData;
 
+		UINT32 mNumStreamedMips = 0;
+		UINT32 mFirstResidentMip = 0;
+		UINT32 mStreamingId = (UINT32)-1;
+		SPtr<TextureStreamData> mStreamData;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -385,7 +415,9 @@ namespace bs
 		/**
 		 * Writes data from the provided buffer into the texture buffer.
 		 * 		  
-		 * @param[in]	src					Buffer to retrieve the data from.
+		 * @param[in]	src					Buffer to retrieve the data from. If smaller than the mip level, only the area
+		 *									described by its extents is written to, and the rest of the mip level keeps
+		 *									its contents.
 		 * @param[in]	mipLevel			(optional) Mipmap level to write into.
 		 * @param[in]	face				(optional) Texture face to write into.
 		 * @param[in]	discardWholeBuffer	(optional) If true any existing texture data will be discard. This can improve 
@@ -398,6 +430,12 @@ namespace bs
 		/**	Returns properties that contain information about the texture. */
 		const TextureProperties& getProperties() const { return mProperties; }
 
+		/**
+		 * Returns the identifier the TextureStreamingManager uses for the texture, or -1 if the texture's mip levels aren't
+		 * streamed. Properties of a streamed texture only describe its resident mip levels.
+		 */
+		UINT32 getStreamingId() const { return mStreamingId; }
+
 		/************************************************************************/
 		/* 								STATICS		                     		*/
 		/************************************************************************/
@@ -437,6 +475,9 @@ namespace bs
 		/** Returns a plain normal map texture with normal pointing up (in Y direction). */
 		static SPtr<Texture> NORMAL;
 	protected:
+		friend class bs::Texture;
+		friend class bs::TextureStreamingManager;
+
 		/** @copydoc lock */
 		virtual PixelData lockImpl(GpuLockOptions options, UINT32 mipLevel = 0, UINT32 face = 0, UINT32 deviceIdx = 0,
 			UINT32 queueIdx = 0) = 0;
@@ -469,6 +510,7 @@ namespace bs
 		UnorderedMap<TEXTURE_VIEW_DESC, SPtr<TextureView>, TextureView::HashFunction, TextureView::EqualFunction> mTextureViews;
 		TextureProperties mProperties;
 		SPtr<PixelData> mInitData;
+		UINT32 mStreamingId = (UINT32)-1;
 	};
 
 	/** @} */
@@ -81,6 +81,15 @@ namespace bs
 		 */
 		CubemapSourceType getCubemapSourceType() const { return mCubemapSourceType; }
 
+		/**
+		 * Determines should the more detailed mip levels of the texture be streamed in when needed, instead of being
+		 * loaded together with the texture. See Texture::setStreamable().
+		 */
+		void setStreamable(bool streamable) { mStreamable = streamable; }
+
+		/** Checks will the more detailed mip levels of the texture be streamed in when needed. */
+		bool getStreamable() const { return mStreamable; }
+
 		/** Creates a new import options object that allows you to customize how are textures imported. */
 		static SPtr<TextureImportOptions> create();
 
@@ -100,6 +109,7 @@ namespace bs
 		bool mSRGB;
 		bool mCubemap;
 		CubemapSourceType mCubemapSourceType;
+		bool mStreamable;
 	};
 
 	/** @} */
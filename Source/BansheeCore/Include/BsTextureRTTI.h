@@ -10,6 +10,8 @@
 #include "BsRenderAPI.h"
 #include "BsTextureManager.h"
 #include "BsPixelData.h"
+#include "BsDataStream.h"
+#include "BsTextureStreamingManager.h"
 
 namespace bs
 {
@@ -31,6 +33,7 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN_NAMED(numSamples, mProperties.mDesc.numSamples, 7)
 			BS_RTTI_MEMBER_PLAIN_NAMED(type, mProperties.mDesc.type, 9)
 			BS_RTTI_MEMBER_PLAIN_NAMED(format, mProperties.mDesc.format, 10)
+			BS_RTTI_MEMBER_PLAIN(mNumStreamedMips, 13)
 		BS_END_RTTI_MEMBERS
 
 		INT32& getUsage(Texture* obj) { return obj->mProperties.mDesc.usage; }
@@ -50,10 +53,17 @@ namespace bs
 #define BS_ADD_PLAINFIELD(name, id, parentType) \
 	addPlainField(#name, id##, &##parentType##::get##name, &##parentType##::Set##name);
 
+		/** Returns the number of mip levels stored in the pixel data array, as streamed mip levels are stored separately. */
+		static UINT32 getNumInlineMips(Texture* obj)
+		{
+			return obj->mProperties.getNumMipmaps() + 1 - obj->mNumStreamedMips;
+		}
+
 		SPtr<PixelData> getPixelData(Texture* obj, UINT32 idx)
 		{
-			UINT32 face = (size_t)Math::floor(idx / (float)(obj->mProperties.getNumMipmaps() + 1));
-			UINT32 mipmap = idx % (obj->mProperties.getNumMipmaps() + 1);
+			UINT32 numInlineMips = getNumInlineMips(obj);
+			UINT32 face = idx / numInlineMips;
+			UINT32 mipmap = obj->mNumStreamedMips + idx % numInlineMips;
 
 			SPtr<PixelData> pixelData = obj->mProperties.allocBuffer(face, mipmap);
 
@@ -72,7 +82,7 @@ namespace bs
 
 		UINT32 getPixelDataArraySize(Texture* obj)
 		{
-			return obj->mProperties.getNumFaces() * (obj->mProperties.getNumMipmaps() + 1);
+			return obj->mProperties.getNumFaces() * getNumInlineMips(obj);
 		}
 
 		void setPixelDataArraySize(Texture* obj, UINT32 size)
@@ -82,6 +92,54 @@ namespace bs
 			pixelData->resize(size);
 		}
 
+		SPtr<DataStream> getStreamData(Texture* obj, UINT32& size)
+		{
+			UINT32 numStreamedMips = obj->mNumStreamedMips;
+
+			Vector<SPtr<PixelData>> mips;
+			if (obj->mStreamData != nullptr)
+				TextureStreamingManager::_readMips(*obj->mStreamData, obj->mProperties, 0, numStreamedMips, mips);
+			else
+			{
+				UINT32 numFaces = obj->mProperties.getNumFaces();
+				for (UINT32 mip = 0; mip < numStreamedMips; mip++)
+				{
+					for (UINT32 face = 0; face < numFaces; face++)
+					{
+						SPtr<PixelData> pixelData = obj->mProperties.allocBuffer(face, mip);
+						obj->readData(pixelData, face, mip);
+
+						mips.push_back(pixelData);
+					}
+				}
+
+				gCoreThread().submit(true);
+			}
+
+			size = 0;
+			for (auto& entry : mips)
+				size += entry->getSize();
+
+			SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>(size);
+			for (auto& entry : mips)
+				stream->write(entry->getData(), entry->getSize());
+
+			stream->seek(0);
+			return stream;
+		}
+
+		void setStreamData(Texture* obj, const SPtr<DataStream>& val, UINT32 size)
+		{
+			if (size == 0)
+				return;
+
+			// Streamed mip levels are read on demand, so keep a reference to the source stream
+			obj->mStreamData = bs_shared_ptr_new<TextureStreamData>();
+			obj->mStreamData->stream = val->clone();
+			obj->mStreamData->offset = (UINT32)val->tell();
+			obj->mStreamData->size = size;
+		}
+
 	public:
 		TextureRTTI()
 			:mInitMembers(this)
@@ -90,6 +148,8 @@ namespace bs
 
 			addReflectablePtrArrayField("mPixelData", 12, &TextureRTTI::getPixelData, &TextureRTTI::getPixelDataArraySize, 
 				&TextureRTTI::setPixelData, &TextureRTTI::setPixelDataArraySize, RTTI_Flag_SkipInReferenceSearch);
+
+			addDataBlockField("mStreamData", 14, &TextureRTTI::getStreamData, &TextureRTTI::setStreamData, 0);
 		}
 
 		void onDeserializationStarted(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override
@@ -129,14 +189,34 @@ namespace bs
 				}
 			}
 
+			// Streamed mip levels are only read when needed, unless there is no streaming manager to read them
+			Vector<SPtr<PixelData>> streamedMips;
+			if (texture->mStreamData != nullptr)
+			{
+				texture->mStreamData->format = originalFormat;
+
+				if (TextureStreamingManager::isStarted())
+					texture->mFirstResidentMip = texture->mNumStreamedMips;
+				else
+				{
+					TextureStreamingManager::_readMips(*texture->mStreamData, texProps, 0, texture->mNumStreamedMips,
+						streamedMips);
+				}
+			}
+
 			// A bit clumsy initializing with already set values, but I feel its better than complicating things and storing the values
 			// in mRTTIData.
 			texture->initialize();
 
-			for(size_t i = 0; i < pixelData->size(); i++)
+			UINT32 numFaces = texProps.getNumFaces();
+			for (UINT32 i = 0; i < (UINT32)streamedMips.size(); i++)
+				texture->writeData(streamedMips[i], i % numFaces, i / numFaces, false);
+
+			UINT32 numInlineMips = getNumInlineMips(texture);
+			for(UINT32 i = 0; i < (UINT32)pixelData->size(); i++)
 			{
-				UINT32 face = (size_t)Math::floor(i / (float)(texProps.getNumMipmaps() + 1));
-				UINT32 mipmap = i % (texProps.getNumMipmaps() + 1);
+				UINT32 face = i / numInlineMips;
+				UINT32 mipmap = texture->mNumStreamedMips + i % numInlineMips;
 
 				texture->writeData(pixelData->at(i), face, mipmap, false);
 			}
@@ -0,0 +1,196 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsModule.h"
+#include "BsPixelData.h"
+#include "BsResourceHandle.h"
+#include "BsEvent.h"
+
+namespace bs
+{
+	class TextureProperties;
+
+	/** @addtogroup Resources-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Location of the streamed mip levels of a texture on a storage device. Mip levels are stored from the most detailed
+	 * one, with all faces of a mip level stored together. Shared between all versions of a streamed texture.
+	 */
+	struct TextureStreamData
+	{
+		SPtr<DataStream> stream;
+		UINT32 offset = 0;
+		UINT32 size = 0;
+		PixelFormat format = PF_UNKNOWN;
+
+		/** Must be locked when reading from @p stream. */
+		Mutex mutex;
+	};
+
+	/** Information about how large a streamed texture appeared on screen during a frame. */
+	struct StreamedTextureUsage
+	{
+		/** Identifier of the texture, as returned by ct::Texture::getStreamingId(). */
+		UINT32 streamingId;
+
+		/** Height of the area the texture was mapped onto, in pixels. */
+		float screenSize;
+	};
+
+	/**
+	 * Decides which mip levels of streamed textures should be resident in memory, based on the size the textures appear
+	 * on screen as reported by the renderer, and loads or evicts the mip levels accordingly. The least detailed mip levels
+	 * of a streamed texture (the mip tail) are always resident, while the more detailed levels are read from the storage
+	 * device on worker threads when needed. Once the memory used by streamed textures exceeds the budget, most detailed
+	 * mip levels of least recently used textures are evicted first.
+	 *
+	 * Changing the resident mip levels of a texture creates a new version of the texture and assigns it to the texture's
+	 * resource handle, so objects referencing the texture pick up the change the same way they would if the texture was
+	 * re-imported.
+	 *
+	 * @note	Sim thread only unless noted otherwise.
+	 */
+	class BS_CORE_EXPORT TextureStreamingManager : public Module<TextureStreamingManager>
+	{
+		/** Mip levels read from the storage device by a worker thread. */
+		struct MipLoad
+		{
+			UINT32 firstMip = 0;
+			UINT32 numMips = 0;
+			Vector<SPtr<PixelData>> mips;
+			SPtr<Task> task;
+		};
+
+		/** Streaming state of a single texture. */
+		struct StreamedTexture
+		{
+			WeakResourceHandle<Texture> handle;
+			UINT32 firstResidentMip = 0;
+			UINT32 tailMip = 0;
+			UINT32 requestedMip = 0;
+			UINT64 residentSize = 0;
+			UINT64 lastUsedFrame = 0;
+			SPtr<MipLoad> load;
+		};
+
+	public:
+		TextureStreamingManager();
+		~TextureStreamingManager();
+
+		/**
+		 * Sets the maximum amount of memory the resident mip levels of streamed textures can use, in bytes. The mip tails
+		 * are always resident, so the budget can be exceeded if there are too many streamed textures.
+		 */
+		void setMemoryBudget(UINT64 budget) { mMemoryBudget = budget; }
+
+		/** Returns the maximum amount of memory the resident mip levels of streamed textures can use, in bytes. */
+		UINT64 getMemoryBudget() const { return mMemoryBudget; }
+
+		/** Returns the amount of memory used by the resident mip levels of all streamed textures, in bytes. */
+		UINT64 getResidentMemory() const { return mResidentMemory; }
+
+		/** 
+		 * Returns the number of streamed textures currently tracked by the manager. 
+		 *
+		 * @note	Thread safe.
+		 */
+		UINT32 getNumTextures() const { return mNumTextures.load(std::memory_order_relaxed); }
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Loads or evicts mip levels of streamed textures according to the latest usage. Called once per frame. */
+		void _update();
+
+		/**
+		 * Reports streamed textures used for rendering during the current frame.
+		 *
+		 * @note	Core thread.
+		 */
+		void _notifyUsage(const Vector<StreamedTextureUsage>& usage);
+
+		/**
+		 * Returns a counter that gets incremented whenever a streaming identifier is assigned to an already existing core 
+		 * texture. Any cached lists of streamed textures should be rebuilt when the counter changes.
+		 *
+		 * @note	Core thread.
+		 */
+		static UINT32 _getCoreIdVersion() { return sCoreIdVersion; }
+
+		/**
+		 * Reads streamed mip levels of a texture from the storage device, and converts them to the texture's format if
+		 * needed.
+		 *
+		 * @param[in]	data		Location of the streamed mip levels.
+		 * @param[in]	props		Properties of the texture, with the full mip chain.
+		 * @param[in]	firstMip	First mip level to read.
+		 * @param[in]	numMips		Number of mip levels to read.
+		 * @param[out]	output		Pixel data for each read mip level and face, with all faces of a mip level stored
+		 *							together.
+		 *
+		 * @note	Thread safe.
+		 */
+		static void _readMips(TextureStreamData& data, const TextureProperties& props, UINT32 firstMip, UINT32 numMips,
+			Vector<SPtr<PixelData>>& output);
+
+		/** @} */
+
+		/** Mip levels of a streamed texture that are this size or smaller are always kept resident. */
+		static const UINT32 MIP_TAIL_SIZE = 64;
+
+		/** Memory budget used if none is set. */
+		static const UINT64 DEFAULT_MEMORY_BUDGET = 512 * 1024 * 1024;
+
+		/** Maximum number of textures that can have their mip levels loading at once. */
+		static const UINT32 MAX_CONCURRENT_LOADS = 4;
+
+		/** Number of frames a texture needs to go unused before it stops requesting its more detailed mip levels. */
+		static const UINT32 UNUSED_FRAME_COUNT = 120;
+
+	private:
+		/** Triggered by the resources system when a resource has finished loading. */
+		void onResourceLoaded(const HResource& resource);
+
+		/** Starts tracking a newly loaded streamed texture. */
+		void registerTexture(const HTexture& texture);
+
+		/** Stops tracking a texture and frees up its identifier. */
+		void unregisterTexture(UINT32 streamingId);
+
+		/** Starts reading the mip levels of a texture required to make its requested mip level resident. */
+		void startLoad(UINT32 streamingId);
+
+		/**
+		 * Replaces the texture with a version with a different set of resident mip levels.
+		 *
+		 * @param[in]	streamingId		Identifier of the texture to update.
+		 * @param[in]	firstMip		Most detailed mip level to make resident.
+		 * @param[in]	loadedMips		Pixel data for all mip levels more detailed than the currently resident ones, in
+		 *								the format output by _readMips(). Not used when evicting mip levels.
+		 */
+		void setResidentMips(UINT32 streamingId, UINT32 firstMip, const Vector<SPtr<PixelData>>& loadedMips);
+
+		/** Returns the memory used by the mip levels of a texture, starting at the specified mip level. */
+		static UINT64 getMipChainSize(const TextureProperties& props, UINT32 firstMip);
+
+		Vector<StreamedTexture> mTextures;
+		Vector<UINT32> mFreeIds;
+		std::atomic<UINT32> mNumTextures;
+		UINT64 mMemoryBudget = DEFAULT_MEMORY_BUDGET;
+		UINT64 mResidentMemory = 0;
+
+		Mutex mMutex;
+		Vector<HResource> mLoadedResources;
+		Vector<StreamedTextureUsage> mUsage;
+		HEvent mResourceLoadedConn;
+
+		static UINT32 sCoreIdVersion;
+	};
+
+	/** @} */
+}
\ No newline at end of file
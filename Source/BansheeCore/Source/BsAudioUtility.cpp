@@ -2,6 +2,10 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsAudioUtility.h"
 
+#if BS_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace bs
 {
 	void convertToMono8(const INT8* input, UINT8* output, UINT32 numSamples, UINT32 numChannels)
@@ -202,50 +206,125 @@ namespace bs
 		}
 	}
 
-	void AudioUtility::convertToFloat(const UINT8* input, UINT32 inBitDepth, float* output, UINT32 numSamples)
+	void convert8ToFloat(const INT8* input, float* output, UINT32 numSamples)
 	{
-		if (inBitDepth == 8)
+		const float scale = 1.0f / 127.0f;
+
+		UINT32 i = 0;
+#if BS_SIMD_SSE2
+		const __m128 scaleVec = _mm_set1_ps(scale);
+		for (; i + 16 <= numSamples; i += 16)
 		{
-			for (UINT32 i = 0; i < numSamples; i++)
-			{
-				INT8 sample = *(INT8*)input;
-				output[i] = sample / 127.0f;
+			__m128i packed = _mm_loadu_si128((const __m128i*)(input + i));
 
-				input++;
-			}
+			// Sign extend by moving each byte to the top of a wider lane and shifting it back down arithmetically
+			__m128i lo16 = _mm_unpacklo_epi8(packed, packed);
+			__m128i hi16 = _mm_unpackhi_epi8(packed, packed);
+
+			__m128i v0 = _mm_srai_epi32(_mm_unpacklo_epi16(lo16, lo16), 24);
+			__m128i v1 = _mm_srai_epi32(_mm_unpackhi_epi16(lo16, lo16), 24);
+			__m128i v2 = _mm_srai_epi32(_mm_unpacklo_epi16(hi16, hi16), 24);
+			__m128i v3 = _mm_srai_epi32(_mm_unpackhi_epi16(hi16, hi16), 24);
+
+			_mm_storeu_ps(output + i + 0, _mm_mul_ps(_mm_cvtepi32_ps(v0), scaleVec));
+			_mm_storeu_ps(output + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(v1), scaleVec));
+			_mm_storeu_ps(output + i + 8, _mm_mul_ps(_mm_cvtepi32_ps(v2), scaleVec));
+			_mm_storeu_ps(output + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(v3), scaleVec));
 		}
-		else if (inBitDepth == 16)
+#endif
+
+		for (; i < numSamples; i++)
+			output[i] = input[i] * scale;
+	}
+
+	void convert16ToFloat(const INT16* input, float* output, UINT32 numSamples)
+	{
+		const float scale = 1.0f / 32767.0f;
+
+		UINT32 i = 0;
+#if BS_SIMD_SSE2
+		const __m128 scaleVec = _mm_set1_ps(scale);
+		for (; i + 8 <= numSamples; i += 8)
 		{
-			for (UINT32 i = 0; i < numSamples; i++)
-			{
-				INT16 sample = *(INT16*)input;
-				output[i] = sample / 32767.0f;
+			__m128i packed = _mm_loadu_si128((const __m128i*)(input + i));
 
-				input += 2;
-			}
+			__m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+			__m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(packed, packed), 16);
+
+			_mm_storeu_ps(output + i + 0, _mm_mul_ps(_mm_cvtepi32_ps(lo), scaleVec));
+			_mm_storeu_ps(output + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scaleVec));
 		}
-		else if (inBitDepth == 24)
+#endif
+
+		for (; i < numSamples; i++)
+			output[i] = input[i] * scale;
+	}
+
+	void convert24ToFloat(const UINT8* input, float* output, UINT32 numSamples)
+	{
+		const float scale = 1.0f / 2147483647.0f;
+
+		UINT32 i = 0;
+#if BS_SIMD_SSE2
+		const __m128 scaleVec = _mm_set1_ps(scale);
+		for (; i + 4 <= numSamples; i += 4)
 		{
-			for (UINT32 i = 0; i < numSamples; i++)
-			{
-				INT32 sample = convert24To32Bits(input);
-				output[i] = sample / 2147483647.0f;
+			__m128i unpacked = _mm_set_epi32(
+				AudioUtility::convert24To32Bits(input + 9),
+				AudioUtility::convert24To32Bits(input + 6),
+				AudioUtility::convert24To32Bits(input + 3),
+				AudioUtility::convert24To32Bits(input + 0));
 
-				input += 3;
-			}
+			_mm_storeu_ps(output + i, _mm_mul_ps(_mm_cvtepi32_ps(unpacked), scaleVec));
+			input += 12;
 		}
-		else if (inBitDepth == 32)
+#endif
+
+		for (; i < numSamples; i++)
 		{
-			for (UINT32 i = 0; i < numSamples; i++)
-			{
-				INT32 sample = *(INT32*)input;
-				output[i] = sample / 2147483647.0f;
+			output[i] = AudioUtility::convert24To32Bits(input) * scale;
+			input += 3;
+		}
+	}
 
-				input += 4;
-			}
+	void convert32ToFloat(const INT32* input, float* output, UINT32 numSamples)
+	{
+		const float scale = 1.0f / 2147483647.0f;
+
+		UINT32 i = 0;
+#if BS_SIMD_SSE2
+		const __m128 scaleVec = _mm_set1_ps(scale);
+		for (; i + 4 <= numSamples; i += 4)
+		{
+			__m128i packed = _mm_loadu_si128((const __m128i*)(input + i));
+			_mm_storeu_ps(output + i, _mm_mul_ps(_mm_cvtepi32_ps(packed), scaleVec));
 		}
-		else
+#endif
+
+		for (; i < numSamples; i++)
+			output[i] = input[i] * scale;
+	}
+
+	void AudioUtility::convertToFloat(const UINT8* input, UINT32 inBitDepth, float* output, UINT32 numSamples)
+	{
+		switch (inBitDepth)
+		{
+		case 8:
+			convert8ToFloat((INT8*)input, output, numSamples);
+			break;
+		case 16:
+			convert16ToFloat((INT16*)input, output, numSamples);
+			break;
+		case 24:
+			convert24ToFloat(input, output, numSamples);
+			break;
+		case 32:
+			convert32ToFloat((INT32*)input, output, numSamples);
+			break;
+		default:
 			assert(false);
+			break;
+		}
 	}
 
 	INT32 AudioUtility::convert24To32Bits(const UINT8* input)
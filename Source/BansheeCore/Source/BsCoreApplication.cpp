@@ -41,6 +41,7 @@
 #include "BsRenderStats.h"
 #include "BsMessageHandler.h"
 #include "BsResourceListenerManager.h"
+#include "BsTextureStreamingManager.h"
 #include "BsRenderStateManager.h"
 #include "BsShaderManager.h"
 #include "BsPhysicsManager.h"
@@ -74,6 +75,7 @@ namespace bs
 
 		ct::ParamBlockManager::shutDown();
 		StringTableManager::shutDown();
+		TextureStreamingManager::shutDown();
 		Resources::shutDown();
 		GameObjectManager::shutDown();
 		ResourceListenerManager::shutDown();
@@ -115,12 +117,24 @@ namespace bs
 
 		MemStack::endThread();
 		Platform::_shutDown();
+
+		// Flush the remaining messages and stop the log file writer thread
+		gDebug().getLog().setOutputFile(Path::BLANK);
 	}
 
 	void CoreApplication::onStartUp()
 	{
 		UINT32 numWorkerThreads = BS_THREAD_HARDWARE_CONCURRENCY - 1; // Number of cores while excluding current thread.
 
+		Log& log = gDebug().getLog();
+		log.setMaxEntries(mStartUpDesc.logMaxEntries);
+
+		for (UINT32 i = 0; i < 32; i++)
+			log.setChannelEnabled(i, (mStartUpDesc.logChannels & (1U << i)) != 0);
+
+		if (!mStartUpDesc.logFile.isEmpty())
+			log.setOutputFile(mStartUpDesc.logFile);
+
 		Platform::_startUp();
 		MemStack::beginThread();
 
@@ -141,6 +155,7 @@ namespace bs
 		GameObjectManager::startUp();
 		Resources::startUp();
 		ResourceListenerManager::startUp();
+		TextureStreamingManager::startUp();
 		GpuProgramManager::startUp();
 		RenderStateManager::startUp();
 		ct::GpuProgramManager::startUp();
@@ -235,6 +250,9 @@ namespace bs
 
 			postUpdate();
 
+			// Load or evict streamed texture mip levels before the resource events are sent out
+			TextureStreamingManager::instance()._update();
+
 			// Send out resource events in case any were loaded/destroyed/modified
 			ResourceListenerManager::instance().update();
 
@@ -3,7 +3,10 @@
 #include "BsFont.h"
 #include "BsFontRTTI.h"
 #include "BsFontManager.h"
+#include "BsFontRasterizer.h"
+#include "BsFontGlyphCache.h"
 #include "BsResources.h"
+#include "BsDataStream.h"
 
 namespace bs
 {
@@ -28,8 +31,10 @@ namespace bs
 		return FontBitmap::getRTTIStatic();
 	}
 
+	Event<void(const Font&)> Font::onGlyphsEvicted;
+
 	Font::Font()
-		:Resource(false)
+		:Resource(false), mDynamic(false), mSDF(false), mDPI(96), mRenderMode(FontRenderMode::HintedSmooth)
 	{ }
 
 	Font::~Font()
@@ -43,8 +48,95 @@ namespace bs
 		Resource::initialize();
 	}
 
+	void Font::initialize(const SPtr<DataStream>& fontData, UINT32 dpi, FontRenderMode renderMode, bool sdf)
+	{
+		mDynamic = true;
+		mSDF = sdf;
+		mDPI = dpi;
+		mRenderMode = renderMode;
+
+		mSourceData.resize(fontData->size());
+		fontData->read(mSourceData.data(), mSourceData.size());
+
+		Resource::initialize();
+	}
+
+	void Font::_cacheGlyphs(UINT32 size, const WString& text)
+	{
+		if (!mDynamic)
+			return;
+
+		FontGlyphCache* glyphCache = getGlyphCache();
+		if (glyphCache == nullptr)
+			return;
+
+		UINT32 version = glyphCache->getVersion();
+		glyphCache->cacheGlyphs(size, text);
+
+		if (glyphCache->getVersion() != version)
+			onGlyphsEvicted(*this);
+	}
+
+	UINT32 Font::_getGlyphCacheVersion() const
+	{
+		if (mGlyphCache == nullptr)
+			return 0;
+
+		return mGlyphCache->getVersion();
+	}
+
+	void Font::_addPageReferences(UINT32 pageMask)
+	{
+		if (mGlyphCache != nullptr)
+			mGlyphCache->addPageReferences(pageMask);
+	}
+
+	void Font::_removePageReferences(UINT32 pageMask)
+	{
+		if (mGlyphCache != nullptr)
+			mGlyphCache->removePageReferences(pageMask);
+	}
+
+	void Font::_markPagesUsed(UINT32 pageMask)
+	{
+		if (mGlyphCache != nullptr)
+			mGlyphCache->markPagesUsed(pageMask);
+	}
+
+	FontGlyphCache* Font::getGlyphCache() const
+	{
+		if (mGlyphCache != nullptr)
+			return mGlyphCache.get();
+
+		const SPtr<FontRasterizer>& rasterizer = FontManager::instance().getRasterizer();
+		if (rasterizer == nullptr)
+		{
+			LOGERR("Cannot use a dynamic font because no font rasterizer is registered.");
+			return nullptr;
+		}
+
+		SPtr<FontFace> face = rasterizer->createFace(mSourceData.data(), (UINT32)mSourceData.size(), mDPI, mRenderMode);
+		if (face == nullptr)
+		{
+			LOGERR("Failed to load dynamic font data for font: " + toString(getName()));
+			return nullptr;
+		}
+
+		mGlyphCache = bs_shared_ptr_new<FontGlyphCache>(face, mSDF);
+		return mGlyphCache.get();
+	}
+
 	SPtr<const FontBitmap> Font::getBitmap(UINT32 size) const
 	{
+		if (mDynamic)
+		{
+			FontGlyphCache* glyphCache = getGlyphCache();
+			if (glyphCache == nullptr)
+				return nullptr;
+
+			return glyphCache->getBitmap(size);
+		}
+
 		auto iterFind = mFontDataPerSize.find(size);
 
 		if(iterFind == mFontDataPerSize.end())
@@ -55,6 +147,10 @@ namespace bs
 
 	INT32 Font::getClosestSize(UINT32 size) const
 	{
+		// Dynamic fonts can rasterize characters of any size
+		if (mDynamic)
+			return size;
+
 		UINT32 minDiff = std::numeric_limits<UINT32>::max();
 		UINT32 bestSize = size;
 
@@ -116,11 +212,23 @@ namespace bs
 		return static_resource_cast<Font>(gResources()._createResourceHandle(newFont));
 	}
 
+	HFont Font::createDynamic(const SPtr<DataStream>& fontData, UINT32 dpi, FontRenderMode renderMode, bool sdf)
+	{
+		SPtr<Font> newFont = _createDynamicPtr(fontData, dpi, renderMode, sdf);
+
+		return static_resource_cast<Font>(gResources()._createResourceHandle(newFont));
+	}
+
 	SPtr<Font> Font::_createPtr(const Vector<SPtr<FontBitmap>>& fontData)
 	{
 		return FontManager::instance().create(fontData);
 	}
 
+	SPtr<Font> Font::_createDynamicPtr(const SPtr<DataStream>& fontData, UINT32 dpi, FontRenderMode renderMode, bool sdf)
+	{
+		return FontManager::instance().createDynamic(fontData, dpi, renderMode, sdf);
+	}
+
 	RTTITypeBase* Font::getRTTIStatic()
 	{
 		return FontRTTI::instance();
@@ -0,0 +1,448 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsFontGlyphCache.h"
+#include "BsFontRasterizer.h"
+#include "BsPixelData.h"
+#include "BsPixelUtil.h"
+#include "BsTexture.h"
+#include "BsTime.h"
+#include "BsMath.h"
+
+namespace bs
+{
+	FontGlyphCache::FontGlyphCache(const SPtr<FontFace>& face, bool sdf)
+		:mFace(face), mSDF(sdf), mVersion(0)
+	{ }
+
+	SPtr<FontBitmap> FontGlyphCache::getBitmap(UINT32 size)
+	{
+		auto iterFind = mBitmaps.find(size);
+		if (iterFind != mBitmaps.end())
+			return iterFind->second;
+
+		SPtr<FontBitmap> bitmap = bs_shared_ptr_new<FontBitmap>();
+		bitmap->size = size;
+		bitmap->fontDesc.missingGlyph = CHAR_DESC();
+
+		mFace->getMetrics(size, bitmap->fontDesc.baselineOffset, bitmap->fontDesc.lineHeight,
+			bitmap->fontDesc.spaceWidth);
+
+		for (auto& page : mPages)
+			bitmap->texturePages.push_back(page.texture);
+
+		mBitmaps[size] = bitmap;
+		return bitmap;
+	}
+
+	void FontGlyphCache::cacheGlyphs(UINT32 size, const WString& text)
+	{
+		SPtr<FontBitmap> bitmap = getBitmap(size);
+		UINT64 frameIdx = gTime().getFrameIdx();
+
+		const Glyph* missingGlyph = findOrCreateGlyph(FontFace::MISSING_GLYPH, size);
+		if (missingGlyph != nullptr)
+		{
+			mPages[missingGlyph->page].lastUsedFrame = frameIdx;
+			fillCharDesc(0, *missingGlyph, size, bitmap->fontDesc.missingGlyph);
+		}
+
+		for (auto& character : text)
+		{
+			UINT32 charId = (UINT32)character;
+
+			auto iterFind = bitmap->fontDesc.characters.find(charId);
+			if (iterFind != bitmap->fontDesc.characters.end())
+			{
+				mPages[iterFind->second.page].lastUsedFrame = frameIdx;
+				continue;
+			}
+
+			const Glyph* glyph = findOrCreateGlyph(charId, size);
+			if (glyph == nullptr)
+				continue;
+
+			mPages[glyph->page].lastUsedFrame = frameIdx;
+			fillCharDesc(charId, *glyph, size, bitmap->fontDesc.characters[charId]);
+		}
+
+		updateKerning(*bitmap, text);
+		updateTextures();
+	}
+
+	void FontGlyphCache::addPageReferences(UINT32 pageMask)
+	{
+		for (UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+		{
+			if ((pageMask & (1 << i)) != 0)
+				mPages[i].numReferences++;
+		}
+
+		markPagesUsed(pageMask);
+	}
+
+	void FontGlyphCache::removePageReferences(UINT32 pageMask)
+	{
+		for (UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+		{
+			if ((pageMask & (1 << i)) == 0)
+				continue;
+
+			assert(mPages[i].numReferences > 0);
+			mPages[i].numReferences--;
+		}
+	}
+
+	void FontGlyphCache::markPagesUsed(UINT32 pageMask)
+	{
+		UINT64 frameIdx = gTime().getFrameIdx();
+		for (UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+		{
+			if ((pageMask & (1 << i)) != 0)
+				mPages[i].lastUsedFrame = frameIdx;
+		}
+	}
+
+	const FontGlyphCache::Glyph* FontGlyphCache::findOrCreateGlyph(UINT32 charId, UINT32 size)
+	{
+		UINT64 key = getGlyphKey(charId, size);
+
+		auto iterFind = mGlyphs.find(key);
+		if (iterFind != mGlyphs.end())
+			return &iterFind->second;
+
+		if (mMissingGlyphs.find(key) != mMissingGlyphs.end())
+			return nullptr;
+
+		RASTERIZED_GLYPH rasterized;
+		if (!mFace->rasterize(charId, mSDF ? SDF_SIZE : size, rasterized))
+		{
+			mMissingGlyphs.insert(key);
+			return nullptr;
+		}
+
+		if (mSDF)
+			generateSDF(rasterized);
+
+		Glyph glyph;
+		glyph.width = rasterized.width;
+		glyph.height = rasterized.height;
+		glyph.xOffset = rasterized.xOffset;
+		glyph.yOffset = rasterized.yOffset;
+		glyph.xAdvance = rasterized.xAdvance;
+		glyph.yAdvance = rasterized.yAdvance;
+		glyph.x = 0;
+		glyph.y = 0;
+		glyph.page = 0;
+
+		if (glyph.width > 0 && glyph.height > 0)
+		{
+			// Leave a pixel of space between characters so they don't bleed into each other when filtered
+			if (!allocate(glyph.width + 1, glyph.height + 1, glyph.page, glyph.x, glyph.y))
+			{
+				LOGWRN("Unable to fit character " + toString(charId) + " in the font atlas.");
+
+				mMissingGlyphs.insert(key);
+				return nullptr;
+			}
+
+			Page& page = mPages[glyph.page];
+			page.glyphs.push_back(key);
+			page.markDirty(PixelVolume(glyph.x, glyph.y, glyph.x + glyph.width, glyph.y + glyph.height));
+
+			UINT32 rowPitch = page.pixels->getRowPitch();
+			const UINT8* srcBuffer = rasterized.pixels.data();
+			UINT8* dstBuffer = page.pixels->getData() + (glyph.y * rowPitch + glyph.x) * 2;
+
+			// Second channel is left empty for distance fields, which allows the shader to tell them apart from
+			// regular bitmaps
+			for (UINT32 row = 0; row < glyph.height; row++)
+			{
+				for (UINT32 column = 0; column < glyph.width; column++)
+				{
+					dstBuffer[column * 2 + 0] = srcBuffer[column];
+					dstBuffer[column * 2 + 1] = mSDF ? 0 : srcBuffer[column];
+				}
+
+				dstBuffer += rowPitch * 2;
+				srcBuffer += glyph.width;
+			}
+		}
+		else
+		{
+			// Empty characters (e.g. space) don't occupy any space in the atlas, but still need a valid page
+			if (mPages.empty())
+				createPage();
+		}
+
+		auto iterAdded = mGlyphs.insert(std::make_pair(key, glyph));
+		return &iterAdded.first->second;
+	}
+
+	bool FontGlyphCache::allocate(UINT32 width, UINT32 height, UINT32& page, UINT32& x, UINT32& y)
+	{
+		if (width > PAGE_SIZE || height > PAGE_SIZE)
+			return false;
+
+		UINT64 frameIdx = gTime().getFrameIdx();
+		for (UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+		{
+			if (mPages[i].layout.addElement(width, height, x, y))
+			{
+				mPages[i].lastUsedFrame = frameIdx;
+				page = i;
+
+				return true;
+			}
+		}
+
+		// No space left, create a new page unless we reached the limit, in which case reuse the least recently used
+		// page. Pages displayed by existing text are only reused if all pages are, as their eviction requires all text
+		// to be laid out again. Pages used in the current frame are never evicted, as text using them might still be 
+		// in the process of being generated.
+		UINT32 pageIdx = (UINT32)mPages.size();
+		if (mPages.size() >= MAX_PAGES)
+		{
+			for (UINT32 pass = 0; pass < 2 && pageIdx == (UINT32)mPages.size(); pass++)
+			{
+				bool allowReferenced = pass > 0;
+
+				UINT64 oldestFrame = frameIdx;
+				for (UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+				{
+					if (mPages[i].numReferences > 0 && !allowReferenced)
+						continue;
+
+					if (mPages[i].lastUsedFrame < oldestFrame)
+					{
+						oldestFrame = mPages[i].lastUsedFrame;
+						pageIdx = i;
+					}
+				}
+			}
+		}
+
+		if (pageIdx == (UINT32)mPages.size())
+			createPage();
+		else
+			evictPage(pageIdx);
+
+		if (!mPages[pageIdx].layout.addElement(width, height, x, y))
+			return false;
+
+		mPages[pageIdx].lastUsedFrame = frameIdx;
+		page = pageIdx;
+
+		return true;
+	}
+
+	void FontGlyphCache::createPage()
+	{
+		Page page;
+		page.layout = TextureAtlasLayout(PAGE_SIZE, PAGE_SIZE, PAGE_SIZE, PAGE_SIZE);
+		page.pixels = PixelData::create(PAGE_SIZE, PAGE_SIZE, 1, PF_R8G8);
+		memset(page.pixels->getData(), 0, page.pixels->getSize());
+
+		TEXTURE_DESC texDesc;
+		texDesc.width = PAGE_SIZE;
+		texDesc.height = PAGE_SIZE;
+		texDesc.format = PF_R8G8;
+
+		page.texture = Texture::create(texDesc);
+		page.texture->setName(L"FontPage" + toWString((UINT32)mPages.size()));
+		page.markDirty(PixelVolume(0, 0, PAGE_SIZE, PAGE_SIZE));
+
+		for (auto& entry : mBitmaps)
+			entry.second->texturePages.push_back(page.texture);
+
+		mPages.push_back(page);
+	}
+
+	void FontGlyphCache::evictPage(UINT32 pageIdx)
+	{
+		Page& page = mPages[pageIdx];
+
+		// Kerning is stored with the left character of a pair, so it needs to be calculated again once it is re-added
+		UnorderedSet<UINT64> evictedKeys(page.glyphs.begin(), page.glyphs.end());
+		for (auto iter = mKerningPairs.begin(); iter != mKerningPairs.end();)
+		{
+			UINT32 size = (UINT32)(*iter >> 42);
+			UINT32 leftCharId = (UINT32)(*iter >> 21) & 0x1FFFFF;
+
+			if (evictedKeys.find(getGlyphKey(leftCharId, size)) != evictedKeys.end())
+				iter = mKerningPairs.erase(iter);
+			else
+				++iter;
+		}
+
+		for (auto& key : page.glyphs)
+		{
+			mGlyphs.erase(key);
+
+			UINT32 charId = (UINT32)key;
+			UINT32 size = (UINT32)(key >> 32);
+
+			for (auto& entry : mBitmaps)
+			{
+				if (!mSDF && entry.first != size)
+					continue;
+
+				FONT_DESC& fontDesc = entry.second->fontDesc;
+				if (charId == FontFace::MISSING_GLYPH)
+					fontDesc.missingGlyph = CHAR_DESC();
+				else
+					fontDesc.characters.erase(charId);
+			}
+		}
+
+		page.glyphs.clear();
+		page.layout.clear();
+		page.markDirty(PixelVolume(0, 0, PAGE_SIZE, PAGE_SIZE));
+		mVersion++;
+
+		memset(page.pixels->getData(), 0, page.pixels->getSize());
+	}
+
+	void FontGlyphCache::fillCharDesc(UINT32 charId, const Glyph& glyph, UINT32 size, CHAR_DESC& output) const
+	{
+		float scale = mSDF ? size / (float)SDF_SIZE : 1.0f;
+		float invPageSize = 1.0f / PAGE_SIZE;
+
+		output.charId = charId;
+		output.page = glyph.page;
+		output.uvX = glyph.x * invPageSize;
+		output.uvY = glyph.y * invPageSize;
+		output.uvWidth = glyph.width * invPageSize;
+		output.uvHeight = glyph.height * invPageSize;
+		output.width = (UINT32)Math::roundToInt(glyph.width * scale);
+		output.height = (UINT32)Math::roundToInt(glyph.height * scale);
+		output.xOffset = Math::roundToInt(glyph.xOffset * scale);
+		output.yOffset = Math::roundToInt(glyph.yOffset * scale);
+		output.xAdvance = Math::roundToInt(glyph.xAdvance * scale);
+		output.yAdvance = Math::roundToInt(glyph.yAdvance * scale);
+		output.kerningPairs.clear();
+	}
+
+	void FontGlyphCache::updateKerning(FontBitmap& bitmap, const WString& text)
+	{
+		if (!mFace->hasKerning())
+			return;
+
+		Map<UINT32, CHAR_DESC>& characters = bitmap.fontDesc.characters;
+		for (UINT32 i = 1; i < (UINT32)text.size(); i++)
+		{
+			UINT32 leftCharId = (UINT32)text[i - 1];
+			UINT32 rightCharId = (UINT32)text[i];
+
+			auto iterLeft = characters.find(leftCharId);
+			if (iterLeft == characters.end() || characters.find(rightCharId) == characters.end())
+				continue;
+
+			if (!mKerningPairs.insert(getKerningKey(leftCharId, rightCharId, bitmap.size)).second)
+				continue;
+
+			INT32 amount = mFace->getKerning(leftCharId, rightCharId, bitmap.size);
+			if (amount != 0)
+				iterLeft->second.kerningPairs.push_back({ rightCharId, amount });
+		}
+	}
+
+	void FontGlyphCache::updateTextures()
+	{
+		for (auto& page : mPages)
+		{
+			if (!page.dirty)
+				continue;
+
+			// Only the modified area is uploaded. Texture keeps the provided buffer locked until the upload completes on
+			// the core thread, so we provide a copy, which also handles the case when the texture format doesn't match 
+			// the requested one.
+			const PixelVolume& area = page.dirtyArea;
+			SPtr<PixelData> pixelData = PixelData::create(area, page.texture->getProperties().getFormat());
+
+			PixelData dstData(area.getWidth(), area.getHeight(), 1, pixelData->getFormat());
+			dstData.setExternalBuffer(pixelData->getData());
+
+			PixelUtil::bulkPixelConversion(page.pixels->getSubVolume(area), dstData);
+
+			page.texture->writeData(pixelData);
+			page.dirty = false;
+		}
+	}
+
+	void FontGlyphCache::Page::markDirty(const PixelVolume& area)
+	{
+		if (!dirty)
+		{
+			dirtyArea = area;
+			dirty = true;
+
+			return;
+		}
+
+		dirtyArea.left = std::min(dirtyArea.left, area.left);
+		dirtyArea.top = std::min(dirtyArea.top, area.top);
+		dirtyArea.right = std::max(dirtyArea.right, area.right);
+		dirtyArea.bottom = std::max(dirtyArea.bottom, area.bottom);
+	}
+
+	void FontGlyphCache::generateSDF(RASTERIZED_GLYPH& glyph)
+	{
+		if (glyph.width == 0 || glyph.height == 0)
+			return;
+
+		INT32 spread = (INT32)SDF_SPREAD;
+		INT32 width = (INT32)glyph.width + spread * 2;
+		INT32 height = (INT32)glyph.height + spread * 2;
+
+		// Determine which pixels are inside the character, including the padding
+		Vector<UINT8> inside(width * height, 0);
+		for (INT32 y = 0; y < (INT32)glyph.height; y++)
+		{
+			for (INT32 x = 0; x < (INT32)glyph.width; x++)
+				inside[(y + spread) * width + x + spread] = glyph.pixels[y * glyph.width + x] >= 128 ? 1 : 0;
+		}
+
+		// For each pixel find the closest pixel on the other side of the edge, within the spread distance
+		Vector<UINT8> output(width * height);
+		float maxDistance = (float)(spread + 1);
+		for (INT32 y = 0; y < height; y++)
+		{
+			for (INT32 x = 0; x < width; x++)
+			{
+				UINT8 isInside = inside[y * width + x];
+				float minDistanceSqrd = maxDistance * maxDistance;
+
+				INT32 startY = std::max(y - spread, 0);
+				INT32 endY = std::min(y + spread, height - 1);
+				INT32 startX = std::max(x - spread, 0);
+				INT32 endX = std::min(x + spread, width - 1);
+
+				for (INT32 otherY = startY; otherY <= endY; otherY++)
+				{
+					for (INT32 otherX = startX; otherX <= endX; otherX++)
+					{
+						if (inside[otherY * width + otherX] == isInside)
+							continue;
+
+						float distanceSqrd = (float)((otherX - x) * (otherX - x) + (otherY - y) * (otherY - y));
+						minDistanceSqrd = std::min(minDistanceSqrd, distanceSqrd);
+					}
+				}
+
+				// Edge lies half-way between the two pixels
+				float distance = Math::sqrt(minDistanceSqrd) - 0.5f;
+				if (!isInside)
+					distance = -distance;
+
+				float value = Math::clamp01(0.5f + distance / (2.0f * spread));
+				output[y * width + x] = (UINT8)Math::roundToInt(value * 255.0f);
+			}
+		}
+
+		glyph.pixels = output;
+		glyph.width = (UINT32)width;
+		glyph.height = (UINT32)height;
+		glyph.xOffset -= spread;
+		glyph.yOffset += spread;
+	}
+}
\ No newline at end of file
@@ -14,6 +14,16 @@ namespace bs
 		return newFont;
 	}
 
+	SPtr<Font> FontManager::createDynamic(const SPtr<DataStream>& fontData, UINT32 dpi, FontRenderMode renderMode, 
+		bool sdf) const
+	{
+		SPtr<Font> newFont = bs_core_ptr<Font>(new (bs_alloc<Font>()) Font());
+		newFont->_setThisPtr(newFont);
+		newFont->initialize(fontData, dpi, renderMode, sdf);
+
+		return newFont;
+	}
+
 	SPtr<Font> FontManager::_createEmpty() const
 	{
 		SPtr<Font> newFont = bs_core_ptr<Font>(new (bs_alloc<Font>()) Font());
@@ -59,15 +59,37 @@ namespace bs
 			return;
 
 		UINT64 instanceId = object->getInstanceId();
-		mQueuedForDestroy[instanceId] = object;
+		if (mQueuedForDestroyIds.insert(instanceId).second)
+			mQueuedForDestroy.push_back(std::make_pair(instanceId, object));
 	}
 
 	void GameObjectManager::destroyQueuedObjects()
 	{
-		for (auto& objPair : mQueuedForDestroy)
-			objPair.second->destroyInternal(objPair.second, true);
+		// Objects being destroyed may queue more objects for destruction (e.g. from their OnDestroy callbacks), so keep
+		// going until the queue is empty. The queue is swapped out first so that doesn't invalidate the iteration.
+		while (!mQueuedForDestroy.empty())
+		{
+			std::swap(mQueuedForDestroy, mDestroyingObjects);
+			mQueuedForDestroyIds.clear();
+
+			// Destroy in order of creation
+			std::sort(mDestroyingObjects.begin(), mDestroyingObjects.end(), 
+				[](const std::pair<UINT64, GameObjectHandleBase>& a, const std::pair<UINT64, GameObjectHandleBase>& b)
+			{
+				return a.first < b.first;
+			});
+
+			for (auto& objPair : mDestroyingObjects)
+			{
+				// Might have been destroyed along with an object destroyed before it (e.g. its parent)
+				if (objPair.second.isDestroyed())
+					continue;
+
+				objPair.second->destroyInternal(objPair.second, true);
+			}
 
-		mQueuedForDestroy.clear();
+			mDestroyingObjects.clear();
+		}
 	}
 
 	GameObjectHandleBase GameObjectManager::registerObject(const SPtr<GameObject>& object, UINT64 originalId)
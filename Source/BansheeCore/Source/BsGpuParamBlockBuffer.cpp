@@ -32,6 +32,10 @@ namespace bs
 		}
 #endif
 
+		// Skip the sync if nothing changed, see ct::GpuParamBlockBuffer::write
+		if (!isCoreDirty() && memcmp(mCachedData + offset, data, size) == 0)
+			return;
+
 		memcpy(mCachedData + offset, data, size);
 		markCoreDirty();
 	}
@@ -91,7 +95,7 @@ namespace bs
 	namespace ct
 	{
 	GpuParamBlockBuffer::GpuParamBlockBuffer(UINT32 size, GpuParamBlockUsage usage, GpuDeviceFlags deviceMask)
-		:mUsage(usage), mSize(size), mCachedData(nullptr), mGPUBufferDirty(false)
+		:mUsage(usage), mSize(size), mCachedData(nullptr), mGPUBufferDirty(true)
 	{
 		if (mSize > 0)
 			mCachedData = (UINT8*)bs_alloc(mSize);
@@ -116,6 +120,12 @@ namespace bs
 		}
 #endif
 
+		// Most blocks get re-written every frame with largely the same values. Comparing is much cheaper than uploading,
+		// so only mark the buffer dirty if its contents actually change. Once the buffer is dirty there's nothing left to 
+		// save, so the comparison is skipped.
+		if (!mGPUBufferDirty && memcmp(mCachedData + offset, data, size) == 0)
+			return;
+
 		memcpy(mCachedData + offset, data, size);
 		mGPUBufferDirty = true;
 	}
@@ -10,6 +10,8 @@
 #include "BsResources.h"
 #include "BsFrameAlloc.h"
 #include "BsMatrixNxM.h"
+#include "BsTexture.h"
+#include "BsTextureStreamingManager.h"
 #include "BsVectorNI.h"
 #include "BsMemorySerializer.h"
 #include "BsMaterialParams.h"
@@ -761,9 +763,53 @@ namespace bs
 
 		initializeTechniques();
 
+		// Parameters object was replaced, so its version can't be compared with the cached one
+		mStreamedTexturesParamVersion = 0;
+
 		_markCoreDirty();
 	}
 
+	const Vector<UINT32>& Material::_getStreamedTextures() const
+	{
+		if (mParams == nullptr)
+		{
+			mStreamedTextures.clear();
+			return mStreamedTextures;
+		}
+
+		// Identifiers can also be assigned to textures after they are bound
+		UINT32 idVersion = TextureStreamingManager::_getCoreIdVersion();
+		if (mStreamedTexturesParamVersion == mParams->getParamVersion() && mStreamedTexturesIdVersion == idVersion)
+			return mStreamedTextures;
+
+		mStreamedTextures.clear();
+
+		UINT32 numParams = mParams->getNumParams();
+		for (UINT32 i = 0; i < numParams; i++)
+		{
+			const MaterialParams::ParamData* paramData = mParams->getParamData(i);
+			if (paramData->type != MaterialParams::ParamType::Texture)
+				continue;
+
+			SPtr<Texture> texture;
+			TextureSurface surface;
+			mParams->getTexture(*paramData, texture, surface);
+
+			if (texture == nullptr || texture->getStreamingId() == (UINT32)-1)
+				continue;
+
+			UINT32 streamingId = texture->getStreamingId();
+			auto iterFind = std::find(mStreamedTextures.begin(), mStreamedTextures.end(), streamingId);
+			if (iterFind == mStreamedTextures.end())
+				mStreamedTextures.push_back(streamingId);
+		}
+
+		mStreamedTexturesParamVersion = mParams->getParamVersion();
+		mStreamedTexturesIdVersion = idVersion;
+
+		return mStreamedTextures;
+	}
+
 	void Material::syncToCore(const CoreSyncData& data)
 	{
 		char* dataPtr = (char*)data.getBuffer();
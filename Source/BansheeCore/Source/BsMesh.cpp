@@ -20,7 +20,8 @@ namespace bs
 		:MeshBase(desc.numVertices, desc.numIndices, desc.subMeshes), mVertexDesc(desc.vertexDesc), mUsage(desc.usage),
 		mIndexType(desc.indexType), mSkeleton(desc.skeleton), mMorphShapes(desc.morphShapes)
 	{
-
+		mProperties.mLODSubMeshes = desc.lodSubMeshes;
+		mProperties.mLODScreenSizes = desc.lodScreenSizes;
 	}
 
 	Mesh::Mesh(const SPtr<MeshData>& initialMeshData, const MESH_DESC& desc)
@@ -29,7 +30,8 @@ namespace bs
 		mUsage(desc.usage), mIndexType(initialMeshData->getIndexType()), mSkeleton(desc.skeleton), 
 		mMorphShapes(desc.morphShapes)
 	{
-
+		mProperties.mLODSubMeshes = desc.lodSubMeshes;
+		mProperties.mLODScreenSizes = desc.lodScreenSizes;
 	}
 
 	Mesh::Mesh()
@@ -120,6 +122,8 @@ namespace bs
 		desc.numIndices = mProperties.mNumIndices;
 		desc.vertexDesc = mVertexDesc;
 		desc.subMeshes = mProperties.mSubMeshes;
+		desc.lodSubMeshes = mProperties.mLODSubMeshes;
+		desc.lodScreenSizes = mProperties.mLODScreenSizes;
 		desc.usage = mUsage;
 		desc.indexType = mIndexType;
 		desc.skeleton = mSkeleton;
@@ -297,8 +301,10 @@ namespace bs
 		: MeshBase(desc.numVertices, desc.numIndices, desc.subMeshes), mVertexData(nullptr), mIndexBuffer(nullptr)
 		, mVertexDesc(desc.vertexDesc), mUsage(desc.usage), mIndexType(desc.indexType), mDeviceMask(deviceMask)
 		, mTempInitialMeshData(initialMeshData), mSkeleton(desc.skeleton), mMorphShapes(desc.morphShapes)
-		
-	{ }
+	{
+		mProperties.mLODSubMeshes = desc.lodSubMeshes;
+		mProperties.mLODScreenSizes = desc.lodScreenSizes;
+	}
 
 	Mesh::~Mesh()
 	{
@@ -308,6 +314,7 @@ namespace bs
 		mIndexBuffer = nullptr;
 		mVertexDesc = nullptr;
 		mTempInitialMeshData = nullptr;
+		mCachedData = nullptr;
 	}
 
 	void Mesh::initialize()
@@ -348,6 +355,10 @@ namespace bs
 		if (mTempInitialMeshData != nullptr)
 		{
 			writeData(*mTempInitialMeshData, isDynamic);
+
+			if ((mUsage & MU_CPUCACHED) != 0)
+				mCachedData = mTempInitialMeshData;
+
 			mTempInitialMeshData = nullptr;
 		}
 
@@ -41,6 +41,35 @@ namespace bs
 		return (UINT32)mSubMeshes.size();
 	}
 
+	const SubMesh& MeshProperties::getSubMesh(UINT32 subMeshIdx, UINT32 lod) const
+	{
+		if (lod == 0)
+			return getSubMesh(subMeshIdx);
+
+		if (lod >= getNumLODs())
+		{
+			BS_EXCEPT(InvalidParametersException, "Invalid level of detail index ("
+				+ toString(lod) + "). Number of levels available: " + toString(getNumLODs()));
+		}
+
+		UINT32 idx = (lod - 1) * (UINT32)mSubMeshes.size() + subMeshIdx;
+		if (subMeshIdx >= mSubMeshes.size() || idx >= mLODSubMeshes.size())
+		{
+			BS_EXCEPT(InvalidParametersException, "Invalid sub-mesh index ("
+				+ toString(subMeshIdx) + "). Number of sub-meshes available: " + toString((int)mSubMeshes.size()));
+		}
+
+		return mLODSubMeshes[idx];
+	}
+
+	float MeshProperties::getLODScreenSize(UINT32 lod) const
+	{
+		if (lod == 0 || lod > (UINT32)mLODScreenSizes.size())
+			return 1.0f;
+
+		return mLODScreenSizes[lod - 1];
+	}
+
 	MeshBase::MeshBase(UINT32 numVertices, UINT32 numIndices, DrawOperationType drawOp)
 		:mProperties(numVertices, numIndices, drawOp)
 	{ }
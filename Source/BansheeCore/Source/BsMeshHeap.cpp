@@ -10,12 +10,14 @@
 #include "BsMath.h"
 #include "BsEventQuery.h"
 #include "BsRenderAPI.h"
+#include "BsTime.h"
 
 namespace bs
 {
 	MeshHeap::MeshHeap(UINT32 numVertices, UINT32 numIndices, 
 		const SPtr<VertexDataDesc>& vertexDesc, IndexType indexType)
 		:mNumVertices(numVertices), mNumIndices(numIndices), mVertexDesc(vertexDesc), mIndexType(indexType), mNextFreeId(0)
+		, mLastFenceFrame((UINT64)-1)
 	{
 	}
 
@@ -33,6 +35,8 @@ namespace bs
 
 	SPtr<TransientMesh> MeshHeap::alloc(const SPtr<MeshData>& meshData, DrawOperationType drawOp)
 	{
+		queueFence();
+
 		UINT32 meshIdx = mNextFreeId++;
 
 		SPtr<MeshHeap> thisPtr = std::static_pointer_cast<MeshHeap>(getThisPtr());
@@ -56,12 +60,24 @@ namespace bs
 		if(iterFind == mMeshes.end())
 			return;
 
+		queueFence();
+
 		mesh->markAsDestroyed();
 		mMeshes.erase(iterFind);
 
 		queueGpuCommand(getCore(), std::bind(&ct::MeshHeap::dealloc, getCore().get(), mesh->getCore()));
 	}
 
+	void MeshHeap::queueFence()
+	{
+		UINT64 frameIdx = gTime().getFrameIdx();
+		if (frameIdx == mLastFenceFrame)
+			return;
+
+		queueGpuCommand(getCore(), std::bind(&ct::MeshHeap::insertFence, getCore().get()));
+		mLastFenceFrame = frameIdx;
+	}
+
 	SPtr<ct::MeshHeap> MeshHeap::getCore() const
 	{
 		return std::static_pointer_cast<ct::MeshHeap>(mCoreSpecific);
@@ -82,197 +98,151 @@ namespace bs
 	{
 	const float MeshHeap::GrowPercent = 1.5f;
 
-	MeshHeap::MeshHeap(UINT32 numVertices, UINT32 numIndices,
-		const SPtr<VertexDataDesc>& vertexDesc, IndexType indexType, GpuDeviceFlags deviceMask)
-		: mNumVertices(numVertices), mNumIndices(numIndices), mCPUIndexData(nullptr), mVertexDesc(vertexDesc)
-		, mIndexType(indexType), mNextQueryId(0), mDeviceMask(deviceMask)
+	void MeshHeap::FreeList::init(UINT32 size)
 	{
-		for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
-		{
-			mCPUVertexData.push_back(nullptr);
-		}
-	}
+		rangesByStart.clear();
+		rangesBySize.clear();
 
-	MeshHeap::~MeshHeap()
-	{
-		THROW_IF_NOT_CORE_THREAD;
-
-		for (auto& cpuVertBuffer : mCPUVertexData)
-			bs_free(cpuVertBuffer);
-
-		if (mCPUIndexData != nullptr)
-			bs_free(mCPUIndexData);
+		if (size == 0)
+			return;
 
-		mVertexData = nullptr;
-		mIndexBuffer = nullptr;
-		mVertexDesc = nullptr;
+		rangesByStart[0] = size;
+		rangesBySize.insert(std::make_pair(size, 0U));
 	}
 
-	void MeshHeap::initialize()
+	bool MeshHeap::FreeList::alloc(UINT32 size, UINT32& start)
 	{
-		THROW_IF_NOT_CORE_THREAD;
+		if (size == 0)
+		{
+			start = 0;
+			return true;
+		}
 
-		growVertexBuffer(mNumVertices);
-		growIndexBuffer(mNumIndices);
+		auto iterFind = rangesBySize.lower_bound(std::make_pair(size, 0U));
+		if (iterFind == rangesBySize.end())
+			return false;
 
-		CoreObject::initialize();
-	}
+		UINT32 rangeSize = iterFind->first;
+		start = iterFind->second;
 
-	void MeshHeap::alloc(SPtr<TransientMesh> mesh, const SPtr<MeshData>& meshData)
-	{
-		// Find free vertex chunk and grow if needed
-		UINT32 smallestVertFit = 0;
-		UINT32 smallestVertFitIdx = 0;
+		rangesBySize.erase(iterFind);
+		rangesByStart.erase(start);
 
-		while (smallestVertFit == 0)
+		UINT32 remaining = rangeSize - size;
+		if (remaining > 0)
 		{
-			UINT32 curIdx = 0;
-			for (auto& chunkIdx : mFreeVertChunks)
-			{
-				ChunkData& chunk = mVertChunks[chunkIdx];
-
-				if (chunk.size >= meshData->getNumVertices() && (chunk.size < smallestVertFit || smallestVertFit == 0))
-				{
-					smallestVertFit = chunk.size;
-					smallestVertFitIdx = curIdx;
-				}
-
-				curIdx++;
-			}
-
-			if (smallestVertFit > 0)
-				break;
+			rangesByStart[start + size] = remaining;
+			rangesBySize.insert(std::make_pair(remaining, start + size));
+		}
 
-			UINT32 newNumVertices = mNumVertices;
-			while (newNumVertices < (mNumVertices + meshData->getNumVertices()))
-			{
-				newNumVertices = Math::roundToInt(newNumVertices * GrowPercent);
-			}
+		return true;
+	}
 
-			growVertexBuffer(newNumVertices);
-		}
+	void MeshHeap::FreeList::free(UINT32 start, UINT32 size)
+	{
+		if (size == 0)
+			return;
 
-		// Find free index chunk and grow if needed
-		UINT32 smallestIdxFit = 0;
-		UINT32 smallestIdxFitIdx = 0;
+		auto iterNext = rangesByStart.lower_bound(start);
 
-		while (smallestIdxFit == 0)
+		// Merge with the preceding range
+		if (iterNext != rangesByStart.begin())
 		{
-			UINT32 curIdx = 0;
-			for (auto& chunkIdx : mFreeIdxChunks)
+			auto iterPrev = std::prev(iterNext);
+			if ((iterPrev->first + iterPrev->second) == start)
 			{
-				ChunkData& chunk = mIdxChunks[chunkIdx];
-
-				if (chunk.size >= meshData->getNumIndices() && (chunk.size < smallestIdxFit || smallestIdxFit == 0))
-				{
-					smallestIdxFit = chunk.size;
-					smallestIdxFitIdx = curIdx;
-				}
-
-				curIdx++;
-			}
-
-			if (smallestIdxFit > 0)
-				break;
+				start = iterPrev->first;
+				size += iterPrev->second;
 
-			UINT32 newNumIndices = mNumIndices;
-			while (newNumIndices < (mNumIndices + meshData->getNumIndices()))
-			{
-				newNumIndices = Math::roundToInt(newNumIndices * GrowPercent);
+				rangesBySize.erase(std::make_pair(iterPrev->second, iterPrev->first));
+				rangesByStart.erase(iterPrev);
 			}
-
-			growIndexBuffer(newNumIndices);
 		}
 
-		UINT32 freeVertChunkIdx = 0;
-		UINT32 freeIdxChunkIdx = 0;
-
-		auto freeVertIter = mFreeVertChunks.begin();
-		freeVertChunkIdx = (*freeVertIter);
-		for (UINT32 i = 0; i < smallestVertFitIdx; i++)
+		// Merge with the following range
+		if (iterNext != rangesByStart.end() && iterNext->first == (start + size))
 		{
-			freeVertIter++;
-			freeVertChunkIdx = (*freeVertIter);
+			size += iterNext->second;
+
+			rangesBySize.erase(std::make_pair(iterNext->second, iterNext->first));
+			rangesByStart.erase(iterNext);
 		}
 
-		mFreeVertChunks.erase(freeVertIter);
+		rangesByStart[start] = size;
+		rangesBySize.insert(std::make_pair(size, start));
+	}
 
-		auto freeIdxIter = mFreeIdxChunks.begin();
-		freeIdxChunkIdx = (*freeIdxIter);
-		for (UINT32 i = 0; i < smallestIdxFitIdx; i++)
-		{
-			freeIdxIter++;
-			freeIdxChunkIdx = (*freeIdxIter);
-		}
+	MeshHeap::MeshHeap(UINT32 numVertices, UINT32 numIndices,
+		const SPtr<VertexDataDesc>& vertexDesc, IndexType indexType, GpuDeviceFlags deviceMask)
+		: mNumVertices(numVertices), mNumIndices(numIndices), mVertexDesc(vertexDesc), mIndexType(indexType)
+		, mDeviceMask(deviceMask), mNextFenceId(1), mLastCompletedFence(0), mUsedSinceFence(false)
+	{ }
 
-		mFreeIdxChunks.erase(freeIdxIter);
+	MeshHeap::~MeshHeap()
+	{
+		THROW_IF_NOT_CORE_THREAD;
 
-		ChunkData& vertChunk = mVertChunks[freeVertChunkIdx];
-		ChunkData& idxChunk = mIdxChunks[freeIdxChunkIdx];
+		mPages.clear();
+		mVertexDesc = nullptr;
+	}
 
-		UINT32 vertChunkStart = vertChunk.start;
-		UINT32 idxChunkStart = idxChunk.start;
+	void MeshHeap::initialize()
+	{
+		THROW_IF_NOT_CORE_THREAD;
 
-		UINT32 remainingNumVerts = vertChunk.size - meshData->getNumVertices();
-		UINT32 remainingNumIdx = idxChunk.size - meshData->getNumIndices();
+		addPage(mNumVertices, mNumIndices);
 
-		vertChunk.size = meshData->getNumVertices();
-		idxChunk.size = meshData->getNumIndices();
+		CoreObject::initialize();
+	}
 
-		if (remainingNumVerts > 0)
+	void MeshHeap::alloc(SPtr<TransientMesh> mesh, const SPtr<MeshData>& meshData)
+	{
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numIndices = meshData->getNumIndices();
+
+		// Find a page with enough space for both vertices and indices, or add a new one if none has it
+		UINT32 pageIdx = 0;
+		UINT32 vertexStart = 0;
+		UINT32 indexStart = 0;
+		for (; pageIdx < (UINT32)mPages.size(); pageIdx++)
 		{
-			if (!mEmptyVertChunks.empty())
-			{
-				UINT32 emptyChunkIdx = mEmptyVertChunks.top();
-				ChunkData& emptyChunk = mVertChunks[emptyChunkIdx];
-				mEmptyVertChunks.pop();
+			Page& page = mPages[pageIdx];
+			if (!page.freeVertices.alloc(numVertices, vertexStart))
+				continue;
 
-				emptyChunk.start = vertChunkStart + meshData->getNumVertices();
-				emptyChunk.size = remainingNumVerts;
-			}
-			else
-			{
-				ChunkData newChunk;
-				newChunk.size = remainingNumVerts;
-				newChunk.start = vertChunkStart + meshData->getNumVertices();
+			if (page.freeIndices.alloc(numIndices, indexStart))
+				break;
 
-				mVertChunks.push_back(newChunk);
-				mFreeVertChunks.push_back((UINT32)(mVertChunks.size() - 1));
-			}
+			page.freeVertices.free(vertexStart, numVertices);
 		}
 
-		if (remainingNumIdx > 0)
+		if (pageIdx == (UINT32)mPages.size())
 		{
-			if (!mEmptyIdxChunks.empty())
-			{
-				UINT32 emptyChunkIdx = mEmptyIdxChunks.top();
-				ChunkData& emptyChunk = mIdxChunks[emptyChunkIdx];
-				mEmptyIdxChunks.pop();
+			UINT32 newNumVertices = std::max(numVertices, (UINT32)Math::roundToInt(mNumVertices * GrowPercent));
+			UINT32 newNumIndices = std::max(numIndices, (UINT32)Math::roundToInt(mNumIndices * GrowPercent));
 
-				emptyChunk.start = idxChunkStart + meshData->getNumIndices();
-				emptyChunk.size = remainingNumIdx;
-			}
-			else
-			{
-				ChunkData newChunk;
-				newChunk.size = remainingNumIdx;
-				newChunk.start = idxChunkStart + meshData->getNumIndices();
+			addPage(newNumVertices, newNumIndices);
 
-				mIdxChunks.push_back(newChunk);
-				mFreeIdxChunks.push_back((UINT32)(mIdxChunks.size() - 1));
-			}
+			Page& page = mPages.back();
+			page.freeVertices.alloc(numVertices, vertexStart);
+			page.freeIndices.alloc(numIndices, indexStart);
 		}
 
+		const Page& page = mPages[pageIdx];
+
 		AllocatedData newAllocData;
-		newAllocData.vertChunkIdx = freeVertChunkIdx;
-		newAllocData.idxChunkIdx = freeIdxChunkIdx;
-		newAllocData.useFlags = UseFlags::GPUFree;
-		newAllocData.eventQueryIdx = createEventQuery();
+		newAllocData.page = pageIdx;
+		newAllocData.vertexStart = vertexStart;
+		newAllocData.numVertices = numVertices;
+		newAllocData.indexStart = indexStart;
+		newAllocData.numIndices = numIndices;
+		newAllocData.lastUsedFence = 0;
 		newAllocData.mesh = mesh;
 
 		mMeshAllocData[mesh->getMeshHeapId()] = newAllocData;
 
 		// Actually copy data
+		bool flipColors = RenderAPI::instance().getAPIInfo().isFlagSet(RenderAPIFeatureFlag::VertexColorFlip);
 		for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
 		{
 			if (!mVertexDesc->hasStream(i))
@@ -282,7 +252,7 @@ namespace bs
 				continue;
 
 			// Ensure vertex sizes match
-			UINT32 vertSize = mVertexData->vertexDeclaration->getProperties().getVertexSize(i);
+			UINT32 vertSize = page.vertexData->vertexDeclaration->getProperties().getVertexSize(i);
 			UINT32 otherVertSize = meshData->getVertexDesc()->getVertexStride(i);
 			if (otherVertSize != vertSize)
 			{
@@ -290,21 +260,26 @@ namespace bs
 					toString(vertSize) + ". Got: " + toString(otherVertSize));
 			}
 
-			SPtr<VertexBuffer> vertexBuffer = mVertexData->getBuffer(i);
+			SPtr<VertexBuffer> vertexBuffer = page.vertexData->getBuffer(i);
 
-			UINT8* vertDest = mCPUVertexData[i] + vertChunkStart * vertSize;
-			memcpy(vertDest, meshData->getStreamData(i), meshData->getNumVertices() * vertSize);
+			UINT32 dataSize = numVertices * vertSize;
+			UINT8* vertSrc = meshData->getStreamData(i);
 
-			if (RenderAPI::instance().getAPIInfo().isFlagSet(RenderAPIFeatureFlag::VertexColorFlip))
+			if (flipColors)
 			{
+				// Mesh data must not be modified, so colors are flipped in a copy
+				mScratchData.resize(std::max((UINT32)mScratchData.size(), dataSize));
+				memcpy(mScratchData.data(), vertSrc, dataSize);
+				vertSrc = mScratchData.data();
+
 				UINT32 vertexStride = mVertexDesc->getVertexStride(i);
 				for (INT32 semanticIdx = 0; semanticIdx < bs::VertexBuffer::MAX_SEMANTIC_IDX; semanticIdx++)
 				{
 					if (!mVertexDesc->hasElement(VES_COLOR, semanticIdx, i))
 						continue;
 
-					UINT8* colorData = vertDest + mVertexDesc->getElementOffsetFromStream(VES_COLOR, semanticIdx, i);
-					for (UINT32 j = 0; j < meshData->getNumVertices(); j++)
+					UINT8* colorData = vertSrc + mVertexDesc->getElementOffsetFromStream(VES_COLOR, semanticIdx, i);
+					for (UINT32 j = 0; j < numVertices; j++)
 					{
 						UINT32* curColor = (UINT32*)colorData;
 
@@ -315,10 +290,10 @@ namespace bs
 				}
 			}
 
-			vertexBuffer->writeData(vertChunkStart * vertSize, meshData->getNumVertices() * vertSize, vertDest, BTW_NO_OVERWRITE);
+			vertexBuffer->writeData(vertexStart * vertSize, dataSize, vertSrc, BTW_NO_OVERWRITE);
 		}
 
-		const IndexBufferProperties& ibProps = mIndexBuffer->getProperties();
+		const IndexBufferProperties& ibProps = page.indexBuffer->getProperties();
 
 		UINT32 idxSize = ibProps.getIndexSize();
 
@@ -329,9 +304,8 @@ namespace bs
 				toString(idxSize) + ". Got: " + toString(meshData->getIndexElementSize()));
 		}
 
-		UINT8* idxDest = mCPUIndexData + idxChunkStart * idxSize;
-		memcpy(idxDest, meshData->getIndexData(), meshData->getNumIndices() * idxSize);
-		mIndexBuffer->writeData(idxChunkStart * idxSize, meshData->getNumIndices() * idxSize, idxDest, BTW_NO_OVERWRITE);
+		page.indexBuffer->writeData(indexStart * idxSize, numIndices * idxSize, meshData->getIndexData(),
+			BTW_NO_OVERWRITE);
 	}
 
 	void MeshHeap::dealloc(SPtr<TransientMesh> mesh)
@@ -339,223 +313,102 @@ namespace bs
 		auto findIter = mMeshAllocData.find(mesh->getMeshHeapId());
 		assert(findIter != mMeshAllocData.end());
 
+		// If the GPU could still be using the mesh, wait until its fence is reached
 		AllocatedData& allocData = findIter->second;
-		if (allocData.useFlags == UseFlags::GPUFree)
+		if (allocData.lastUsedFence > mLastCompletedFence)
 		{
-			allocData.useFlags = UseFlags::Free;
-			freeEventQuery(allocData.eventQueryIdx);
-
-			mFreeVertChunks.push_back(allocData.vertChunkIdx);
-			mFreeIdxChunks.push_back(allocData.idxChunkIdx);
-
-			mergeWithNearbyChunks(allocData.vertChunkIdx, allocData.idxChunkIdx);
-
-			mMeshAllocData.erase(findIter);
+			mPendingFrees.push_back(findIter->first);
+			return;
 		}
-		else if (allocData.useFlags == UseFlags::Used)
-			allocData.useFlags = UseFlags::CPUFree;
+
+		release(allocData);
+		mMeshAllocData.erase(findIter);
 	}
 
-	void MeshHeap::growVertexBuffer(UINT32 numVertices)
+	void MeshHeap::addPage(UINT32 numVertices, UINT32 numIndices)
 	{
-		mNumVertices = numVertices;
-		mVertexData = SPtr<VertexData>(bs_new<VertexData>());
+		Page page;
+		page.vertexData = bs_shared_ptr_new<VertexData>();
+		page.vertexData->vertexCount = numVertices;
+		page.vertexData->vertexDeclaration = VertexDeclaration::create(mVertexDesc, mDeviceMask);
 
-		mVertexData->vertexCount = mNumVertices;
-		mVertexData->vertexDeclaration = VertexDeclaration::create(mVertexDesc, mDeviceMask);
-
-		// Create buffers and copy data
 		for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
 		{
 			if (!mVertexDesc->hasStream(i))
 				continue;
 
-			UINT32 vertSize = mVertexData->vertexDeclaration->getProperties().getVertexSize(i);
-
 			VERTEX_BUFFER_DESC desc;
-			desc.vertexSize = vertSize;
-			desc.numVerts = mVertexData->vertexCount;
+			desc.vertexSize = page.vertexData->vertexDeclaration->getProperties().getVertexSize(i);
+			desc.numVerts = numVertices;
 			desc.usage = GBU_DYNAMIC;
 
-			SPtr<VertexBuffer> vertexBuffer = VertexBuffer::create(desc, mDeviceMask);
-			mVertexData->setBuffer(i, vertexBuffer);
-
-			// Copy all data to the new buffer
-			UINT8* oldBuffer = mCPUVertexData[i];
-			UINT8* buffer = (UINT8*)bs_alloc(vertSize * numVertices);
-
-			UINT32 destOffset = 0;
-			if (oldBuffer != nullptr)
-			{
-				for (auto& allocData : mMeshAllocData)
-				{
-					ChunkData& oldChunk = mVertChunks[allocData.second.vertChunkIdx];
-
-					UINT8* oldData = oldBuffer + oldChunk.start * vertSize;
-					memcpy(buffer + destOffset * vertSize, oldData, oldChunk.size * vertSize);
-
-					destOffset += oldChunk.size;
-				}
-
-				bs_free(oldBuffer);
-			}
-
-			if (destOffset > 0)
-				vertexBuffer->writeData(0, destOffset * vertSize, buffer, BTW_NO_OVERWRITE);
-
-			mCPUVertexData[i] = buffer;
+			page.vertexData->setBuffer(i, VertexBuffer::create(desc, mDeviceMask));
 		}
 
-		// Reorder chunks
-		UINT32 destOffset = 0;
-		Vector<ChunkData> newVertChunks;
-		List<UINT32> freeVertChunks;
-
-		for (auto& allocData : mMeshAllocData)
-		{
-			ChunkData& oldChunk = mVertChunks[allocData.second.vertChunkIdx];
-
-			ChunkData newChunk;
-			newChunk.start = destOffset;
-			newChunk.size = oldChunk.size;
-
-			allocData.second.vertChunkIdx = (UINT32)newVertChunks.size();
-			newVertChunks.push_back(newChunk);
-
-			destOffset += oldChunk.size;
-		}
-
-		// Add free chunk
-		if (destOffset != mNumVertices)
-		{
-			ChunkData newChunk;
-			newChunk.start = destOffset;
-			newChunk.size = mNumVertices - destOffset;
-
-			newVertChunks.push_back(newChunk);
-			freeVertChunks.push_back((UINT32)(newVertChunks.size() - 1));
-		}
-
-		mVertChunks = newVertChunks;
-		mFreeVertChunks = freeVertChunks;
-
-		while (!mEmptyVertChunks.empty())
-			mEmptyVertChunks.pop();
-	}
-
-	void MeshHeap::growIndexBuffer(UINT32 numIndices)
-	{
-		mNumIndices = numIndices;
-
 		INDEX_BUFFER_DESC ibDesc;
 		ibDesc.indexType = mIndexType;
-		ibDesc.numIndices = mNumIndices;
+		ibDesc.numIndices = numIndices;
 		ibDesc.usage = GBU_DYNAMIC;
 
-		mIndexBuffer = IndexBuffer::create(ibDesc, mDeviceMask);
-
-		const IndexBufferProperties& ibProps = mIndexBuffer->getProperties();
+		page.indexBuffer = IndexBuffer::create(ibDesc, mDeviceMask);
 
-		// Copy all data to the new buffer
-		UINT32 idxSize = ibProps.getIndexSize();
+		page.freeVertices.init(numVertices);
+		page.freeIndices.init(numIndices);
 
-		UINT8* oldBuffer = mCPUIndexData;
-		UINT8* buffer = (UINT8*)bs_alloc(idxSize * numIndices);
+		mPages.push_back(page);
 
-		UINT32 destOffset = 0;
-		if (oldBuffer != nullptr)
-		{
-			for (auto& allocData : mMeshAllocData)
-			{
-				ChunkData& oldChunk = mIdxChunks[allocData.second.idxChunkIdx];
-
-				UINT8* oldData = oldBuffer + oldChunk.start * idxSize;
-				memcpy(buffer + destOffset * idxSize, oldData, oldChunk.size * idxSize);
-
-				destOffset += oldChunk.size;
-			}
-
-			bs_free(oldBuffer);
-		}
-
-		if (destOffset > 0)
-			mIndexBuffer->writeData(0, destOffset * idxSize, buffer, BTW_NO_OVERWRITE);
+		mNumVertices = numVertices;
+		mNumIndices = numIndices;
+	}
 
-		mCPUIndexData = buffer;
+	void MeshHeap::release(const AllocatedData& allocData)
+	{
+		Page& page = mPages[allocData.page];
+		page.freeVertices.free(allocData.vertexStart, allocData.numVertices);
+		page.freeIndices.free(allocData.indexStart, allocData.numIndices);
+	}
 
-		// Reorder chunks
-		destOffset = 0;
-		Vector<ChunkData> newIdxChunks;
-		List<UINT32> freeIdxChunks;
+	void MeshHeap::insertFence()
+	{
+		if (!mUsedSinceFence)
+			return;
 
-		for (auto& allocData : mMeshAllocData)
+		SPtr<EventQuery> query;
+		if (!mFreeQueries.empty())
 		{
-			ChunkData& oldChunk = mIdxChunks[allocData.second.idxChunkIdx];
-
-			ChunkData newChunk;
-			newChunk.start = destOffset;
-			newChunk.size = oldChunk.size;
-
-			allocData.second.idxChunkIdx = (UINT32)newIdxChunks.size();
-			newIdxChunks.push_back(newChunk);
-
-			destOffset += oldChunk.size;
+			query = mFreeQueries.back();
+			mFreeQueries.pop_back();
 		}
+		else
+			query = EventQuery::create();
 
-		// Add free chunk
-		if (destOffset != mNumIndices)
-		{
-			ChunkData newChunk;
-			newChunk.start = destOffset;
-			newChunk.size = mNumIndices - destOffset;
+		SPtr<MeshHeap> thisPtr = std::static_pointer_cast<MeshHeap>(getThisPtr());
 
-			newIdxChunks.push_back(newChunk);
-			freeIdxChunks.push_back((UINT32)(newIdxChunks.size() - 1));
-		}
+		FenceData fence;
+		fence.query = query;
+		fence.fenceId = mNextFenceId++;
 
-		mIdxChunks = newIdxChunks;
-		mFreeIdxChunks = freeIdxChunks;
+		query->onTriggered.connect(std::bind(&MeshHeap::fenceTriggered, thisPtr, fence.fenceId));
+		query->begin();
 
-		while (!mEmptyIdxChunks.empty())
-			mEmptyIdxChunks.pop();
+		mActiveFences.push_back(fence);
+		mUsedSinceFence = false;
 	}
 
-	UINT32 MeshHeap::createEventQuery()
+	SPtr<VertexData> MeshHeap::getVertexData(UINT32 meshId) const
 	{
-		UINT32 idx = 0;
-		if (mFreeEventQueries.size() > 0)
-		{
-			idx = mFreeEventQueries.top();
-			mFreeEventQueries.pop();
-		}
-		else
-		{
-			QueryData newQuery;
-			newQuery.query = EventQuery::create();
-			newQuery.queryId = 0;
-
-			mEventQueries.push_back(newQuery);
-			idx = (UINT32)(mEventQueries.size() - 1);
-		}
-
-		return idx;
-	}
+		auto findIter = mMeshAllocData.find(meshId);
+		assert(findIter != mMeshAllocData.end());
 
-	void MeshHeap::freeEventQuery(UINT32 idx)
-	{
-		mEventQueries[idx].query->onTriggered.clear();
-		mEventQueries[idx].queryId = 0;
-		mFreeEventQueries.push(idx);
+		return mPages[findIter->second.page].vertexData;
 	}
 
-	SPtr<VertexData> MeshHeap::getVertexData() const
+	SPtr<IndexBuffer> MeshHeap::getIndexBuffer(UINT32 meshId) const
 	{
-		return mVertexData;
-	}
+		auto findIter = mMeshAllocData.find(meshId);
+		assert(findIter != mMeshAllocData.end());
 
-	SPtr<IndexBuffer> MeshHeap::getIndexBuffer() const
-	{
-		return mIndexBuffer;
+		return mPages[findIter->second.page].indexBuffer;
 	}
 
 	SPtr<VertexDataDesc> MeshHeap::getVertexDesc() const
@@ -568,8 +421,7 @@ namespace bs
 		auto findIter = mMeshAllocData.find(meshId);
 		assert(findIter != mMeshAllocData.end());
 
-		UINT32 chunkIdx = findIter->second.vertChunkIdx;
-		return mVertChunks[chunkIdx].start;
+		return findIter->second.vertexStart;
 	}
 
 	UINT32 MeshHeap::getIndexOffset(UINT32 meshId) const
@@ -577,8 +429,7 @@ namespace bs
 		auto findIter = mMeshAllocData.find(meshId);
 		assert(findIter != mMeshAllocData.end());
 
-		UINT32 chunkIdx = findIter->second.idxChunkIdx;
-		return mIdxChunks[chunkIdx].start;
+		return findIter->second.indexStart;
 	}
 
 	void MeshHeap::notifyUsedOnGPU(UINT32 meshId)
@@ -586,127 +437,48 @@ namespace bs
 		auto findIter = mMeshAllocData.find(meshId);
 		assert(findIter != mMeshAllocData.end());
 
-		AllocatedData& allocData = findIter->second;
-		assert(allocData.useFlags != UseFlags::Free);
-
-		if (allocData.useFlags == UseFlags::GPUFree)
-			allocData.useFlags = UseFlags::Used;
-
-		SPtr<MeshHeap> thisPtr = std::static_pointer_cast<MeshHeap>(getThisPtr());
-
-		QueryData& queryData = mEventQueries[allocData.eventQueryIdx];
-		queryData.queryId = mNextQueryId++;
-		queryData.query->onTriggered.clear();
-		queryData.query->onTriggered.connect(std::bind(&MeshHeap::queryTriggered, thisPtr, meshId, queryData.queryId));
-		queryData.query->begin();
+		// Mesh will be considered in use until the next issued fence is reached
+		findIter->second.lastUsedFence = mNextFenceId;
+		mUsedSinceFence = true;
 	}
 
 	// Note: Need to use a shared ptr here to ensure MeshHeap doesn't get deallocated sometime during this callback
-	void MeshHeap::queryTriggered(SPtr<MeshHeap> thisPtr, UINT32 meshId, UINT32 queryId)
+	void MeshHeap::fenceTriggered(SPtr<MeshHeap> thisPtr, UINT32 fenceId)
 	{
-		auto findIter = thisPtr->mMeshAllocData.find(meshId);
-		assert(findIter != thisPtr->mMeshAllocData.end());
+		thisPtr->mLastCompletedFence = std::max(thisPtr->mLastCompletedFence, fenceId);
 
-		AllocatedData& allocData = findIter->second;
-
-		// If query ids don't match then it means there either a more recent query or
-		// the buffer was discarded and we are not interested in query result
-		QueryData& queryData = thisPtr->mEventQueries[allocData.eventQueryIdx];
-		if (queryId == queryData.queryId)
+		// Return the query to the pool
+		auto& activeFences = thisPtr->mActiveFences;
+		for (auto iter = activeFences.begin(); iter != activeFences.end(); ++iter)
 		{
-			assert(allocData.useFlags != UseFlags::Free && allocData.useFlags != UseFlags::GPUFree);
-
-			if (allocData.useFlags == UseFlags::CPUFree)
-			{
-				allocData.useFlags = UseFlags::Free;
-				thisPtr->freeEventQuery(allocData.eventQueryIdx);
-
-				thisPtr->mFreeVertChunks.push_back(allocData.vertChunkIdx);
-				thisPtr->mFreeIdxChunks.push_back(allocData.idxChunkIdx);
-
-				thisPtr->mergeWithNearbyChunks(allocData.vertChunkIdx, allocData.idxChunkIdx);
-
-				thisPtr->mMeshAllocData.erase(findIter);
-			}
-			else
-				allocData.useFlags = UseFlags::GPUFree;
-		}
-
-		queryData.query->onTriggered.clear();
-	}
-
-	void MeshHeap::mergeWithNearbyChunks(UINT32 chunkVertIdx, UINT32 chunkIdxIdx)
-	{
-		// Merge vertex chunks
-		ChunkData& vertChunk = mVertChunks[chunkVertIdx];
-		for (auto& freeChunkIdx : mFreeVertChunks)
-		{
-			if (chunkVertIdx == freeChunkIdx)
-				continue;
-
-			ChunkData& curChunk = mVertChunks[freeChunkIdx];
-			if (curChunk.size == 0) // Already merged
+			if (iter->fenceId != fenceId)
 				continue;
 
-			bool merged = false;
-			if (curChunk.start == (vertChunk.start + vertChunk.size))
-			{
-				vertChunk.size += curChunk.size;
-
-				merged = true;
-			}
-			else if ((curChunk.start + curChunk.size) == vertChunk.start)
-			{
-				vertChunk.start = curChunk.start;
-				vertChunk.size += curChunk.size;
-
-				merged = true;
-			}
+			iter->query->onTriggered.clear();
+			thisPtr->mFreeQueries.push_back(iter->query);
 
-			if (merged)
-			{
-				// We can't remove the chunk since that would break the indexing scheme, so 
-				// mark it as empty and set size to 0. It will be reused when needed.
-				curChunk.start = 0;
-				curChunk.size = 0;
-				mEmptyVertChunks.push(freeChunkIdx);
-			}
+			activeFences.erase(iter);
+			break;
 		}
 
-		// Merge index chunks
-		ChunkData& idxChunk = mIdxChunks[chunkIdxIdx];
-		for (auto& freeChunkIdx : mFreeIdxChunks)
+		// Release meshes the GPU is done with
+		auto& pendingFrees = thisPtr->mPendingFrees;
+		for (UINT32 i = 0; i < (UINT32)pendingFrees.size();)
 		{
-			if (chunkIdxIdx == freeChunkIdx)
-				continue;
-
-			ChunkData& curChunk = mIdxChunks[freeChunkIdx];
-			if (curChunk.size == 0) // Already merged
-				continue;
+			auto findIter = thisPtr->mMeshAllocData.find(pendingFrees[i]);
+			assert(findIter != thisPtr->mMeshAllocData.end());
 
-			bool merged = false;
-			if (curChunk.start == (idxChunk.start + idxChunk.size))
+			if (findIter->second.lastUsedFence > thisPtr->mLastCompletedFence)
 			{
-				idxChunk.size += curChunk.size;
-
-				merged = true;
+				i++;
+				continue;
 			}
-			else if ((curChunk.start + curChunk.size) == idxChunk.start)
-			{
-				idxChunk.start = curChunk.start;
-				idxChunk.size += curChunk.size;
 
-				merged = true;
-			}
+			thisPtr->release(findIter->second);
+			thisPtr->mMeshAllocData.erase(findIter);
 
-			if (merged)
-			{
-				// We can't remove the chunk since that would break the indexing scheme, so 
-				// mark it as empty and set size to 0. It will be reused when needed.
-				curChunk.start = 0;
-				curChunk.size = 0;
-				mEmptyIdxChunks.push(freeChunkIdx);
-			}
+			pendingFrees[i] = pendingFrees.back();
+			pendingFrees.pop_back();
 		}
 	}
 	}
@@ -28,7 +28,8 @@ namespace bs
 	MeshImportOptions::MeshImportOptions()
 		: mCPUCached(false), mImportNormals(true), mImportTangents(true), mImportBlendShapes(false), mImportSkin(false)
 		, mImportAnimation(false), mReduceKeyFrames(true), mImportRootMotion(false), mImportScale(1.0f)
-		, mCollisionMeshType(CollisionMeshType::None)
+		, mCollisionMeshType(CollisionMeshType::None), mNumLODs(0), mLODReduction(0.5f)
+		, mOptimizeVertexOrder(true), mOptimizeOverdraw(false)
 	{ }
 
 	SPtr<MeshImportOptions> MeshImportOptions::create()
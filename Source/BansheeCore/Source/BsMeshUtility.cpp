@@ -724,6 +724,124 @@ namespace bs
 		bs_frame_clear();
 	}
 
+	/** 
+	 * Symmetric 4x4 matrix used for evaluating the sum of squared distances from a point to a set of planes. Only the
+	 * upper triangle of the matrix is stored.
+	 */
+	struct Quadric
+	{
+		Quadric()
+		{
+			memset(m, 0, sizeof(m));
+		}
+
+		/** Creates a quadric for the plane with the provided normal and distance, scaled by @p weight. */
+		Quadric(const Vector3& normal, float d, float weight)
+		{
+			double a = normal.x;
+			double b = normal.y;
+			double c = normal.z;
+
+			m[0] = a * a * weight; m[1] = a * b * weight; m[2] = a * c * weight; m[3] = a * d * weight;
+			m[4] = b * b * weight; m[5] = b * c * weight; m[6] = b * d * weight;
+			m[7] = c * c * weight; m[8] = c * d * weight;
+			m[9] = (double)d * d * weight;
+		}
+
+		Quadric& operator+= (const Quadric& rhs)
+		{
+			for (UINT32 i = 0; i < 10; i++)
+				m[i] += rhs.m[i];
+
+			return *this;
+		}
+
+		/** Returns the sum of squared distances from the provided point to the planes in the quadric. */
+		double evaluate(const Vector3& point) const
+		{
+			double x = point.x;
+			double y = point.y;
+			double z = point.z;
+
+			return m[0] * x * x + 2.0 * m[1] * x * y + 2.0 * m[2] * x * z + 2.0 * m[3] * x +
+				m[4] * y * y + 2.0 * m[5] * y * z + 2.0 * m[6] * y +
+				m[7] * z * z + 2.0 * m[8] * z + m[9];
+		}
+
+		double m[10];
+	};
+
+	/** 
+	 * Simulates a FIFO post-transform vertex cache. Uses per-vertex timestamps instead of an explicit queue, where a
+	 * vertex is considered cached if fewer than cache size misses occurred since it was last added.
+	 */
+	struct VertexCacheSimulator
+	{
+		VertexCacheSimulator(UINT32 numVertices, UINT32 cacheSize)
+			:timestamps(numVertices, 0), time(cacheSize + 1), cacheSize(cacheSize)
+		{ }
+
+		/** Returns true if the vertex is in the cache. */
+		bool isCached(UINT32 vertexIdx) const
+		{
+			return time - timestamps[vertexIdx] <= cacheSize;
+		}
+
+		/** Returns the number of misses since the vertex was last added to the cache. */
+		UINT32 getAge(UINT32 vertexIdx) const
+		{
+			return time - timestamps[vertexIdx];
+		}
+
+		/** References a vertex, adding it to the cache if not present. Returns true on a cache miss. */
+		bool reference(UINT32 vertexIdx)
+		{
+			if (isCached(vertexIdx))
+				return false;
+
+			timestamps[vertexIdx] = time++;
+			return true;
+		}
+
+		/** Evicts all vertices from the cache. */
+		void clear()
+		{
+			time += cacheSize + 1;
+		}
+
+		Vector<UINT32> timestamps;
+		UINT32 time;
+		UINT32 cacheSize;
+	};
+
+	/** Reads indices of the provided size into a 32-bit index array. */
+	static void readIndices(UINT8* indices, UINT32 numIndices, UINT32 indexSize, Vector<UINT32>& output)
+	{
+		output.resize(numIndices);
+		for (UINT32 i = 0; i < numIndices; i++)
+		{
+			UINT32 index = 0;
+			memcpy(&index, indices + i * indexSize, indexSize);
+
+			output[i] = index;
+		}
+	}
+
+	/** Writes indices from a 32-bit index array into an array of indices of the provided size. */
+	static void writeIndices(const Vector<UINT32>& input, UINT8* indices, UINT32 indexSize)
+	{
+		for (UINT32 i = 0; i < (UINT32)input.size(); i++)
+			memcpy(indices + i * indexSize, &input[i], indexSize);
+	}
+
+	/** Collapse of the edge between two vertices, moving vertex @p from onto vertex @p to. */
+	struct EdgeCollapse
+	{
+		UINT32 from;
+		UINT32 to;
+		double cost;
+	};
+
 	void MeshUtility::calculateNormals(Vector3* vertices, UINT8* indices, UINT32 numVertices,
 		UINT32 numIndices, Vector3* normals, UINT32 indexSize)
 	{
@@ -945,4 +1063,454 @@ namespace bs
 			ptr += stride;
 		}
 	}
+
+	void MeshUtility::simplify(Vector3* vertices, UINT8* indices, UINT32 numVertices, UINT32 numIndices, 
+		UINT32 targetNumIndices, Vector<UINT32>& output, UINT32 indexSize)
+	{
+		readIndices(indices, numIndices, indexSize, output);
+
+		// Accumulate planes of all triangles using a vertex, weighted by triangle area
+		Vector<Quadric> quadrics(numVertices);
+		for (UINT32 i = 0; i < numIndices; i += 3)
+		{
+			const Vector3& a = vertices[output[i + 0]];
+			const Vector3& b = vertices[output[i + 1]];
+			const Vector3& c = vertices[output[i + 2]];
+
+			Vector3 normal = Vector3::cross(b - a, c - a);
+			float length = normal.length();
+			if (length == 0.0f)
+				continue;
+
+			normal /= length;
+			Quadric quadric(normal, -normal.dot(a), length * 0.5f);
+
+			for (UINT32 j = 0; j < 3; j++)
+				quadrics[output[i + j]] += quadric;
+		}
+
+		// Lock vertices on borders, seams and non-manifold edges
+		UnorderedMap<UINT64, UINT32> edgeUseCounts;
+		for (UINT32 i = 0; i < numIndices; i += 3)
+		{
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				UINT32 v0 = output[i + j];
+				UINT32 v1 = output[i + (j + 1) % 3];
+
+				UINT64 key = ((UINT64)std::min(v0, v1) << 32) | std::max(v0, v1);
+				edgeUseCounts[key]++;
+			}
+		}
+
+		Vector<bool> locked(numVertices, false);
+		for (auto& entry : edgeUseCounts)
+		{
+			if (entry.second == 2)
+				continue;
+
+			locked[(UINT32)(entry.first >> 32)] = true;
+			locked[(UINT32)(entry.first & 0xFFFFFFFF)] = true;
+		}
+
+		Vector<EdgeCollapse> collapses;
+		Vector<UINT32> vertexTriangleOffsets(numVertices + 1);
+		Vector<UINT32> vertexTriangles;
+		Vector<bool> touched(numVertices);
+		Vector<UINT32> remap(numVertices);
+
+		// Collapse edges in multiple passes. Each pass collapses the cheapest edges, while making sure no vertex is
+		// affected by more than one collapse, and then rebuilds the triangle list.
+		while (output.size() > targetNumIndices)
+		{
+			UINT32 numTriangles = (UINT32)output.size() / 3;
+
+			// Build vertex -> triangle adjacency
+			std::fill(vertexTriangleOffsets.begin(), vertexTriangleOffsets.end(), 0);
+			for (auto& index : output)
+				vertexTriangleOffsets[index + 1]++;
+
+			for (UINT32 i = 0; i < numVertices; i++)
+				vertexTriangleOffsets[i + 1] += vertexTriangleOffsets[i];
+
+			vertexTriangles.resize(output.size());
+			Vector<UINT32> writeOffsets(vertexTriangleOffsets.begin(), vertexTriangleOffsets.end() - 1);
+			for (UINT32 i = 0; i < (UINT32)output.size(); i++)
+				vertexTriangles[writeOffsets[output[i]]++] = i / 3;
+
+			// Find the cheapest direction to collapse each edge in. Every interior edge is referenced by two triangles
+			// in opposite winding orders, so only the one with the ascending order is considered.
+			collapses.clear();
+			for (UINT32 i = 0; i < numTriangles; i++)
+			{
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					UINT32 v0 = output[i * 3 + j];
+					UINT32 v1 = output[i * 3 + (j + 1) % 3];
+
+					if (v0 >= v1 || (locked[v0] && locked[v1]))
+						continue;
+
+					Quadric quadric = quadrics[v0];
+					quadric += quadrics[v1];
+
+					EdgeCollapse collapse;
+					collapse.from = v1;
+					collapse.to = v0;
+					collapse.cost = locked[v1] ? std::numeric_limits<double>::max() : quadric.evaluate(vertices[v0]);
+
+					if (!locked[v0])
+					{
+						double cost = quadric.evaluate(vertices[v1]);
+						if (cost < collapse.cost)
+						{
+							collapse.from = v0;
+							collapse.to = v1;
+							collapse.cost = cost;
+						}
+					}
+
+					collapses.push_back(collapse);
+				}
+			}
+
+			std::sort(collapses.begin(), collapses.end(), 
+				[](const EdgeCollapse& a, const EdgeCollapse& b) { return a.cost < b.cost; });
+
+			// Each collapse removes roughly two triangles. Only perform a portion of the cheapest collapses per pass
+			// so that the costs get re-evaluated using the updated quadrics before the more expensive ones are done.
+			UINT32 numTrianglesToRemove = (numTriangles * 3 - targetNumIndices + 2) / 3;
+			UINT32 maxCollapses = std::min((numTrianglesToRemove + 1) / 2, (UINT32)collapses.size() / 3 + 1);
+
+			std::fill(touched.begin(), touched.end(), false);
+			for (UINT32 i = 0; i < numVertices; i++)
+				remap[i] = i;
+
+			UINT32 numCollapses = 0;
+			for (auto& collapse : collapses)
+			{
+				if (numCollapses >= maxCollapses)
+					break;
+
+				if (touched[collapse.from] || touched[collapse.to])
+					continue;
+
+				// Reject collapses that would flip or degenerate any of the remaining triangles
+				bool valid = true;
+				for (UINT32 j = vertexTriangleOffsets[collapse.from]; j < vertexTriangleOffsets[collapse.from + 1]; j++)
+				{
+					UINT32* triangle = &output[vertexTriangles[j] * 3];
+					if (triangle[0] == collapse.to || triangle[1] == collapse.to || triangle[2] == collapse.to)
+						continue;
+
+					Vector3 before[3];
+					Vector3 after[3];
+					for (UINT32 k = 0; k < 3; k++)
+					{
+						before[k] = vertices[triangle[k]];
+						after[k] = triangle[k] == collapse.from ? vertices[collapse.to] : before[k];
+					}
+
+					Vector3 normalBefore = Vector3::cross(before[1] - before[0], before[2] - before[0]);
+					Vector3 normalAfter = Vector3::cross(after[1] - after[0], after[2] - after[0]);
+
+					if (normalBefore.dot(normalAfter) <= 0.0f)
+					{
+						valid = false;
+						break;
+					}
+				}
+
+				if (!valid)
+					continue;
+
+				// Mark the neighborhood of both vertices, since their adjacency information is no longer valid
+				for (auto vertexIdx : { collapse.from, collapse.to })
+				{
+					for (UINT32 j = vertexTriangleOffsets[vertexIdx]; j < vertexTriangleOffsets[vertexIdx + 1]; j++)
+					{
+						UINT32* triangle = &output[vertexTriangles[j] * 3];
+						for (UINT32 k = 0; k < 3; k++)
+							touched[triangle[k]] = true;
+					}
+				}
+
+				remap[collapse.from] = collapse.to;
+				quadrics[collapse.to] += quadrics[collapse.from];
+				numCollapses++;
+			}
+
+			if (numCollapses == 0)
+				break;
+
+			// Apply the collapses and remove the triangles that became degenerate
+			UINT32 numWritten = 0;
+			for (UINT32 i = 0; i < (UINT32)output.size(); i += 3)
+			{
+				UINT32 v0 = remap[output[i + 0]];
+				UINT32 v1 = remap[output[i + 1]];
+				UINT32 v2 = remap[output[i + 2]];
+
+				if (v0 == v1 || v1 == v2 || v0 == v2)
+					continue;
+
+				output[numWritten++] = v0;
+				output[numWritten++] = v1;
+				output[numWritten++] = v2;
+			}
+
+			output.resize(numWritten);
+		}
+	}
+
+	void MeshUtility::optimizeVertexCache(UINT8* indices, UINT32 numVertices, UINT32 numIndices, UINT32 cacheSize, 
+		UINT32 indexSize)
+	{
+		UINT32 numTriangles = numIndices / 3;
+		if (numTriangles == 0)
+			return;
+
+		Vector<UINT32> triangles;
+		readIndices(indices, numTriangles * 3, indexSize, triangles);
+
+		// Build vertex -> triangle adjacency
+		Vector<UINT32> liveTriangles(numVertices, 0);
+		for (auto& index : triangles)
+			liveTriangles[index]++;
+
+		Vector<UINT32> vertexTriangleOffsets(numVertices + 1, 0);
+		for (UINT32 i = 0; i < numVertices; i++)
+			vertexTriangleOffsets[i + 1] = vertexTriangleOffsets[i] + liveTriangles[i];
+
+		Vector<UINT32> vertexTriangles(triangles.size());
+		Vector<UINT32> writeOffsets(vertexTriangleOffsets.begin(), vertexTriangleOffsets.end() - 1);
+		for (UINT32 i = 0; i < (UINT32)triangles.size(); i++)
+			vertexTriangles[writeOffsets[triangles[i]]++] = i / 3;
+
+		VertexCacheSimulator cache(numVertices, cacheSize);
+		Vector<bool> emitted(numTriangles, false);
+		Vector<UINT32> deadEndStack;
+		Vector<UINT32> candidates;
+		Vector<UINT32> output;
+		output.reserve(triangles.size());
+
+		UINT32 cursor = 0;
+		UINT32 fanningVertex = 0;
+		while (fanningVertex != (UINT32)-1)
+		{
+			// Emit all remaining triangles around the current vertex
+			candidates.clear();
+			for (UINT32 i = vertexTriangleOffsets[fanningVertex]; i < vertexTriangleOffsets[fanningVertex + 1]; i++)
+			{
+				UINT32 triangleIdx = vertexTriangles[i];
+				if (emitted[triangleIdx])
+					continue;
+
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					UINT32 vertexIdx = triangles[triangleIdx * 3 + j];
+
+					output.push_back(vertexIdx);
+					deadEndStack.push_back(vertexIdx);
+					candidates.push_back(vertexIdx);
+
+					liveTriangles[vertexIdx]--;
+					cache.reference(vertexIdx);
+				}
+
+				emitted[triangleIdx] = true;
+			}
+
+			// Pick the next vertex to fan around among the ones just emitted, preferring the oldest vertex that will
+			// still be in the cache after its remaining triangles are emitted
+			UINT32 bestVertex = (UINT32)-1;
+			INT32 bestPriority = -1;
+			for (auto& vertexIdx : candidates)
+			{
+				if (liveTriangles[vertexIdx] == 0)
+					continue;
+
+				INT32 priority = 0;
+				if (cache.getAge(vertexIdx) + 2 * liveTriangles[vertexIdx] <= cacheSize)
+					priority = (INT32)cache.getAge(vertexIdx);
+
+				if (priority > bestPriority)
+				{
+					bestVertex = vertexIdx;
+					bestPriority = priority;
+				}
+			}
+
+			// No good candidates, continue from a recently used vertex or otherwise the next vertex in input order
+			if (bestVertex == (UINT32)-1)
+			{
+				while (!deadEndStack.empty())
+				{
+					UINT32 vertexIdx = deadEndStack.back();
+					deadEndStack.pop_back();
+
+					if (liveTriangles[vertexIdx] > 0)
+					{
+						bestVertex = vertexIdx;
+						break;
+					}
+				}
+
+				while (bestVertex == (UINT32)-1 && cursor < numVertices)
+				{
+					if (liveTriangles[cursor] > 0)
+						bestVertex = cursor;
+
+					cursor++;
+				}
+			}
+
+			fanningVertex = bestVertex;
+		}
+
+		writeIndices(output, indices, indexSize);
+	}
+
+	void MeshUtility::optimizeOverdraw(Vector3* vertices, UINT8* indices, UINT32 numVertices, UINT32 numIndices, 
+		float threshold, UINT32 cacheSize, UINT32 indexSize)
+	{
+		UINT32 numTriangles = numIndices / 3;
+		if (numTriangles == 0)
+			return;
+
+		Vector<UINT32> triangles;
+		readIndices(indices, numTriangles * 3, indexSize, triangles);
+
+		float targetACMR = calculateACMR(indices, numVertices, numTriangles * 3, cacheSize, indexSize) * threshold;
+
+		// Split the triangles into clusters. Reordering the clusters means the cache is effectively empty at the start 
+		// of each one, so a cluster is only ended once its own miss ratio drops below the target.
+		struct Cluster
+		{
+			UINT32 start;
+			UINT32 end;
+			float sortKey;
+		};
+
+		Vector<Cluster> clusters;
+		VertexCacheSimulator cache(numVertices, cacheSize);
+
+		UINT32 clusterStart = 0;
+		UINT32 clusterMisses = 0;
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			for (UINT32 j = 0; j < 3; j++)
+				clusterMisses += cache.reference(triangles[i * 3 + j]) ? 1 : 0;
+
+			UINT32 clusterSize = i + 1 - clusterStart;
+			if (clusterMisses <= targetACMR * clusterSize || i == (numTriangles - 1))
+			{
+				clusters.push_back({ clusterStart, i + 1, 0.0f });
+
+				clusterStart = i + 1;
+				clusterMisses = 0;
+				cache.clear();
+			}
+		}
+
+		// Sort clusters so the ones facing away from the mesh center, which are likely to occlude others, come first
+		Vector3 meshCenter = Vector3::ZERO;
+		float meshArea = 0.0f;
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			const Vector3& a = vertices[triangles[i * 3 + 0]];
+			const Vector3& b = vertices[triangles[i * 3 + 1]];
+			const Vector3& c = vertices[triangles[i * 3 + 2]];
+
+			float area = Vector3::cross(b - a, c - a).length();
+			meshCenter += (a + b + c) * (area / 3.0f);
+			meshArea += area;
+		}
+
+		if (meshArea > 0.0f)
+			meshCenter /= meshArea;
+
+		for (auto& cluster : clusters)
+		{
+			Vector3 center = Vector3::ZERO;
+			Vector3 normal = Vector3::ZERO;
+			float area = 0.0f;
+
+			for (UINT32 i = cluster.start; i < cluster.end; i++)
+			{
+				const Vector3& a = vertices[triangles[i * 3 + 0]];
+				const Vector3& b = vertices[triangles[i * 3 + 1]];
+				const Vector3& c = vertices[triangles[i * 3 + 2]];
+
+				Vector3 triNormal = Vector3::cross(b - a, c - a);
+				float triArea = triNormal.length();
+
+				center += (a + b + c) * (triArea / 3.0f);
+				normal += triNormal;
+				area += triArea;
+			}
+
+			if (area > 0.0f)
+				center /= area;
+
+			cluster.sortKey = (center - meshCenter).dot(Vector3::normalize(normal));
+		}
+
+		std::stable_sort(clusters.begin(), clusters.end(), 
+			[](const Cluster& a, const Cluster& b) { return a.sortKey > b.sortKey; });
+
+		Vector<UINT32> output;
+		output.reserve(numTriangles * 3);
+		for (auto& cluster : clusters)
+			output.insert(output.end(), triangles.begin() + cluster.start * 3, triangles.begin() + cluster.end * 3);
+
+		writeIndices(output, indices, indexSize);
+	}
+
+	void MeshUtility::optimizeVertexFetch(UINT8* indices, UINT32 numVertices, UINT32 numIndices, Vector<UINT32>& remap,
+		UINT32 indexSize)
+	{
+		remap.assign(numVertices, (UINT32)-1);
+
+		Vector<UINT32> output;
+		readIndices(indices, numIndices, indexSize, output);
+
+		UINT32 nextVertex = 0;
+		for (auto& index : output)
+		{
+			if (remap[index] == (UINT32)-1)
+				remap[index] = nextVertex++;
+
+			index = remap[index];
+		}
+
+		for (auto& entry : remap)
+		{
+			if (entry == (UINT32)-1)
+				entry = nextVertex++;
+		}
+
+		writeIndices(output, indices, indexSize);
+	}
+
+	float MeshUtility::calculateACMR(UINT8* indices, UINT32 numVertices, UINT32 numIndices, UINT32 cacheSize, 
+		UINT32 indexSize)
+	{
+		UINT32 numTriangles = numIndices / 3;
+		if (numTriangles == 0)
+			return 0.0f;
+
+		VertexCacheSimulator cache(numVertices, cacheSize);
+
+		UINT32 numMisses = 0;
+		for (UINT32 i = 0; i < numTriangles * 3; i++)
+		{
+			UINT32 index = 0;
+			memcpy(&index, indices + i * indexSize, indexSize);
+
+			numMisses += cache.reference(index) ? 1 : 0;
+		}
+
+		return numMisses / (float)numTriangles;
+	}
 }
\ No newline at end of file
@@ -84,9 +84,10 @@ namespace bs
 			+ ((volume.top - getTop())*mRowPitch*elemSize)
 			+ ((volume.front - getFront())*mSlicePitch*elemSize));
 
+		// Returned data references this buffer, so it keeps its pitch
 		rval.mFormat = mFormat;
-		PixelUtil::getPitch(volume.getWidth(), volume.getHeight(), volume.getDepth(), mFormat, rval.mRowPitch,
-							rval.mSlicePitch);
+		rval.mRowPitch = mRowPitch;
+		rval.mSlicePitch = mSlicePitch;
 
 		return rval;
 	}
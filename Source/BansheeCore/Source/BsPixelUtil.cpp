@@ -6,10 +6,32 @@
 #include "BsMath.h"
 #include "BsException.h"
 #include "BsTexture.h"
+#include "BsTaskScheduler.h"
 #include <nvtt.h>
 
+#if BS_SIMD_SSE2
+#include <emmintrin.h>
+#include <immintrin.h>
+
+#if BS_COMPILER == BS_COMPILER_MSVC
+	#include <intrin.h>
+#else
+	#include "cpuid.h"
+#endif
+
+// AVX2 code is compiled regardless of the target architecture, and only executed if the CPU supports it
+#if BS_COMPILER == BS_COMPILER_MSVC
+	#define BS_AVX2_FUNCTION
+#else
+	#define BS_AVX2_FUNCTION __attribute__((target("avx2")))
+#endif
+#endif
+
 namespace bs 
 {
+	/** Set of SIMD instructions used by pixel operations. */
+	static PixelSIMDLevel sSIMDLevel = PixelUtil::_getSupportedSIMDLevel();
+
 	/**
 	 * Performs pixel data resampling using the point filter (nearest neighbor). Does not perform format conversions.
 	 *
@@ -164,6 +186,10 @@ namespace bs
 			UINT64 stepY = ((UINT64)source.getHeight() << 48) / dest.getHeight();
 			UINT64 stepZ = ((UINT64)source.getDepth() << 48) / dest.getDepth();
 
+#if BS_SIMD_SSE2
+			bool useSSE2 = sSIMDLevel >= PixelSIMDLevel::SSE2;
+#endif
+
 			// Contains 16/16 fixed point precision format. Most significant
 			// 16 bits will contain the coordinate in the source image, and the
 			// least significant 16 bits will contain the fractional part of the coordinate
@@ -207,11 +233,22 @@ namespace bs
 						accum[0] += sourceData[offset + 0] * f; accum[1] += sourceData[offset + 1] * f; \
 						accum[2] += sourceData[offset + 2] * f; }
 
+#if BS_SIMD_SSE2
+#define ACCUM4(x,y,z,factor) \
+						{ float f = factor; \
+						UINT32 offset = (x + y*source.getRowPitch() + z*source.getSlicePitch())*numSourceChannels; \
+						if (useSSE2) \
+							accumVec = _mm_add_ps(accumVec, _mm_mul_ps(_mm_loadu_ps(&sourceData[offset]), _mm_set1_ps(f))); \
+						else { \
+							accum[0] += sourceData[offset + 0] * f; accum[1] += sourceData[offset + 1] * f; \
+							accum[2] += sourceData[offset + 2] * f; accum[3] += sourceData[offset + 3] * f; } }
+#else
 #define ACCUM4(x,y,z,factor) \
 						{ float f = factor; \
 						UINT32 offset = (x + y*source.getRowPitch() + z*source.getSlicePitch())*numSourceChannels; \
 						accum[0] += sourceData[offset + 0] * f; accum[1] += sourceData[offset + 1] * f; \
 						accum[2] += sourceData[offset + 2] * f; accum[3] += sourceData[offset + 3] * f; }
+#endif
 
 						if (numSourceChannels == 3 || numDestChannels == 3)
 						{
@@ -229,6 +266,11 @@ namespace bs
 						else 
 						{
 							// RGBA
+#if BS_SIMD_SSE2
+							// All four channels are accumulated at once, in the same order as the scalar path
+							__m128 accumVec = _mm_setzero_ps();
+#endif
+
 							ACCUM4(sampleCoordX1, sampleCoordY1, sampleCoordZ1, (1.0f - sampleWeightX) * (1.0f - sampleWeightY) * (1.0f - sampleWeightZ));
 							ACCUM4(sampleCoordX2, sampleCoordY1, sampleCoordZ1, sampleWeightX		   * (1.0f - sampleWeightY) * (1.0f - sampleWeightZ));
 							ACCUM4(sampleCoordX1, sampleCoordY2, sampleCoordZ1, (1.0f - sampleWeightX) * sampleWeightY			* (1.0f - sampleWeightZ));
@@ -237,6 +279,11 @@ namespace bs
 							ACCUM4(sampleCoordX2, sampleCoordY1, sampleCoordZ2, sampleWeightX		   * (1.0f - sampleWeightY) * sampleWeightZ);
 							ACCUM4(sampleCoordX1, sampleCoordY2, sampleCoordZ2, (1.0f - sampleWeightX) * sampleWeightY			* sampleWeightZ);
 							ACCUM4(sampleCoordX2, sampleCoordY2, sampleCoordZ2, sampleWeightX		   * sampleWeightY			* sampleWeightZ);
+
+#if BS_SIMD_SSE2
+							if (useSSE2)
+								_mm_storeu_ps(accum, accumVec);
+#endif
 						}
 
 						memcpy(destPtr, accum, sizeof(float)*numDestChannels);
@@ -257,6 +304,49 @@ namespace bs
 
 
 
+#if BS_SIMD_SSE2
+	/** Multiplies four pairs of 32-bit integers and returns the low 32 bits of each product. */
+	inline __m128i mulLo32(__m128i a, __m128i b)
+	{
+		__m128i even = _mm_mul_epu32(a, b);
+		__m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+
+		return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+			_mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+	}
+
+	/**
+	 * Bilinearly blends four pixels with four 8-bit channels each, using 12-bit fixed point weights. Returns the same
+	 * result as the per-channel blend in LinearResampler_Byte, as the horizontal and vertical blends are performed
+	 * without any intermediate rounding.
+	 */
+	inline UINT32 blendBilinearByte4(const UINT8* x1y1, const UINT8* x2y1, const UINT8* x1y2, const UINT8* x2y2,
+		UINT32 weightX, UINT32 weightY)
+	{
+		const __m128i zero = _mm_setzero_si128();
+
+		// Interleave channels of the horizontal neighbors so a single multiply-add blends them
+		__m128i top = _mm_unpacklo_epi8(_mm_cvtsi32_si128(*(const INT32*)x1y1), _mm_cvtsi32_si128(*(const INT32*)x2y1));
+		__m128i bottom = _mm_unpacklo_epi8(_mm_cvtsi32_si128(*(const INT32*)x1y2), _mm_cvtsi32_si128(*(const INT32*)x2y2));
+		top = _mm_unpacklo_epi8(top, zero);
+		bottom = _mm_unpacklo_epi8(bottom, zero);
+
+		__m128i weightsX = _mm_set1_epi32((INT32)((weightX << 16) | (0x1000 - weightX)));
+		top = _mm_madd_epi16(top, weightsX);
+		bottom = _mm_madd_epi16(bottom, weightsX);
+
+		__m128i accum = _mm_add_epi32(
+			mulLo32(top, _mm_set1_epi32((INT32)(0x1000 - weightY))),
+			mulLo32(bottom, _mm_set1_epi32((INT32)weightY)));
+
+		// Round up to byte size
+		accum = _mm_srli_epi32(_mm_add_epi32(accum, _mm_set1_epi32(0x800000)), 24);
+		accum = _mm_packus_epi16(_mm_packs_epi32(accum, zero), zero);
+
+		return (UINT32)_mm_cvtsi128_si32(accum);
+	}
+#endif
+
 	// byte linear resampler, does not do any format conversions.
 	// only handles pixel formats that use 1 byte per color channel.
 	// 2D only; punts 3D pixelboxes to default LinearResampler (slow).
@@ -314,6 +404,22 @@ namespace bs
 					UINT32 sampleCoordX1 = temp >> 12;
 					UINT32 sampleCoordX2 = std::min(sampleCoordX1 + 1, (UINT32)source.getRight() - source.getLeft() - 1);
 
+#if BS_SIMD_SSE2
+					if (channels == 4 && sSIMDLevel >= PixelSIMDLevel::SSE2)
+					{
+						UINT32 blended = blendBilinearByte4(
+							&sourceData[(sampleCoordX1 + sampleY1Offset)*channels],
+							&sourceData[(sampleCoordX2 + sampleY1Offset)*channels],
+							&sourceData[(sampleCoordX1 + sampleY2Offset)*channels],
+							&sourceData[(sampleCoordX2 + sampleY2Offset)*channels],
+							sampleWeightX, sampleWeightY);
+
+						memcpy(destPtr, &blended, sizeof(blended));
+						destPtr += channels;
+						continue;
+					}
+#endif
+
 					UINT32 sxfsyf = sampleWeightX*sampleWeightY;
 					for (UINT32 k = 0; k < channels; k++) 
 					{
@@ -895,6 +1001,348 @@ namespace bs
 		return nvtt::WrapMode_Mirror;
 	}
 
+	/** Minimum number of pixels an image must have before its format conversion is split between multiple threads. */
+	static const UINT32 PARALLEL_CONVERSION_MIN_PIXELS = 256 * 256;
+
+#if BS_SIMD_SSE2
+	/** Swaps the first and third byte of each of the four 32-bit pixels in the provided vector. */
+	inline __m128i swapRedBlue(__m128i pixels)
+	{
+		__m128i rb = _mm_and_si128(pixels, _mm_set1_epi32(0x00FF00FF));
+		__m128i ga = _mm_and_si128(pixels, _mm_set1_epi32((INT32)0xFF00FF00));
+
+		return _mm_or_si128(ga, _mm_or_si128(_mm_slli_epi32(rb, 16), _mm_srli_epi32(rb, 16)));
+	}
+
+	/**
+	 * Swaps the red and blue channels of a row of 32-bit pixels, eight pixels at a time. Returns the number of pixels
+	 * processed, leaving the rest to the caller.
+	 */
+	BS_AVX2_FUNCTION UINT32 swapRedBlueRowAVX2(const UINT8* src, UINT8* dst, UINT32 numPixels)
+	{
+		const __m256i swapMask = _mm256_setr_epi8(
+			2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+			2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+		UINT32 i = 0;
+		for (; (i + 8) <= numPixels; i += 8)
+		{
+			__m256i pixels = _mm256_loadu_si256((const __m256i*)(src + i * 4));
+			_mm256_storeu_si256((__m256i*)(dst + i * 4), _mm256_shuffle_epi8(pixels, swapMask));
+		}
+
+		return i;
+	}
+
+	/**
+	 * Converts a row of RGBA or BGRA byte pixels to FLOAT32_RGBA, four pixels at a time. Returns the number of pixels
+	 * processed, leaving the rest to the caller.
+	 */
+	BS_AVX2_FUNCTION UINT32 byteToFloatRowAVX2(const UINT8* src, float* dst, UINT32 numPixels, bool isBGRA)
+	{
+		const __m128i swapMask = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+		const __m256 maxValue = _mm256_set1_ps(255.0f);
+
+		UINT32 i = 0;
+		for (; (i + 4) <= numPixels; i += 4)
+		{
+			__m128i pixels = _mm_loadu_si128((const __m128i*)(src + i * 4));
+			if (isBGRA)
+				pixels = _mm_shuffle_epi8(pixels, swapMask);
+
+			// Widen the channels of two pixels at a time to 32-bit integers
+			__m256 lo = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(pixels));
+			__m256 hi = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(pixels, 8)));
+
+			// Divide rather than multiply by the reciprocal, to match Bitwise::fixedToFloat exactly
+			_mm256_storeu_ps(dst + i * 4, _mm256_div_ps(lo, maxValue));
+			_mm256_storeu_ps(dst + i * 4 + 8, _mm256_div_ps(hi, maxValue));
+		}
+
+		return i;
+	}
+
+	/**
+	 * Converts a row of FLOAT32_RGBA pixels to RGBA or BGRA bytes, eight pixels at a time. Returns the number of pixels
+	 * processed, leaving the rest to the caller.
+	 */
+	BS_AVX2_FUNCTION UINT32 floatToByteRowAVX2(const float* src, UINT8* dst, UINT32 numPixels, bool isBGRA)
+	{
+		const __m256 minValue = _mm256_setzero_ps();
+		const __m256 maxValue = _mm256_set1_ps(255.0f);
+		const __m256 scale = _mm256_set1_ps(256.0f);
+		const __m256i pixelOrder = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+		const __m256i swapMask = _mm256_setr_epi8(
+			2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+			2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+		UINT32 i = 0;
+		for (; (i + 8) <= numPixels; i += 8)
+		{
+			// Same as Bitwise::floatToFixed: scale by 256 and truncate, with values outside [0, 1) clamped
+			__m256i channels[4];
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				__m256 value = _mm256_mul_ps(_mm256_loadu_ps(src + i * 4 + j * 8), scale);
+				channels[j] = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(value, minValue), maxValue));
+			}
+
+			// Packing operates within 128-bit lanes, leaving even pixels in the low and odd pixels in the high lane
+			__m256i pixels = _mm256_packus_epi16(
+				_mm256_packs_epi32(channels[0], channels[1]),
+				_mm256_packs_epi32(channels[2], channels[3]));
+			pixels = _mm256_permutevar8x32_epi32(pixels, pixelOrder);
+
+			if (isBGRA)
+				pixels = _mm256_shuffle_epi8(pixels, swapMask);
+
+			_mm256_storeu_si256((__m256i*)(dst + i * 4), pixels);
+		}
+
+		return i;
+	}
+
+	/**
+	 * Mirrors a row of 32-bit pixels by swapping and reversing blocks of eight pixels from both ends of the row. Returns
+	 * the number of pixels swapped from each end, leaving the middle of the row to the caller.
+	 */
+	BS_AVX2_FUNCTION UINT32 mirrorRowAVX2(UINT8* row, UINT32 width)
+	{
+		const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+
+		UINT32 halfWidth = width / 2;
+		UINT32 x = 0;
+		for (; (x + 8) <= halfWidth; x += 8)
+		{
+			UINT8* left = &row[x * 4];
+			UINT8* right = &row[(width - x - 8) * 4];
+
+			__m256i leftPixels = _mm256_loadu_si256((const __m256i*)left);
+			__m256i rightPixels = _mm256_loadu_si256((const __m256i*)right);
+
+			_mm256_storeu_si256((__m256i*)left, _mm256_permutevar8x32_epi32(rightPixels, reverse));
+			_mm256_storeu_si256((__m256i*)right, _mm256_permutevar8x32_epi32(leftPixels, reverse));
+		}
+
+		return x;
+	}
+#endif
+
+	/** Converts a single row of pixels between two uncompressed formats. */
+	void convertPixelRow(const UINT8* src, PixelFormat srcFormat, UINT8* dst, PixelFormat dstFormat, UINT32 numPixels)
+	{
+		bool isSrcByte4 = srcFormat == PF_R8G8B8A8 || srcFormat == PF_B8G8R8A8;
+		bool isDstByte4 = dstFormat == PF_R8G8B8A8 || dstFormat == PF_B8G8R8A8;
+
+		// Fast paths for the most common conversions, avoiding a format lookup per pixel. They produce the same results
+		// as the generic unpack/pack path below.
+		if (isSrcByte4 && isDstByte4)
+		{
+			// Formats only differ in the order of the red and blue channels
+			UINT32 i = 0;
+#if BS_SIMD_SSE2
+			if (sSIMDLevel >= PixelSIMDLevel::AVX2)
+			{
+				i = swapRedBlueRowAVX2(src, dst, numPixels);
+
+				src += i * 4;
+				dst += i * 4;
+			}
+
+			if (sSIMDLevel >= PixelSIMDLevel::SSE2)
+			{
+				for (; (i + 4) <= numPixels; i += 4)
+				{
+					__m128i pixels = _mm_loadu_si128((const __m128i*)src);
+					_mm_storeu_si128((__m128i*)dst, swapRedBlue(pixels));
+
+					src += 16;
+					dst += 16;
+				}
+			}
+#endif
+
+			for (; i < numPixels; i++)
+			{
+				dst[0] = src[2];
+				dst[1] = src[1];
+				dst[2] = src[0];
+				dst[3] = src[3];
+
+				src += 4;
+				dst += 4;
+			}
+		}
+		else if (isSrcByte4 && dstFormat == PF_FLOAT32_RGBA)
+		{
+			UINT32 rIdx = srcFormat == PF_R8G8B8A8 ? 0 : 2;
+			UINT32 bIdx = 2 - rIdx;
+
+			float* dstFloat = (float*)dst;
+			UINT32 i = 0;
+#if BS_SIMD_SSE2
+			if (sSIMDLevel >= PixelSIMDLevel::AVX2)
+			{
+				i = byteToFloatRowAVX2(src, dstFloat, numPixels, srcFormat == PF_B8G8R8A8);
+
+				src += i * 4;
+				dstFloat += i * 4;
+			}
+
+			if (sSIMDLevel >= PixelSIMDLevel::SSE2)
+			{
+				const __m128i zero = _mm_setzero_si128();
+				const __m128 maxValue = _mm_set1_ps(255.0f);
+
+				for (; (i + 4) <= numPixels; i += 4)
+				{
+					__m128i pixels = _mm_loadu_si128((const __m128i*)src);
+					if (srcFormat == PF_B8G8R8A8)
+						pixels = swapRedBlue(pixels);
+
+					// Widen the channels to 32-bit integers, two pixels per half
+					__m128i lo = _mm_unpacklo_epi8(pixels, zero);
+					__m128i hi = _mm_unpackhi_epi8(pixels, zero);
+
+					// Divide rather than multiply by the reciprocal, to match Bitwise::fixedToFloat exactly
+					_mm_storeu_ps(dstFloat + 0, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), maxValue));
+					_mm_storeu_ps(dstFloat + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), maxValue));
+					_mm_storeu_ps(dstFloat + 8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), maxValue));
+					_mm_storeu_ps(dstFloat + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), maxValue));
+
+					src += 16;
+					dstFloat += 16;
+				}
+			}
+#endif
+
+			for (; i < numPixels; i++)
+			{
+				dstFloat[0] = Bitwise::fixedToFloat(src[rIdx], 8);
+				dstFloat[1] = Bitwise::fixedToFloat(src[1], 8);
+				dstFloat[2] = Bitwise::fixedToFloat(src[bIdx], 8);
+				dstFloat[3] = Bitwise::fixedToFloat(src[3], 8);
+
+				src += 4;
+				dstFloat += 4;
+			}
+		}
+		else if (srcFormat == PF_FLOAT32_RGBA && isDstByte4)
+		{
+			UINT32 rIdx = dstFormat == PF_R8G8B8A8 ? 0 : 2;
+			UINT32 bIdx = 2 - rIdx;
+
+			const float* srcFloat = (const float*)src;
+			UINT32 i = 0;
+#if BS_SIMD_SSE2
+			if (sSIMDLevel >= PixelSIMDLevel::AVX2)
+			{
+				i = floatToByteRowAVX2(srcFloat, dst, numPixels, dstFormat == PF_B8G8R8A8);
+
+				srcFloat += i * 4;
+				dst += i * 4;
+			}
+
+			if (sSIMDLevel >= PixelSIMDLevel::SSE2)
+			{
+				const __m128 minValue = _mm_setzero_ps();
+				const __m128 maxValue = _mm_set1_ps(255.0f);
+				const __m128 scale = _mm_set1_ps(256.0f);
+
+				for (; (i + 4) <= numPixels; i += 4)
+				{
+					// Same as Bitwise::floatToFixed: scale by 256 and truncate, with values outside [0, 1) clamped
+					__m128i channels[4];
+					for (UINT32 j = 0; j < 4; j++)
+					{
+						__m128 value = _mm_mul_ps(_mm_loadu_ps(srcFloat + j * 4), scale);
+						channels[j] = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(value, minValue), maxValue));
+					}
+
+					__m128i pixels = _mm_packus_epi16(
+						_mm_packs_epi32(channels[0], channels[1]),
+						_mm_packs_epi32(channels[2], channels[3]));
+
+					if (dstFormat == PF_B8G8R8A8)
+						pixels = swapRedBlue(pixels);
+
+					_mm_storeu_si128((__m128i*)dst, pixels);
+
+					srcFloat += 16;
+					dst += 16;
+				}
+			}
+#endif
+
+			for (; i < numPixels; i++)
+			{
+				dst[rIdx] = (UINT8)Bitwise::floatToFixed(srcFloat[0], 8);
+				dst[1] = (UINT8)Bitwise::floatToFixed(srcFloat[1], 8);
+				dst[bIdx] = (UINT8)Bitwise::floatToFixed(srcFloat[2], 8);
+				dst[3] = (UINT8)Bitwise::floatToFixed(srcFloat[3], 8);
+
+				srcFloat += 4;
+				dst += 4;
+			}
+		}
+		else if (srcFormat == PF_FLOAT16_R && dstFormat == PF_FLOAT32_R)
+		{
+			const UINT16* srcHalf = (const UINT16*)src;
+			float* dstFloat = (float*)dst;
+
+			for (UINT32 i = 0; i < numPixels; i++)
+				dstFloat[i] = Bitwise::halfToFloat(srcHalf[i]);
+		}
+		else if (srcFormat == PF_FLOAT32_R && dstFormat == PF_FLOAT16_R)
+		{
+			const float* srcFloat = (const float*)src;
+			UINT16* dstHalf = (UINT16*)dst;
+
+			for (UINT32 i = 0; i < numPixels; i++)
+				dstHalf[i] = Bitwise::floatToHalf(srcFloat[i]);
+		}
+		else
+		{
+			UINT32 srcPixelSize = PixelUtil::getNumElemBytes(srcFormat);
+			UINT32 dstPixelSize = PixelUtil::getNumElemBytes(dstFormat);
+
+			// The brute force fallback
+			float r, g, b, a;
+			for (UINT32 i = 0; i < numPixels; i++)
+			{
+				PixelUtil::unpackColor(&r, &g, &b, &a, srcFormat, src);
+				PixelUtil::packColor(r, g, b, a, dstFormat, dst);
+
+				src += srcPixelSize;
+				dst += dstPixelSize;
+			}
+		}
+	}
+
+	/**
+	 * Converts a range of rows between two uncompressed pixel buffers of the same size. Rows are indexed sequentially
+	 * through all the slices of the volume.
+	 */
+	void convertPixelRows(const PixelData& src, PixelData& dst, UINT32 firstRow, UINT32 numRows)
+	{
+		UINT32 srcPixelSize = PixelUtil::getNumElemBytes(src.getFormat());
+		UINT32 dstPixelSize = PixelUtil::getNumElemBytes(dst.getFormat());
+		UINT32 height = src.getHeight();
+
+		for (UINT32 row = firstRow; row < firstRow + numRows; row++)
+		{
+			UINT32 y = row % height;
+			UINT32 z = row / height;
+
+			const UINT8* srcPtr = static_cast<const UINT8*>(src.getData()) + (src.getLeft() +
+				(src.getTop() + y) * src.getRowPitch() + (src.getFront() + z) * src.getSlicePitch()) * srcPixelSize;
+			UINT8* dstPtr = static_cast<UINT8*>(dst.getData()) + (dst.getLeft() +
+				(dst.getTop() + y) * dst.getRowPitch() + (dst.getFront() + z) * dst.getSlicePitch()) * dstPixelSize;
+
+			convertPixelRow(srcPtr, src.getFormat(), dstPtr, dst.getFormat(), src.getWidth());
+		}
+	}
+
 	UINT32 PixelUtil::getNumElemBytes(PixelFormat format)
 	{
 		return getDescriptionFor(format).elemBytes;
@@ -1537,41 +1985,38 @@ namespace bs
 			return;
 		}
 
-		UINT32 srcPixelSize = PixelUtil::getNumElemBytes(src.getFormat());
-		UINT32 dstPixelSize = PixelUtil::getNumElemBytes(dst.getFormat());
-		UINT8 *srcptr = static_cast<UINT8*>(src.getData())
-			+ (src.getLeft() + src.getTop() * src.getRowPitch() + src.getFront() * src.getSlicePitch()) * srcPixelSize;
-		UINT8 *dstptr = static_cast<UINT8*>(dst.getData())
-			+ (dst.getLeft() + dst.getTop() * dst.getRowPitch() + dst.getFront() * dst.getSlicePitch()) * dstPixelSize;
-
-		// Calculate pitches+skips in bytes
-		UINT32 srcRowSkipBytes = src.getRowSkip()*srcPixelSize;
-		UINT32 srcSliceSkipBytes = src.getSliceSkip()*srcPixelSize;
-		UINT32 dstRowSkipBytes = dst.getRowSkip()*dstPixelSize;
-		UINT32 dstSliceSkipBytes = dst.getSliceSkip()*dstPixelSize;
-
-		// The brute force fallback
-		float r, g, b, a;
-		for (UINT32 z = src.getFront(); z < src.getBack(); z++)
-		{
-			for (UINT32 y = src.getTop(); y < src.getBottom(); y++)
-			{
-				for (UINT32 x = src.getLeft(); x < src.getRight(); x++)
-				{
-					unpackColor(&r, &g, &b, &a, src.getFormat(), srcptr);
-					packColor(r, g, b, a, dst.getFormat(), dstptr);
+		UINT32 numRows = src.getHeight() * src.getDepth();
+		UINT32 numPixels = numRows * src.getWidth();
 
-					srcptr += srcPixelSize;
-					dstptr += dstPixelSize;
-				}
+		// Large images are split into groups of rows, converted in parallel on the task scheduler's worker threads. Group
+		// count is based on the hardware thread count, as the number of scheduler workers changes while tasks are waited
+		// on.
+		UINT32 numGroups = 1;
+		if (numPixels >= PARALLEL_CONVERSION_MIN_PIXELS && TaskScheduler::isStarted())
+			numGroups = std::min(numRows, std::max(1U, (UINT32)BS_THREAD_HARDWARE_CONCURRENCY));
 
-				srcptr += srcRowSkipBytes;
-				dstptr += dstRowSkipBytes;
-			}
+		UINT32 rowsPerGroup = Math::divideAndRoundUp(numRows, numGroups);
 
-			srcptr += srcSliceSkipBytes;
-			dstptr += dstSliceSkipBytes;
+		Vector<SPtr<Task>> tasks;
+		for (UINT32 i = 1; i < numGroups; i++)
+		{
+			UINT32 firstRow = i * rowsPerGroup;
+			if (firstRow >= numRows)
+				break;
+
+			UINT32 groupRows = std::min(rowsPerGroup, numRows - firstRow);
+			SPtr<Task> task = Task::create("PixelConversion",
+				[&src, &dst, firstRow, groupRows]() { convertPixelRows(src, dst, firstRow, groupRows); });
+
+			TaskScheduler::instance().addTask(task);
+			tasks.push_back(task);
 		}
+
+		// First group is converted on the calling thread
+		convertPixelRows(src, dst, 0, std::min(rowsPerGroup, numRows));
+
+		for (auto& task : tasks)
+			task->wait();
 	}
 
 	void PixelUtil::flipComponentOrder(PixelData& data)
@@ -1854,8 +2299,8 @@ namespace bs
 				UINT32 dstZ = (depth - z - 1) * sliceSize;
 
 				memcpy(sliceTemp, &dataPtr[dstZ], sliceSize);
-				memcpy(&dataPtr[srcZ], &dataPtr[srcZ], sliceSize);
-				memcpy(&dataPtr[dstZ], sliceTemp, sliceSize);
+				memcpy(&dataPtr[dstZ], &dataPtr[srcZ], sliceSize);
+				memcpy(&dataPtr[srcZ], sliceTemp, sliceSize);
 			}
 
 			// Note: If flipping Y or X as well I could do it here without an extra set of memcpys
@@ -1901,7 +2346,30 @@ namespace bs
 				for (UINT32 y = 0; y < height; y++)
 				{
 					UINT32 halfWidth = width / 2;
-					for (UINT32 x = 0; x < halfWidth; x++)
+					UINT32 x = 0;
+
+#if BS_SIMD_SSE2
+					if (elemSize == 4 && sSIMDLevel >= PixelSIMDLevel::AVX2)
+						x = mirrorRowAVX2(rowPtr, width);
+
+					// Swap blocks of four 32-bit pixels from both ends of the row, reversing each block
+					if (elemSize == 4 && sSIMDLevel >= PixelSIMDLevel::SSE2)
+					{
+						for (; (x + 4) <= halfWidth; x += 4)
+						{
+							UINT8* left = &rowPtr[x * 4];
+							UINT8* right = &rowPtr[(width - x - 4) * 4];
+
+							__m128i leftPixels = _mm_loadu_si128((const __m128i*)left);
+							__m128i rightPixels = _mm_loadu_si128((const __m128i*)right);
+
+							_mm_storeu_si128((__m128i*)left, _mm_shuffle_epi32(rightPixels, _MM_SHUFFLE(0, 1, 2, 3)));
+							_mm_storeu_si128((__m128i*)right, _mm_shuffle_epi32(leftPixels, _MM_SHUFFLE(0, 1, 2, 3)));
+						}
+					}
+#endif
+
+					for (; x < halfWidth; x++)
 					{
 						UINT32 srcX = x * elemSize;
 						UINT32 dstX = (width - x - 1) * elemSize;
@@ -1921,6 +2389,70 @@ namespace bs
 		}
 	}
 
+#if BS_SIMD_SSE2
+	/** Executes the CPUID instruction for the provided leaf and sub-leaf, and outputs the EAX, EBX, ECX and EDX registers. */
+	void queryCPUID(UINT32 leaf, UINT32 subLeaf, UINT32 (&output)[4])
+	{
+#if BS_COMPILER == BS_COMPILER_MSVC
+		int info[4];
+		__cpuidex(info, (int)leaf, (int)subLeaf);
+		memcpy(output, info, sizeof(info));
+#else
+		__cpuid_count(leaf, subLeaf, output[0], output[1], output[2], output[3]);
+#endif
+	}
+
+	/** Returns the mask of register states the OS preserves across context switches (XCR0). */
+	UINT64 queryEnabledRegisterStates()
+	{
+#if BS_COMPILER == BS_COMPILER_MSVC
+		return _xgetbv(0);
+#else
+		UINT32 eax, edx;
+		__asm__ __volatile__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+		return ((UINT64)edx << 32) | eax;
+#endif
+	}
+#endif
+
+	PixelSIMDLevel PixelUtil::_getSupportedSIMDLevel()
+	{
+#if BS_SIMD_SSE2
+		UINT32 info[4];
+		queryCPUID(0, 0, info);
+
+		UINT32 maxLeaf = info[0];
+		if (maxLeaf >= 7)
+		{
+			// AVX2 needs to be supported by the CPU, and the OS needs to preserve the AVX registers
+			queryCPUID(1, 0, info);
+			bool hasOSXSave = (info[2] & (1 << 27)) != 0;
+			bool hasAVX = (info[2] & (1 << 28)) != 0;
+
+			if (hasOSXSave && hasAVX && (queryEnabledRegisterStates() & 0x6) == 0x6)
+			{
+				queryCPUID(7, 0, info);
+				if ((info[1] & (1 << 5)) != 0)
+					return PixelSIMDLevel::AVX2;
+			}
+		}
+
+		return PixelSIMDLevel::SSE2;
+#else
+		return PixelSIMDLevel::None;
+#endif
+	}
+
+	void PixelUtil::_setSIMDLevel(PixelSIMDLevel level)
+	{
+		sSIMDLevel = std::min(level, _getSupportedSIMDLevel());
+	}
+
+	PixelSIMDLevel PixelUtil::_getSIMDLevel()
+	{
+		return sSIMDLevel;
+	}
+
 	void PixelUtil::applyGamma(UINT8* buffer, float gamma, UINT32 size, UINT8 bpp)
 	{
 		if(gamma == 1.0f)
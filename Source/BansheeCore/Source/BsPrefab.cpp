@@ -10,13 +10,15 @@
 namespace bs
 {
 	Prefab::Prefab()
-		:Resource(false), mHash(0), mIsScene(true)
+		:Resource(false), mHash(0), mIsScene(true), mCloneData(nullptr), mCloneDataSize(0)
 	{
 		
 	}
 
 	Prefab::~Prefab()
 	{
+		clearCloneData();
+
 		if (mRoot != nullptr)
 			mRoot->destroy(true);
 	}
@@ -34,6 +36,8 @@ namespace bs
 		sceneObject->mPrefabLinkUUID = newPrefab->mUUID;
 		newPrefab->_getRoot()->mPrefabLinkUUID = newPrefab->mUUID;
 
+		sceneObject->notifyHierarchyModified();
+
 		return handle;
 	}
 
@@ -47,6 +51,8 @@ namespace bs
 
 	void Prefab::initialize(const HSceneObject& sceneObject)
 	{
+		clearCloneData();
+
 		sceneObject->mPrefabDiff = nullptr;
 		PrefabUtility::generatePrefabIds(sceneObject);
 
@@ -101,9 +107,38 @@ namespace bs
 		sceneObject->mPrefabLinkUUID = mUUID;
 		mRoot->mPrefabLinkUUID = mUUID;
 
+		sceneObject->notifyHierarchyModified();
+
 		mHash++;
 	}
 
+	bool Prefab::isInstanceOutOfDate(const HSceneObject& root)
+	{
+		Stack<HSceneObject> todo;
+		todo.push(root);
+
+		while (!todo.empty())
+		{
+			HSceneObject current = todo.top();
+			todo.pop();
+
+			if (!current->mPrefabLinkUUID.empty())
+			{
+				HPrefab prefabLink = static_resource_cast<Prefab>(gResources().loadFromUUID(current->mPrefabLinkUUID, false,
+					ResourceLoadFlag::None));
+
+				if (prefabLink.isLoaded(false) && prefabLink->getHash() != current->mPrefabHash)
+					return true;
+			}
+
+			UINT32 childCount = current->getNumChildren();
+			for (UINT32 i = 0; i < childCount; i++)
+				todo.push(current->getChild(i));
+		}
+
+		return false;
+	}
+
 	void Prefab::_updateChildInstances()
 	{
 		Stack<HSceneObject> todo;
@@ -120,7 +155,14 @@ namespace bs
 				HSceneObject child = current->getChild(i);
 
 				if (!child->mPrefabLinkUUID.empty())
+				{
+					if (!isInstanceOutOfDate(child))
+						continue;
+
+					// Child instance is about to be modified, so any cached serialized data is no longer valid
+					clearCloneData();
 					PrefabUtility::updateFromPrefab(child);
+				}
 				else
 					todo.push(child);
 			}
@@ -151,10 +193,28 @@ namespace bs
 		if (mRoot == nullptr)
 			return HSceneObject();
 
-		mRoot->mPrefabHash = mHash;
-		mRoot->mLinkId = -1;
+		// Encode the hierarchy only once, and then just decode it for every clone. Prefab hierarchy doesn't change between
+		// instantiations, so there is no need to pay for encoding every time.
+		if (mCloneData == nullptr)
+		{
+			mRoot->mPrefabHash = mHash;
+			mRoot->mLinkId = -1;
+
+			mCloneData = mRoot->_encodeClone(false, mCloneDataSize);
+		}
+
+		return SceneObject::_decodeClone(mCloneData, mCloneDataSize);
+	}
+
+	void Prefab::clearCloneData()
+	{
+		if (mCloneData != nullptr)
+		{
+			bs_free(mCloneData);
+			mCloneData = nullptr;
+		}
 
-		return mRoot->clone(false);
+		mCloneDataSize = 0;
 	}
 
 	RTTITypeBase* Prefab::getRTTIStatic()
@@ -145,6 +145,7 @@ namespace bs
 
 		reportSample.numVertices = (UINT32)(sample.endStats.numVertices - sample.startStats.numVertices);
 		reportSample.numPrimitives = (UINT32)(sample.endStats.numPrimitives - sample.startStats.numPrimitives);
+		reportSample.numInstances = (UINT32)(sample.endStats.numInstances - sample.startStats.numInstances);
 		
 		reportSample.numPipelineStateChanges = (UINT32)(sample.endStats.numPipelineStateChanges - sample.startStats.numPipelineStateChanges);
 
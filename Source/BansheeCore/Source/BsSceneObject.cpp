@@ -115,6 +115,15 @@ namespace bs
 		mThisHandle._setHandleData(thisPtr);
 	}
 
+	void SceneObject::setName(const String& name)
+	{
+		if (mName == name)
+			return;
+
+		GameObject::setName(name);
+		notifyHierarchyModified();
+	}
+
 	String SceneObject::getPrefabLink(bool onlyDirect) const
 	{
 		const SceneObject* curObj = this;
@@ -171,9 +180,17 @@ namespace bs
 			rootObj->mPrefabLinkUUID = "";
 			rootObj->mPrefabDiff = nullptr;
 			PrefabUtility::clearPrefabIds(rootObj->getHandle(), true, false);
+
+			rootObj->notifyHierarchyModified();
 		}
 	}
 
+	void SceneObject::_setPrefabLinkUUID(const String& UUID)
+	{
+		mPrefabLinkUUID = UUID;
+		notifyHierarchyModified();
+	}
+
 	bool SceneObject::hasFlag(UINT32 flag) const
 	{
 		return (mFlags & flag) != 0;
@@ -616,6 +633,7 @@ namespace bs
 		mChildren.push_back(object); 
 
 		object->_setFlags(mFlags);
+		notifyHierarchyModified();
 	}
 
 	void SceneObject::removeChild(const HSceneObject& object)
@@ -629,6 +647,8 @@ namespace bs
 			BS_EXCEPT(InternalErrorException, 
 				"Trying to remove a child but it's not a child of the transform.");
 		}
+
+		notifyHierarchyModified();
 	}
 
 	HSceneObject SceneObject::findChild(const String& name, bool recursive)
@@ -689,6 +709,7 @@ namespace bs
 		if (mActiveHierarchy != activeHierarchy)
 		{
 			mActiveHierarchy = activeHierarchy;
+			notifyHierarchyModified();
 
 			if (triggerEvents)
 			{
@@ -711,6 +732,14 @@ namespace bs
 		}
 	}
 
+	void SceneObject::notifyHierarchyModified()
+	{
+		if (mThisHandle == nullptr || !isInstantiated() || !SceneManager::isStarted())
+			return;
+
+		gSceneManager().onHierarchyModified(mThisHandle);
+	}
+
 	bool SceneObject::getActive(bool self)
 	{
 		if (self)
@@ -734,6 +763,17 @@ namespace bs
 	}
 
 	HSceneObject SceneObject::clone(bool instantiate)
+	{
+		UINT32 bufferSize = 0;
+		UINT8* buffer = _encodeClone(instantiate, bufferSize);
+
+		HSceneObject cloneObj = _decodeClone(buffer, bufferSize);
+		bs_free(buffer);
+
+		return cloneObj;
+	}
+
+	UINT8* SceneObject::_encodeClone(bool instantiate, UINT32& size)
 	{
 		bool isInstantiated = !hasFlag(SOF_DontInstantiate);
 
@@ -742,20 +782,26 @@ namespace bs
 		else
 			_unsetFlags(SOF_DontInstantiate);
 
-		UINT32 bufferSize = 0;
+		size = 0;
 
 		MemorySerializer serializer;
-		UINT8* buffer = serializer.encode(this, bufferSize, (void*(*)(UINT32))&bs_alloc);
-
-		GameObjectManager::instance().setDeserializationMode(GODM_UseNewIds | GODM_RestoreExternal);
-		SPtr<SceneObject> cloneObj = std::static_pointer_cast<SceneObject>(serializer.decode(buffer, bufferSize));
-		bs_free(buffer);
+		UINT8* buffer = serializer.encode(this, size, (void*(*)(UINT32))&bs_alloc);
 
 		if(isInstantiated)
 			_unsetFlags(SOF_DontInstantiate);
 		else
 			_setFlags(SOF_DontInstantiate);
 
+		return buffer;
+	}
+
+	HSceneObject SceneObject::_decodeClone(UINT8* data, UINT32 size)
+	{
+		MemorySerializer serializer;
+
+		GameObjectManager::instance().setDeserializationMode(GODM_UseNewIds | GODM_RestoreExternal);
+		SPtr<SceneObject> cloneObj = std::static_pointer_cast<SceneObject>(serializer.decode(data, size));
+
 		return cloneObj->mThisHandle;
 	}
 
@@ -360,6 +360,8 @@ namespace bs
 		if(font != nullptr)
 		{
 			UINT32 nearestSize = font->getClosestSize(fontSize);
+			font->_cacheGlyphs(nearestSize, text);
+
 			mFontData = font->getBitmap(nearestSize);
 		}
 
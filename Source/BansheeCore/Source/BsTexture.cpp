@@ -9,6 +9,7 @@
 #include "BsAsyncOp.h"
 #include "BsResources.h"
 #include "BsPixelUtil.h"
+#include "BsTextureStreamingManager.h"
 
 namespace bs 
 {
@@ -108,7 +109,18 @@ namespace bs
 	{
 		const TextureProperties& props = getProperties();
 
-		SPtr<ct::CoreObject> coreObj = ct::TextureManager::instance().createTextureInternal(props.mDesc, mInitData);
+		// Core object of a streamed texture only contains the resident mip levels
+		TEXTURE_DESC desc = props.mDesc;
+		if (mFirstResidentMip > 0)
+		{
+			PixelUtil::getSizeForMipLevel(desc.width, desc.height, desc.depth, mFirstResidentMip, desc.width, desc.height,
+				desc.depth);
+
+			desc.numMips -= mFirstResidentMip;
+		}
+
+		SPtr<ct::Texture> coreObj = ct::TextureManager::instance().createTextureInternal(desc, mInitData);
+		coreObj->mStreamingId = mStreamingId;
 
 		if ((mProperties.getUsage() & TU_CPUCACHED) == 0)
 			mInitData = nullptr;
@@ -118,6 +130,16 @@ namespace bs
 
 	AsyncOp Texture::writeData(const SPtr<PixelData>& data, UINT32 face, UINT32 mipLevel, bool discardEntireBuffer)
 	{
+		if (mipLevel < mFirstResidentMip)
+		{
+			LOGERR("Attempting to write to a mip level that isn't resident: " + toString(mipLevel) +
+				". First resident mip level is " + toString(mFirstResidentMip) + ".");
+
+			AsyncOp op;
+			op._completeOperation();
+			return op;
+		}
+
 		UINT32 subresourceIdx = mProperties.mapToSubresourceIdx(face, mipLevel);
 		updateCPUBuffers(subresourceIdx, *data);
 
@@ -133,12 +155,22 @@ namespace bs
 
 		};
 
-		return gCoreThread().queueReturnCommand(std::bind(func, getCore(), face, mipLevel,
+		return gCoreThread().queueReturnCommand(std::bind(func, getCore(), face, mipLevel - mFirstResidentMip,
 			data, discardEntireBuffer, std::placeholders::_1));
 	}
 
 	AsyncOp Texture::readData(const SPtr<PixelData>& data, UINT32 face, UINT32 mipLevel)
 	{
+		if (mipLevel < mFirstResidentMip)
+		{
+			LOGERR("Attempting to read from a mip level that isn't resident: " + toString(mipLevel) +
+				". First resident mip level is " + toString(mFirstResidentMip) + ".");
+
+			AsyncOp op;
+			op._completeOperation();
+			return op;
+		}
+
 		data->_lock();
 
 		std::function<void(const SPtr<ct::Texture>&, UINT32, UINT32, const SPtr<PixelData>&, AsyncOp&)> func =
@@ -154,7 +186,7 @@ namespace bs
 
 		};
 
-		return gCoreThread().queueReturnCommand(std::bind(func, getCore(), face, mipLevel,
+		return gCoreThread().queueReturnCommand(std::bind(func, getCore(), face, mipLevel - mFirstResidentMip,
 			data, std::placeholders::_1));
 	}
 
@@ -183,13 +215,30 @@ namespace bs
 		PixelUtil::getSizeForMipLevel(mProperties.getWidth(), mProperties.getHeight(), mProperties.getDepth(),
 			mipLevel, mipWidth, mipHeight, mipDepth);
 
-		if (pixelData.getWidth() != mipWidth || pixelData.getHeight() != mipHeight ||
-			pixelData.getDepth() != mipDepth || pixelData.getFormat() != mProperties.getFormat())
+		if (pixelData.getRight() > mipWidth || pixelData.getBottom() > mipHeight ||
+			pixelData.getBack() > mipDepth || pixelData.getFormat() != mProperties.getFormat())
 		{
 			LOGERR("Provided buffer is not of valid dimensions or format in order to update this texture.");
 			return;
 		}
 
+		// Only a part of the subresource is being written to
+		if (pixelData.getWidth() != mipWidth || pixelData.getHeight() != mipHeight || pixelData.getDepth() != mipDepth)
+		{
+			if (PixelUtil::isCompressed(pixelData.getFormat()))
+				return;
+
+			PixelData src(pixelData.getWidth(), pixelData.getHeight(), pixelData.getDepth(), pixelData.getFormat());
+			src.setExternalBuffer(pixelData.getData());
+			src.setRowPitch(pixelData.getRowPitch());
+			src.setSlicePitch(pixelData.getSlicePitch());
+
+			PixelData dest = mCPUSubresourceData[subresourceIdx]->getSubVolume(pixelData.getExtents());
+			PixelUtil::bulkPixelConversion(src, dest);
+
+			return;
+		}
+
 		if (mCPUSubresourceData[subresourceIdx]->getSize() != pixelData.getSize())
 			BS_EXCEPT(InternalErrorException, "Buffer sizes don't match.");
 
@@ -272,6 +321,45 @@ namespace bs
 		return std::static_pointer_cast<ct::Texture>(mCoreSpecific);
 	}
 
+	void Texture::setStreamable(bool streamable)
+	{
+		if (mStreamData != nullptr)
+		{
+			LOGWRN("Cannot change streaming of a texture that was loaded with streamed mip levels.");
+			return;
+		}
+
+		if (!streamable)
+		{
+			mNumStreamedMips = 0;
+			return;
+		}
+
+		int invalidUsage = TU_RENDERTARGET | TU_DEPTHSTENCIL | TU_LOADSTORE | TU_CPUCACHED | TU_DYNAMIC;
+		TextureType type = mProperties.getTextureType();
+		if ((type != TEX_TYPE_2D && type != TEX_TYPE_CUBE_MAP) || (mProperties.getUsage() & invalidUsage) != 0 ||
+			mProperties.getNumSamples() > 1)
+		{
+			LOGWRN("Only 2D and cube textures with static usage and without multisampling can be streamed.");
+			return;
+		}
+
+		// Mip levels of the tail size or smaller are never streamed
+		UINT32 width = mProperties.getWidth();
+		UINT32 height = mProperties.getHeight();
+		UINT32 numStreamedMips = 0;
+		while (std::max(width, height) > TextureStreamingManager::MIP_TAIL_SIZE &&
+			numStreamedMips < mProperties.getNumMipmaps())
+		{
+			width = std::max(1U, width / 2);
+			height = std::max(1U, height / 2);
+
+			numStreamedMips++;
+		}
+
+		mNumStreamedMips = numStreamedMips;
+	}
+
 	/************************************************************************/
 	/* 								SERIALIZATION                      		*/
 	/************************************************************************/
@@ -349,6 +437,29 @@ namespace bs
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
+		UINT32 mipWidth, mipHeight, mipDepth;
+		PixelUtil::getSizeForMipLevel(mProperties.getWidth(), mProperties.getHeight(), mProperties.getDepth(),
+			mipLevel, mipWidth, mipHeight, mipDepth);
+
+		if (src.getRight() > mipWidth || src.getBottom() > mipHeight || src.getBack() > mipDepth)
+		{
+			LOGERR("Provided buffer doesn't fit within the mip level it is being written to.");
+			return;
+		}
+
+		bool isPartial = src.getWidth() != mipWidth || src.getHeight() != mipHeight || src.getDepth() != mipDepth;
+		if (isPartial)
+		{
+			if (PixelUtil::isCompressed(src.getFormat()))
+			{
+				LOGERR("Only entire mip levels of compressed textures can be written to.");
+				return;
+			}
+
+			// Discarding would lose the contents outside of the written area
+			discardEntireBuffer = false;
+		}
+
 		if(discardEntireBuffer)
 		{
 			if((mProperties.getUsage() & TU_DYNAMIC) == 0)
@@ -0,0 +1,392 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsTextureStreamingManager.h"
+#include "BsTexture.h"
+#include "BsTextureManager.h"
+#include "BsResources.h"
+#include "BsRTTIType.h"
+#include "BsPixelData.h"
+#include "BsPixelUtil.h"
+#include "BsDataStream.h"
+#include "BsTaskScheduler.h"
+#include "BsCoreThread.h"
+#include "BsTime.h"
+#include "BsMath.h"
+
+using namespace std::placeholders;
+
+namespace bs
+{
+	UINT32 TextureStreamingManager::sCoreIdVersion = 0;
+
+	/**
+	 * Copies the mip levels shared between two versions of a streamed texture, and writes the newly loaded mip levels
+	 * into the new version.
+	 */
+	void updateResidentMips(const SPtr<ct::Texture>& oldTexture, const SPtr<ct::Texture>& newTexture, UINT32 oldFirstMip,
+		UINT32 newFirstMip, const Vector<SPtr<PixelData>>& loadedMips)
+	{
+		const TextureProperties& props = newTexture->getProperties();
+		UINT32 numFaces = props.getNumFaces();
+		UINT32 numMips = props.getNumMipmaps() + 1;
+
+		for (UINT32 i = 0; i < numMips; i++)
+		{
+			UINT32 mip = newFirstMip + i;
+			for (UINT32 face = 0; face < numFaces; face++)
+			{
+				if (mip >= oldFirstMip)
+					oldTexture->copy(newTexture, face, mip - oldFirstMip, face, i);
+				else
+					newTexture->writeData(*loadedMips[i * numFaces + face], i, face);
+			}
+		}
+	}
+
+	TextureStreamingManager::TextureStreamingManager()
+		: mNumTextures(0)
+	{
+		mResourceLoadedConn = gResources().onResourceLoaded.connect(
+			std::bind(&TextureStreamingManager::onResourceLoaded, this, _1));
+	}
+
+	TextureStreamingManager::~TextureStreamingManager()
+	{
+		mResourceLoadedConn.disconnect();
+
+		for (auto& entry : mTextures)
+		{
+			if (entry.load != nullptr)
+				entry.load->task->wait();
+		}
+	}
+
+	void TextureStreamingManager::_update()
+	{
+		UINT64 frameIdx = gTime().getFrameIdx();
+
+		Vector<HResource> loadedResources;
+		Vector<StreamedTextureUsage> usage;
+		{
+			Lock lock(mMutex);
+			std::swap(loadedResources, mLoadedResources);
+			std::swap(usage, mUsage);
+		}
+
+		for (auto& resource : loadedResources)
+		{
+			if (resource.isLoaded(false))
+				registerTexture(static_resource_cast<Texture>(resource));
+		}
+
+		// Find the most detailed mip level needed for each texture used since the last update
+		for (auto& entry : usage)
+		{
+			if (entry.streamingId >= (UINT32)mTextures.size())
+				continue;
+
+			StreamedTexture& texture = mTextures[entry.streamingId];
+			if (!texture.handle.isLoaded(false))
+				continue;
+
+			const TextureProperties& props = texture.handle->getProperties();
+			float size = (float)std::max(props.getWidth(), props.getHeight());
+
+			// Pick the mip level with roughly one texel per pixel
+			UINT32 mip = 0;
+			if (entry.screenSize > 0.0f && size > entry.screenSize)
+				mip = (UINT32)Math::floorToInt(Math::log2(size / entry.screenSize));
+
+			mip = std::min(mip, texture.tailMip);
+
+			if (texture.lastUsedFrame != frameIdx)
+				texture.requestedMip = mip;
+			else
+				texture.requestedMip = std::min(texture.requestedMip, mip);
+
+			texture.lastUsedFrame = frameIdx;
+		}
+
+		mResidentMemory = 0;
+		for (UINT32 i = 0; i < (UINT32)mTextures.size(); i++)
+		{
+			StreamedTexture& texture = mTextures[i];
+			if (texture.handle == nullptr)
+				continue;
+
+			if (!texture.handle.isLoaded(false))
+			{
+				unregisterTexture(i);
+				continue;
+			}
+
+			// Apply mip levels that finished loading
+			if (texture.load != nullptr && texture.load->task->isComplete())
+			{
+				SPtr<MipLoad> load = texture.load;
+				texture.load = nullptr;
+
+				if ((load->firstMip + load->numMips) == texture.firstResidentMip)
+					setResidentMips(i, load->firstMip, load->mips);
+			}
+
+			if ((frameIdx - texture.lastUsedFrame) > UNUSED_FRAME_COUNT)
+				texture.requestedMip = texture.tailMip;
+
+			mResidentMemory += texture.residentSize;
+		}
+
+		// Evict mip levels, starting with the least recently used textures
+		if (mResidentMemory > mMemoryBudget)
+		{
+			Vector<UINT32> lruOrder;
+			for (UINT32 i = 0; i < (UINT32)mTextures.size(); i++)
+			{
+				if (mTextures[i].handle != nullptr)
+					lruOrder.push_back(i);
+			}
+
+			std::sort(lruOrder.begin(), lruOrder.end(),
+				[&](UINT32 a, UINT32 b) { return mTextures[a].lastUsedFrame < mTextures[b].lastUsedFrame; });
+
+			// Evict mip levels that aren't needed first, and only then the ones that are
+			for (UINT32 pass = 0; pass < 2 && mResidentMemory > mMemoryBudget; pass++)
+			{
+				for (auto& id : lruOrder)
+				{
+					StreamedTexture& texture = mTextures[id];
+
+					UINT32 firstMip = pass == 0 ? texture.requestedMip : texture.tailMip;
+					if (texture.firstResidentMip >= firstMip)
+						continue;
+
+					const TextureProperties& props = texture.handle->getProperties();
+					while (firstMip > (texture.firstResidentMip + 1) &&
+						(mResidentMemory - texture.residentSize + getMipChainSize(props, firstMip - 1)) <= mMemoryBudget)
+					{
+						firstMip--;
+					}
+
+					// Loaded data would no longer line up with the resident mip levels
+					texture.load = nullptr;
+					setResidentMips(id, firstMip, Vector<SPtr<PixelData>>());
+
+					if (mResidentMemory <= mMemoryBudget)
+						break;
+				}
+			}
+		}
+
+		// Start loading requested mip levels, as long as they fit within the budget
+		UINT32 numLoads = 0;
+		UINT64 pendingMemory = 0;
+		for (auto& texture : mTextures)
+		{
+			if (texture.load == nullptr)
+				continue;
+
+			const TextureProperties& props = texture.handle->getProperties();
+			pendingMemory += getMipChainSize(props, texture.load->firstMip) - texture.residentSize;
+			numLoads++;
+		}
+
+		for (UINT32 i = 0; i < (UINT32)mTextures.size() && numLoads < MAX_CONCURRENT_LOADS; i++)
+		{
+			StreamedTexture& texture = mTextures[i];
+			if (texture.handle == nullptr || texture.load != nullptr || texture.requestedMip >= texture.firstResidentMip)
+				continue;
+
+			const TextureProperties& props = texture.handle->getProperties();
+			UINT64 loadSize = getMipChainSize(props, texture.requestedMip) - texture.residentSize;
+			if ((mResidentMemory + pendingMemory + loadSize) > mMemoryBudget)
+				continue;
+
+			startLoad(i);
+
+			pendingMemory += loadSize;
+			numLoads++;
+		}
+	}
+
+	void TextureStreamingManager::_notifyUsage(const Vector<StreamedTextureUsage>& usage)
+	{
+		Lock lock(mMutex);
+		mUsage.insert(mUsage.end(), usage.begin(), usage.end());
+	}
+
+	void TextureStreamingManager::onResourceLoaded(const HResource& resource)
+	{
+		if (resource->getRTTI()->getRTTIId() != TID_Texture)
+			return;
+
+		Texture* texture = static_cast<Texture*>(resource.get());
+		if (texture->mStreamData == nullptr)
+			return;
+
+		Lock lock(mMutex);
+		mLoadedResources.push_back(resource);
+	}
+
+	void TextureStreamingManager::registerTexture(const HTexture& texture)
+	{
+		if (texture->mStreamingId != (UINT32)-1)
+			return;
+
+		UINT32 streamingId;
+		if (!mFreeIds.empty())
+		{
+			streamingId = mFreeIds.back();
+			mFreeIds.pop_back();
+		}
+		else
+		{
+			streamingId = (UINT32)mTextures.size();
+			mTextures.push_back(StreamedTexture());
+		}
+
+		StreamedTexture& entry = mTextures[streamingId];
+		entry.handle = texture.getWeak();
+		entry.firstResidentMip = texture->mFirstResidentMip;
+		entry.tailMip = texture->mNumStreamedMips;
+		entry.requestedMip = entry.tailMip;
+		entry.residentSize = getMipChainSize(texture->getProperties(), entry.firstResidentMip);
+		entry.lastUsedFrame = gTime().getFrameIdx();
+
+		// The core object already exists, so its identifier needs to be assigned on the core thread
+		texture->mStreamingId = streamingId;
+		SPtr<ct::Texture> coreTexture = texture->getCore();
+
+		gCoreThread().queueCommand([coreTexture, streamingId]()
+		{
+			coreTexture->mStreamingId = streamingId;
+			sCoreIdVersion++;
+		});
+
+		mNumTextures++;
+	}
+
+	void TextureStreamingManager::unregisterTexture(UINT32 streamingId)
+	{
+		StreamedTexture& entry = mTextures[streamingId];
+
+		// Load task only references the stream data, so it can be left to finish on its own
+		entry = StreamedTexture();
+		mFreeIds.push_back(streamingId);
+
+		mNumTextures--;
+	}
+
+	void TextureStreamingManager::startLoad(UINT32 streamingId)
+	{
+		StreamedTexture& entry = mTextures[streamingId];
+
+		SPtr<Texture> texture = entry.handle.getInternalPtr();
+		SPtr<TextureStreamData> streamData = texture->mStreamData;
+		TextureProperties props = texture->getProperties();
+
+		SPtr<MipLoad> load = bs_shared_ptr_new<MipLoad>();
+		load->firstMip = entry.requestedMip;
+		load->numMips = entry.firstResidentMip - entry.requestedMip;
+		load->task = Task::create("TextureStreaming", [load, streamData, props]()
+		{
+			_readMips(*streamData, props, load->firstMip, load->numMips, load->mips);
+		});
+
+		entry.load = load;
+		TaskScheduler::instance().addTask(load->task);
+	}
+
+	void TextureStreamingManager::setResidentMips(UINT32 streamingId, UINT32 firstMip,
+		const Vector<SPtr<PixelData>>& loadedMips)
+	{
+		StreamedTexture& entry = mTextures[streamingId];
+
+		SPtr<Texture> oldTexture = entry.handle.getInternalPtr();
+
+		SPtr<Texture> newTexture = TextureManager::instance()._createEmpty();
+		newTexture->mProperties = oldTexture->mProperties;
+		newTexture->mMetaData = oldTexture->mMetaData;
+		newTexture->mNumStreamedMips = oldTexture->mNumStreamedMips;
+		newTexture->mStreamData = oldTexture->mStreamData;
+		newTexture->mStreamingId = streamingId;
+		newTexture->mFirstResidentMip = firstMip;
+		newTexture->initialize();
+
+		gCoreThread().queueCommand(std::bind(&updateResidentMips, oldTexture->getCore(), newTexture->getCore(),
+			entry.firstResidentMip, firstMip, loadedMips));
+
+		mResidentMemory -= entry.residentSize;
+
+		entry.firstResidentMip = firstMip;
+		entry.residentSize = getMipChainSize(newTexture->getProperties(), firstMip);
+
+		mResidentMemory += entry.residentSize;
+
+		HResource handle = gResources()._getResourceHandle(entry.handle.getUUID());
+		gResources().update(handle, newTexture);
+	}
+
+	void TextureStreamingManager::_readMips(TextureStreamData& data, const TextureProperties& props, UINT32 firstMip,
+		UINT32 numMips, Vector<SPtr<PixelData>>& output)
+	{
+		UINT32 numFaces = props.getNumFaces();
+
+		// Find where the first requested mip level starts
+		UINT32 offset = data.offset;
+		for (UINT32 i = 0; i < firstMip; i++)
+		{
+			UINT32 width, height, depth;
+			PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), i, width, height, depth);
+
+			offset += numFaces * PixelUtil::getMemorySize(width, height, depth, data.format);
+		}
+
+		output.clear();
+		{
+			Lock lock(data.mutex);
+			data.stream->seek(offset);
+
+			for (UINT32 i = 0; i < numMips; i++)
+			{
+				UINT32 width, height, depth;
+				PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), firstMip + i,
+					width, height, depth);
+
+				for (UINT32 face = 0; face < numFaces; face++)
+				{
+					SPtr<PixelData> pixelData = PixelData::create(width, height, depth, data.format);
+					data.stream->read(pixelData->getData(), pixelData->getSize());
+
+					output.push_back(pixelData);
+				}
+			}
+		}
+
+		// Data might have been saved using a render API that uses a different format
+		if (data.format != props.getFormat())
+		{
+			for (auto& pixelData : output)
+			{
+				SPtr<PixelData> convertedData = PixelData::create(pixelData->getWidth(), pixelData->getHeight(),
+					pixelData->getDepth(), props.getFormat());
+
+				PixelUtil::bulkPixelConversion(*pixelData, *convertedData);
+				pixelData = convertedData;
+			}
+		}
+	}
+
+	UINT64 TextureStreamingManager::getMipChainSize(const TextureProperties& props, UINT32 firstMip)
+	{
+		UINT64 size = 0;
+		for (UINT32 i = firstMip; i <= props.getNumMipmaps(); i++)
+		{
+			UINT32 width, height, depth;
+			PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), i, width, height, depth);
+
+			size += PixelUtil::getMemorySize(width, height, depth, props.getFormat());
+		}
+
+		return size * props.getNumFaces();
+	}
+}
\ No newline at end of file
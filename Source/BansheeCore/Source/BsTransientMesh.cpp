@@ -50,12 +50,12 @@ namespace bs
 
 	SPtr<VertexData> TransientMesh::getVertexData() const
 	{
-		return mParentHeap->getVertexData();
+		return mParentHeap->getVertexData(mId);
 	}
 
 	SPtr<IndexBuffer> TransientMesh::getIndexBuffer() const
 	{
-		return mParentHeap->getIndexBuffer();
+		return mParentHeap->getIndexBuffer(mId);
 	}
 
 	UINT32 TransientMesh::getVertexOffset() const
@@ -0,0 +1,651 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Linux/BsLinuxFolderMonitor.h"
+#include "BsFileSystem.h"
+#include "BsException.h"
+
+#include <sys/inotify.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <cstring>
+
+namespace bs
+{
+	/** Information about a single monitored root folder, as provided to FolderMonitor::startMonitor(). */
+	struct FolderMonitor::FolderWatchInfo
+	{
+		FolderWatchInfo(const Path& folderToMonitor, bool monitorSubdirectories, UINT32 changeFilter, UINT32 monitorFlags)
+			:mFolderToMonitor(folderToMonitor), mMonitorSubdirectories(monitorSubdirectories),
+			mChangeFilter(changeFilter), mMonitorFlags(monitorFlags)
+		{ }
+
+		Path mFolderToMonitor;
+		bool mMonitorSubdirectories;
+		UINT32 mChangeFilter;
+		UINT32 mMonitorFlags;
+	};
+
+	/** Iterates over inotify_event records in a buffer filled by a single read() from the inotify handle. */
+	class FolderMonitor::FileNotifyInfo
+	{
+	public:
+		FileNotifyInfo(UINT8* notifyBuffer, UINT32 bufferSize)
+			:mBuffer(notifyBuffer), mBufferSize(bufferSize), mOffset(0)
+		{ }
+
+		/** Returns the next record in the buffer, or null if there are no more records. */
+		const inotify_event* getNext()
+		{
+			if (mOffset + sizeof(inotify_event) > mBufferSize)
+				return nullptr;
+
+			const inotify_event* event = (const inotify_event*)(mBuffer + mOffset);
+			mOffset += (UINT32)sizeof(inotify_event) + event->len;
+
+			if (mOffset > mBufferSize)
+			{
+				// Gone out of range, something bad happened
+				assert(false);
+				return nullptr;
+			}
+
+			return event;
+		}
+
+	protected:
+		UINT8* mBuffer;
+		UINT32 mBufferSize;
+		UINT32 mOffset;
+	};
+
+	enum class FileActionType
+	{
+		Added,
+		Removed,
+		Modified,
+		Renamed
+	};
+
+	struct FileAction
+	{
+		FileAction(FileActionType type, const String& newName, const String& oldName = StringUtil::BLANK)
+			:oldName(oldName), newName(newName), type(type), lastSize(0), checkForWriteStarted(false)
+		{ }
+
+		String oldName;
+		String newName;
+		FileActionType type;
+
+		UINT64 lastSize;
+		bool checkForWriteStarted;
+	};
+
+	struct FolderMonitor::Pimpl
+	{
+		/** Folder (root or a sub-folder) with an active inotify watch. */
+		struct WatchedFolder
+		{
+			String path;
+			FolderWatchInfo* owner;
+		};
+
+		Vector<FolderWatchInfo*> mFoldersToWatch;
+		INT32 mInotifyHandle;
+		INT32 mShutdownPipe[2];
+
+		UnorderedMap<INT32, WatchedFolder> mWatches;
+		UnorderedMap<String, INT32> mWatchHandles;
+
+		Queue<FileAction*> mFileActions;
+		List<FileAction*> mActiveFileActions;
+
+		Mutex mMainMutex;
+		Thread* mWorkerThread;
+	};
+
+	static const UINT32 READ_BUFFER_SIZE = 65536;
+
+	/** Returns true if the provided path is equal to the provided folder, or is contained within it. */
+	static bool isPathInFolder(const String& path, const String& folder)
+	{
+		if (path.size() < folder.size() || path.compare(0, folder.size(), folder) != 0)
+			return false;
+
+		return path.size() == folder.size() || path[folder.size()] == '/';
+	}
+
+	FolderMonitor::FolderMonitor()
+	{
+		mPimpl = bs_new<Pimpl>();
+		mPimpl->mWorkerThread = nullptr;
+		mPimpl->mInotifyHandle = -1;
+		mPimpl->mShutdownPipe[0] = -1;
+		mPimpl->mShutdownPipe[1] = -1;
+	}
+
+	FolderMonitor::~FolderMonitor()
+	{
+		stopMonitorAll();
+
+		// No need for mutex since we know worker thread is shut down by now
+		while(!mPimpl->mFileActions.empty())
+		{
+			FileAction* action = mPimpl->mFileActions.front();
+			mPimpl->mFileActions.pop();
+
+			bs_delete(action);
+		}
+
+		for (auto& action : mPimpl->mActiveFileActions)
+			bs_delete(action);
+
+		bs_delete(mPimpl);
+	}
+
+	void FolderMonitor::startMonitor(const Path& folderPath, bool subdirectories, FolderChange changeFilter)
+	{
+		if(!FileSystem::isDirectory(folderPath))
+		{
+			LOGERR("Provided path \"" + folderPath.toString() + "\" is not a directory");
+			return;
+		}
+
+		UINT32 filter = (UINT32)changeFilter;
+		UINT32 monitorFlags = IN_EXCL_UNLINK;
+
+		if((filter & ((UINT32)FolderChange::FileName | (UINT32)FolderChange::DirName)) != 0)
+			monitorFlags |= IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+
+		if((filter & ((UINT32)FolderChange::Attributes | (UINT32)FolderChange::Security)) != 0)
+			monitorFlags |= IN_ATTRIB;
+
+		if((filter & (UINT32)FolderChange::Size) != 0)
+			monitorFlags |= IN_MODIFY;
+
+		if((filter & (UINT32)FolderChange::LastWrite) != 0)
+			monitorFlags |= IN_CLOSE_WRITE;
+
+		if((filter & (UINT32)FolderChange::LastAccess) != 0)
+			monitorFlags |= IN_ACCESS;
+
+		if((filter & (UINT32)FolderChange::Creation) != 0)
+			monitorFlags |= IN_CREATE | IN_MOVED_TO;
+
+		// Need to know about new, removed and moved folders in order to keep the sub-folder watches up to date
+		if(subdirectories)
+			monitorFlags |= IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+
+		if(mPimpl->mInotifyHandle == -1)
+		{
+			mPimpl->mInotifyHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+			if(mPimpl->mInotifyHandle == -1)
+			{
+				BS_EXCEPT(InternalErrorException, "Failed to initialize inotify for folder monitoring. Error: " +
+					String(strerror(errno)));
+			}
+
+			if(pipe2(mPimpl->mShutdownPipe, O_CLOEXEC) != 0)
+			{
+				close(mPimpl->mInotifyHandle);
+				mPimpl->mInotifyHandle = -1;
+
+				BS_EXCEPT(InternalErrorException, "Failed to create a pipe for folder monitoring. Error: " +
+					String(strerror(errno)));
+			}
+		}
+
+		FolderWatchInfo* watchInfo = bs_new<FolderWatchInfo>(folderPath, subdirectories, filter, monitorFlags);
+		String rootPath = folderPath.toString();
+		while (rootPath.size() > 1 && rootPath.back() == '/')
+			rootPath.pop_back();
+
+		{
+			Lock lock(mPimpl->mMainMutex);
+
+			addWatches(rootPath, watchInfo);
+
+			if(mPimpl->mWatchHandles.find(rootPath) == mPimpl->mWatchHandles.end())
+			{
+				bs_delete(watchInfo);
+				BS_EXCEPT(InternalErrorException, "Failed to start folder monitor on folder \"" +
+					folderPath.toString() + "\" because inotify_add_watch failed.");
+			}
+
+			mPimpl->mFoldersToWatch.push_back(watchInfo);
+		}
+
+		if(mPimpl->mWorkerThread == nullptr)
+		{
+			mPimpl->mWorkerThread = bs_new<Thread>(std::bind(&FolderMonitor::workerThreadMain, this));
+
+			if(mPimpl->mWorkerThread == nullptr)
+			{
+				stopMonitorAll();
+				BS_EXCEPT(InternalErrorException, "Failed to create a new worker thread for folder monitoring");
+			}
+		}
+	}
+
+	void FolderMonitor::stopMonitor(const Path& folderPath)
+	{
+		{
+			Lock lock(mPimpl->mMainMutex);
+
+			auto findIter = std::find_if(mPimpl->mFoldersToWatch.begin(), mPimpl->mFoldersToWatch.end(),
+				[&](const FolderWatchInfo* x) { return x->mFolderToMonitor == folderPath; });
+
+			if(findIter != mPimpl->mFoldersToWatch.end())
+			{
+				FolderWatchInfo* watchInfo = *findIter;
+
+				for(auto iter = mPimpl->mWatches.begin(); iter != mPimpl->mWatches.end();)
+				{
+					if(iter->second.owner == watchInfo)
+					{
+						inotify_rm_watch(mPimpl->mInotifyHandle, iter->first);
+						mPimpl->mWatchHandles.erase(iter->second.path);
+						iter = mPimpl->mWatches.erase(iter);
+					}
+					else
+						++iter;
+				}
+
+				bs_delete(watchInfo);
+				mPimpl->mFoldersToWatch.erase(findIter);
+			}
+		}
+
+		if(mPimpl->mFoldersToWatch.size() == 0)
+			stopMonitorAll();
+	}
+
+	void FolderMonitor::stopMonitorAll()
+	{
+		if(mPimpl->mWorkerThread != nullptr)
+		{
+			// Wake up the worker thread so it exits
+			char data = 0;
+			while (write(mPimpl->mShutdownPipe[1], &data, 1) == -1 && errno == EINTR)
+			{ }
+
+			mPimpl->mWorkerThread->join();
+			bs_delete(mPimpl->mWorkerThread);
+			mPimpl->mWorkerThread = nullptr;
+		}
+
+		for(auto& watchInfo : mPimpl->mFoldersToWatch)
+			bs_delete(watchInfo);
+
+		mPimpl->mFoldersToWatch.clear();
+		mPimpl->mWatches.clear();
+		mPimpl->mWatchHandles.clear();
+
+		// Closing the handle removes all of its watches
+		if(mPimpl->mInotifyHandle != -1)
+		{
+			close(mPimpl->mInotifyHandle);
+			mPimpl->mInotifyHandle = -1;
+		}
+
+		for(auto& handle : mPimpl->mShutdownPipe)
+		{
+			if(handle != -1)
+			{
+				close(handle);
+				handle = -1;
+			}
+		}
+	}
+
+	void FolderMonitor::addWatches(const String& folderPath, FolderWatchInfo* watchInfo)
+	{
+		INT32 watchHandle = inotify_add_watch(mPimpl->mInotifyHandle, folderPath.c_str(),
+			watchInfo->mMonitorFlags | IN_ONLYDIR);
+
+		if(watchHandle == -1)
+		{
+			// Most likely the folder was removed in the meantime, or we ran out of watches (ENOSPC), in which case the
+			// user needs to raise the fs.inotify.max_user_watches limit
+			if(errno != ENOENT)
+			{
+				LOGWRN("Unable to monitor folder \"" + folderPath + "\" for changes. Error: " +
+					String(strerror(errno)));
+			}
+
+			return;
+		}
+
+		// Adding a watch to an already watched folder returns the existing handle, in which case we just need to make sure
+		// the path is up to date
+		auto iterFind = mPimpl->mWatches.find(watchHandle);
+		if(iterFind != mPimpl->mWatches.end())
+			mPimpl->mWatchHandles.erase(iterFind->second.path);
+
+		mPimpl->mWatches[watchHandle] = { folderPath, watchInfo };
+		mPimpl->mWatchHandles[folderPath] = watchHandle;
+
+		if(!watchInfo->mMonitorSubdirectories)
+			return;
+
+		DIR* dir = opendir(folderPath.c_str());
+		if(dir == nullptr)
+			return;
+
+		while(dirent* entry = readdir(dir))
+		{
+			if(strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+				continue;
+
+			String childPath = folderPath + "/" + entry->d_name;
+
+			bool isDirectory = entry->d_type == DT_DIR;
+			if(entry->d_type == DT_UNKNOWN)
+			{
+				struct stat st;
+				isDirectory = lstat(childPath.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+			}
+
+			if(isDirectory)
+				addWatches(childPath, watchInfo);
+		}
+
+		closedir(dir);
+	}
+
+	void FolderMonitor::removeWatches(const String& folderPath)
+	{
+		for(auto iter = mPimpl->mWatches.begin(); iter != mPimpl->mWatches.end();)
+		{
+			if(isPathInFolder(iter->second.path, folderPath))
+			{
+				inotify_rm_watch(mPimpl->mInotifyHandle, iter->first);
+				mPimpl->mWatchHandles.erase(iter->second.path);
+				iter = mPimpl->mWatches.erase(iter);
+			}
+			else
+				++iter;
+		}
+	}
+
+	void FolderMonitor::workerThreadMain()
+	{
+		alignas(inotify_event) UINT8 buffer[READ_BUFFER_SIZE];
+
+		while(true)
+		{
+			pollfd fds[2];
+			fds[0].fd = mPimpl->mInotifyHandle;
+			fds[0].events = POLLIN;
+			fds[0].revents = 0;
+			fds[1].fd = mPimpl->mShutdownPipe[0];
+			fds[1].events = POLLIN;
+			fds[1].revents = 0;
+
+			if(poll(fds, 2, -1) == -1)
+			{
+				if(errno == EINTR)
+					continue;
+
+				LOGERR("Folder monitor stopped unexpectedly. Error: " + String(strerror(errno)));
+				break;
+			}
+
+			if((fds[1].revents & POLLIN) != 0)
+				break;
+
+			if((fds[0].revents & POLLIN) == 0)
+				continue;
+
+			// Drain everything that's available, so related events (e.g. both halves of a move) end up in the same batch
+			UINT32 numBytes = 0;
+			while(numBytes + sizeof(inotify_event) + NAME_MAX + 1 <= READ_BUFFER_SIZE)
+			{
+				ssize_t numRead = read(mPimpl->mInotifyHandle, buffer + numBytes, READ_BUFFER_SIZE - numBytes);
+				if(numRead <= 0)
+					break;
+
+				numBytes += (UINT32)numRead;
+			}
+
+			if(numBytes == 0)
+				continue;
+
+			FileNotifyInfo info(buffer, numBytes);
+			handleNotifications(info);
+		}
+	}
+
+	void FolderMonitor::handleNotifications(FileNotifyInfo& notifyInfo)
+	{
+		struct PendingMove
+		{
+			UINT32 cookie;
+			String path;
+			bool isDirectory;
+			bool report;
+		};
+
+		Vector<FileAction*> actions;
+		Vector<PendingMove> pendingMoves;
+
+		Lock lock(mPimpl->mMainMutex);
+
+		while(const inotify_event* event = notifyInfo.getNext())
+		{
+			// Kernel event queue overflowed and some events were lost. Report all root folders as modified so they get
+			// fully re-scanned, and re-add any sub-folder watches that might have been missed.
+			if((event->mask & IN_Q_OVERFLOW) != 0)
+			{
+				LOGWRN("Folder monitor event queue overflowed. Monitored folders will be fully refreshed.");
+
+				for(auto& watchInfo : mPimpl->mFoldersToWatch)
+				{
+					String rootPath = watchInfo->mFolderToMonitor.toString();
+					while (rootPath.size() > 1 && rootPath.back() == '/')
+						rootPath.pop_back();
+
+					addWatches(rootPath, watchInfo);
+					actions.push_back(bs_new<FileAction>(FileActionType::Modified, rootPath));
+				}
+
+				continue;
+			}
+
+			auto iterFind = mPimpl->mWatches.find(event->wd);
+			if(iterFind == mPimpl->mWatches.end())
+				continue;
+
+			if((event->mask & IN_IGNORED) != 0)
+			{
+				// Watch was removed, either explicitly or because the folder was deleted
+				mPimpl->mWatchHandles.erase(iterFind->second.path);
+				mPimpl->mWatches.erase(iterFind);
+				continue;
+			}
+
+			if(event->len == 0)
+				continue;
+
+			FolderWatchInfo* watchInfo = iterFind->second.owner;
+			String fullPath = iterFind->second.path + "/" + event->name;
+			bool isDirectory = (event->mask & IN_ISDIR) != 0;
+
+			// Ignore notifications about hidden files
+			bool report = event->name[0] != '.';
+
+			UINT32 nameFilter = isDirectory ? (UINT32)FolderChange::DirName : (UINT32)FolderChange::FileName;
+			bool reportNameChanges = report && (watchInfo->mChangeFilter & nameFilter) != 0;
+
+			if((event->mask & IN_CREATE) != 0)
+			{
+				if(isDirectory && watchInfo->mMonitorSubdirectories)
+					addWatches(fullPath, watchInfo);
+
+				if(reportNameChanges || (report && (watchInfo->mChangeFilter & (UINT32)FolderChange::Creation) != 0))
+					actions.push_back(bs_new<FileAction>(FileActionType::Added, fullPath));
+			}
+			else if((event->mask & IN_DELETE) != 0)
+			{
+				if(reportNameChanges)
+					actions.push_back(bs_new<FileAction>(FileActionType::Removed, fullPath));
+			}
+			else if((event->mask & IN_MOVED_FROM) != 0)
+			{
+				pendingMoves.push_back({ event->cookie, fullPath, isDirectory, reportNameChanges });
+			}
+			else if((event->mask & IN_MOVED_TO) != 0)
+			{
+				auto iterMove = std::find_if(pendingMoves.begin(), pendingMoves.end(),
+					[&](const PendingMove& x) { return x.cookie == event->cookie; });
+
+				if(iterMove != pendingMoves.end())
+				{
+					// Moved within the monitored folders, keep any existing sub-folder watches but update their paths
+					if(isDirectory)
+					{
+						const String& oldPath = iterMove->path;
+						for(auto& entry : mPimpl->mWatches)
+						{
+							String& path = entry.second.path;
+							if(!isPathInFolder(path, oldPath))
+								continue;
+
+							mPimpl->mWatchHandles.erase(path);
+							path = fullPath + path.substr(oldPath.size());
+							mPimpl->mWatchHandles[path] = entry.first;
+						}
+
+						if(watchInfo->mMonitorSubdirectories)
+							addWatches(fullPath, watchInfo);
+						else
+							removeWatches(fullPath);
+					}
+
+					if(reportNameChanges)
+						actions.push_back(bs_new<FileAction>(FileActionType::Renamed, fullPath, iterMove->path));
+
+					pendingMoves.erase(iterMove);
+				}
+				else
+				{
+					// Moved in from outside of the monitored folders
+					if(isDirectory && watchInfo->mMonitorSubdirectories)
+						addWatches(fullPath, watchInfo);
+
+					if(reportNameChanges || (report && (watchInfo->mChangeFilter & (UINT32)FolderChange::Creation) != 0))
+						actions.push_back(bs_new<FileAction>(FileActionType::Added, fullPath));
+				}
+			}
+			else if((event->mask & (IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_ACCESS)) != 0)
+			{
+				if(report)
+					actions.push_back(bs_new<FileAction>(FileActionType::Modified, fullPath));
+			}
+		}
+
+		// Anything moved without a matching destination was moved out of the monitored folders
+		for(auto& move : pendingMoves)
+		{
+			if(move.isDirectory)
+				removeWatches(move.path);
+
+			if(move.report)
+				actions.push_back(bs_new<FileAction>(FileActionType::Removed, move.path));
+		}
+
+		for(auto& action : actions)
+			mPimpl->mFileActions.push(action);
+	}
+
+	void FolderMonitor::_update()
+	{
+		{
+			Lock lock(mPimpl->mMainMutex);
+
+			while (!mPimpl->mFileActions.empty())
+			{
+				FileAction* action = mPimpl->mFileActions.front();
+				mPimpl->mFileActions.pop();
+
+				// Coalesce repeated modifications of the same file (e.g. a write being done in multiple chunks) with an
+				// action that's still waiting to be reported. The file is still being written to, so restart the check.
+				if (action->type == FileActionType::Modified)
+				{
+					auto iterFind = std::find_if(mPimpl->mActiveFileActions.begin(), mPimpl->mActiveFileActions.end(),
+						[&](const FileAction* x)
+					{
+						return (x->type == FileActionType::Added || x->type == FileActionType::Modified) &&
+							x->newName == action->newName;
+					});
+
+					if (iterFind != mPimpl->mActiveFileActions.end())
+					{
+						(*iterFind)->checkForWriteStarted = false;
+
+						bs_delete(action);
+						continue;
+					}
+				}
+
+				mPimpl->mActiveFileActions.push_back(action);
+			}
+		}
+
+		for (auto iter = mPimpl->mActiveFileActions.begin(); iter != mPimpl->mActiveFileActions.end();)
+		{
+			FileAction* action = *iter;
+
+			// Reported file actions might still be in progress (i.e. something might still be writing to those files), so
+			// wait until the file size stays the same for at least a couple of frames. See the Win32 implementation.
+			if (FileSystem::exists(action->newName))
+			{
+				UINT64 size = FileSystem::getFileSize(action->newName);
+				if (!action->checkForWriteStarted)
+				{
+					action->checkForWriteStarted = true;
+					action->lastSize = size;
+
+					++iter;
+					continue;
+				}
+				else
+				{
+					if (action->lastSize != size)
+					{
+						action->lastSize = size;
+						++iter;
+						continue;
+					}
+				}
+			}
+
+			switch (action->type)
+			{
+			case FileActionType::Added:
+				if (!onAdded.empty())
+					onAdded(Path(action->newName));
+				break;
+			case FileActionType::Removed:
+				if (!onRemoved.empty())
+					onRemoved(Path(action->newName));
+				break;
+			case FileActionType::Modified:
+				if (!onModified.empty())
+					onModified(Path(action->newName));
+				break;
+			case FileActionType::Renamed:
+				if (!onRenamed.empty())
+					onRenamed(Path(action->oldName), Path(action->newName));
+				break;
+			}
+
+			mPimpl->mActiveFileActions.erase(iter++);
+			bs_delete(action);
+		}
+	}
+}
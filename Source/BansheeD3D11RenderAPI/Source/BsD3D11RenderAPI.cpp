@@ -805,6 +805,7 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumDrawCalls);
 		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
+		BS_ADD_RENDER_STAT(NumInstances, std::max(instanceCount, 1U));
 	}
 
 	void D3D11RenderAPI::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount, 
@@ -847,6 +848,7 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumDrawCalls);
 		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
+		BS_ADD_RENDER_STAT(NumInstances, std::max(instanceCount, 1U));
 	}
 
 	void D3D11RenderAPI::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ, 
@@ -209,8 +209,21 @@ namespace bs { namespace ct
 			return;
 		}
 
+		UINT32 mipWidth, mipHeight, mipDepth;
+		PixelUtil::getSizeForMipLevel(mProperties.getWidth(), mProperties.getHeight(), mProperties.getDepth(),
+			mipLevel, mipWidth, mipHeight, mipDepth);
+
+		bool isPartial = src.getWidth() != mipWidth || src.getHeight() != mipHeight || src.getDepth() != mipDepth;
+
 		if ((mProperties.getUsage() & TU_DYNAMIC) != 0)
 		{
+			// Dynamic textures can only be mapped with discard
+			if (isPartial)
+			{
+				LOGERR("Writing to a part of a dynamic texture is not supported.");
+				return;
+			}
+
 			PixelData myData = lock(discardWholeBuffer ? GBL_WRITE_ONLY_DISCARD : GBL_WRITE_ONLY, mipLevel, face, 0, queueIdx);
 			PixelUtil::bulkPixelConversion(src, myData);
 			unlock();
@@ -221,10 +234,20 @@ namespace bs { namespace ct
 			D3D11Device& device = rs->getPrimaryDevice();
 
 			UINT subresourceIdx = D3D11CalcSubresource(mipLevel, face, mProperties.getNumMipmaps() + 1);
-			UINT32 rowWidth = D3D11Mappings::getSizeInBytes(format, src.getWidth());
-			UINT32 sliceWidth = D3D11Mappings::getSizeInBytes(format, src.getWidth(), src.getHeight());
-
-			device.getImmediateContext()->UpdateSubresource(mTex, subresourceIdx, nullptr, src.getData(), rowWidth, sliceWidth);
+			UINT32 rowWidth = D3D11Mappings::getSizeInBytes(format, src.getRowPitch());
+			UINT32 sliceWidth = D3D11Mappings::getSizeInBytes(format, src.getRowPitch(), 
+				src.getSlicePitch() / src.getRowPitch());
+
+			D3D11_BOX box;
+			box.left = src.getLeft();
+			box.top = src.getTop();
+			box.front = src.getFront();
+			box.right = src.getRight();
+			box.bottom = src.getBottom();
+			box.back = src.getBack();
+
+			device.getImmediateContext()->UpdateSubresource(mTex, subresourceIdx, isPartial ? &box : nullptr, 
+				src.getData(), rowWidth, sliceWidth);
 
 			if (device.hasError())
 			{
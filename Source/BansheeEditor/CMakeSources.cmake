@@ -31,6 +31,7 @@ set(BS_BANSHEEEDITOR_INC_SCENE
 	"Include/BsGizmoManager.h"
 	"Include/BsSceneGrid.h"
 	"Include/BsScenePicking.h"
+	"Include/BsPickingBVH.h"
 	"Include/BsSelection.h"
 	"Include/BsSelectionRenderer.h"
 )
@@ -133,6 +134,7 @@ set(BS_BANSHEEEDITOR_SRC_SCENEVIEW
 	"Source/BsSelectionRenderer.cpp"
 	"Source/BsSelection.cpp"
 	"Source/BsScenePicking.cpp"
+	"Source/BsPickingBVH.cpp"
 	"Source/BsSceneGrid.cpp"
 )
 
@@ -6,6 +6,7 @@
 #include "BsEditorCommand.h"
 #include "BsUndoRedo.h"
 #include "BsEditorUtility.h"
+#include "BsSceneObject.h"
 
 namespace bs
 {
@@ -16,6 +17,11 @@ namespace bs
 	/**
 	 * A command used for undo/redo purposes. It records a state of the entire scene object at a specific point and allows
 	 * you to restore it to its original values as needed.
+	 *
+	 * Once the edit is done (a new command is registered, or the command is reverted) the recorded state is compacted into
+	 * per-component differences between the states before and after the edit, so only the modified fields are kept in
+	 * the undo stack. If the edit changed the structure of the object (added or removed components or children) the full
+	 * state is kept instead.
 	 */
 	class BS_ED_EXPORT CmdRecordSO : public EditorCommand
 	{
@@ -39,26 +45,121 @@ namespace bs
 		/** @copydoc EditorCommand::revert */
 		void revert() override;
 
+		/** @copydoc EditorCommand::getSize */
+		UINT32 getSize() const override;
+
 	private:
 		friend class UndoRedo;
 
+		/** Determines in which form is the recorded state currently stored. */
+		enum class State
+		{
+			Empty, /**< Nothing is recorded. */
+			Recording, /**< Object state before the edit is recorded, the edit is potentially still ongoing. */
+			Full, /**< Full object state before the edit is stored. */
+			Delta /**< Only differences between the states before and after the edit are stored. */
+		};
+
+		/** Scene object properties that are recorded directly, rather than through serialization. */
+		struct SOProperties
+		{
+			String name;
+			Vector3 position;
+			Quaternion rotation;
+			Vector3 scale;
+			ObjectMobility mobility;
+			bool active;
+
+			bool operator==(const SOProperties& rhs) const;
+		};
+
+		/** State of a single recorded scene object, excluding its children. */
+		struct SOState
+		{
+			HSceneObject sceneObject;
+			SOProperties properties;
+			String prefabLink;
+			SPtr<PrefabDiff> prefabDiff;
+
+			Vector<HComponent> components;
+			Vector<SPtr<SerializedObject>> componentData;
+		};
+
+		/** Serialized difference between two states of an object. */
+		struct EncodedDiff
+		{
+			UINT8* data = nullptr;
+			UINT32 size = 0;
+		};
+
+		/** Differences in a single component's state before and after the edit. */
+		struct ComponentDelta
+		{
+			HComponent component;
+			EncodedDiff undo;
+			EncodedDiff redo;
+		};
+
+		/** Differences in a single scene object's state before and after the edit, excluding its children. */
+		struct SODelta
+		{
+			HSceneObject sceneObject;
+			SOProperties undoProperties;
+			SOProperties redoProperties;
+			bool propertiesChanged;
+
+			Vector<ComponentDelta> components;
+		};
+
 		CmdRecordSO(const WString& description, const HSceneObject& sceneObject, bool recordHierarchy);
 
+		/** @copydoc EditorCommand::compact */
+		void compact() override;
+
+		/** @copydoc EditorCommand::merge */
+		bool merge(const EditorCommand& command) override;
+
 		/**
 		 * Saves the state of the specified object, all of its children and components. Make sure to call clear() when you
 		 * no longer need the data, or wish to call this method again.
 		 */
 		void recordSO(const HSceneObject& sceneObject);
 
+		/**
+		 * Records the current state of the scene object and its components into @p output. If recording the hierarchy
+		 * the state of all the child objects is recorded as well.
+		 */
+		void recordState(const HSceneObject& sceneObject, Vector<SOState>& output) const;
+
+		/** Checks can the differences between the two recorded states be represented using per-component deltas. */
+		static bool canRecordDelta(const Vector<SOState>& before, const Vector<SOState>& after);
+
+		/** Applies the previously recorded deltas, either reverting the edit or re-applying it. */
+		void applyDelta(bool undo);
+
+		/** Restores the full recorded object state, replacing the current scene object. */
+		void restoreFull();
+
 		/**	Clears all the stored data and frees memory. */
 		void clear();
 
 		HSceneObject mSceneObject;
 		EditorUtility::SceneObjProxy mSceneObjectProxy;
 		bool mRecordHierarchy;
+		State mState;
+		float mLastRecordTime;
 
 		UINT8* mSerializedObject;
 		UINT32 mSerializedObjectSize;
+
+		Vector<SOState> mRecordedState;
+		Vector<SODelta> mDeltas;
+
+		/** 
+		 * Maximum time in seconds between two records of the same object that will be merged into a single command. Allows
+		 * continuous edits (e.g. dragging a slider or a handle) to be undone in a single step.
+		 */
+		static const float MERGE_INTERVAL;
 	};
 
 	/** @} */
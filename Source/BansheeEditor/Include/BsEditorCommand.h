@@ -26,6 +26,12 @@ namespace bs
 		/** Reverts the command, reverting the change previously done with commit(). */
 		virtual void revert() { }
 
+		/** 
+		 * Returns the approximate amount of memory used by the command, in bytes. Used for limiting the total size of the
+		 * undo/redo stacks.
+		 */
+		virtual UINT32 getSize() const { return 0; }
+
 	private:
 		friend class UndoRedo;
 
@@ -35,7 +41,23 @@ namespace bs
 		/** Triggers when a command is removed from an undo/redo stack. */
 		virtual void onCommandRemoved() {}
 
+		/** 
+		 * Triggers when the change recorded by the command is done, either because a new command was registered on top
+		 * of it, or because the command is being reverted. Commands can use this to convert any recorded data into a
+		 * more compact form.
+		 */
+		virtual void compact() { }
+
+		/** 
+		 * Attempts to merge a newly registered command into this command, if they both record the same ongoing change.
+		 * If the method returns true the new command is discarded instead of being added to the undo stack.
+		 */
+		virtual bool merge(const EditorCommand& command) { return false; }
+
+	protected:
 		WString mDescription;
+
+	private:
 		UINT32 mId;
 	};
 
@@ -93,6 +93,18 @@ namespace bs
 
 		/**	Tests the frame allocator. */
 		void TestFrameAlloc();
+
+		/**
+		 * Tests that cached GUI layout updates produce the same results as a full layout, and reports layout times for a
+		 * large hierarchy.
+		 */
+		void TestGUILayout();
+
+		/**
+		 * Tests that SIMD versions of pixel format conversion, scaling and mirroring produce the same results as their
+		 * scalar versions, and reports the time taken by each version.
+		 */
+		void TestPixelUtilSIMD();
 	};
 
 	/** @} */
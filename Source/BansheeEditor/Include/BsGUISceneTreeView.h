@@ -23,7 +23,10 @@ namespace bs
 		HSceneObject* objects;
 	};
 
-	/** GUI element that displays all SceneObject%s in the current scene in the active project in a tree view. */
+	/** 
+	 * GUI element that displays all SceneObject%s in the current scene in the active project in a tree view. The tree view
+	 * listens to scene hierarchy modifications and only updates the elements whose objects were modified.
+	 */
 	class BS_ED_EXPORT GUISceneTreeView : public GUITreeView
 	{
 		/**	Tree element with SceneObject%-specific data. */
@@ -131,10 +134,19 @@ namespace bs
 			const String& editBoxStyle, const String& dragHighlightStyle, const String& dragSepHighlightStyle, const GUIDimensions& dimensions);
 
 		/**
-		 * Checks it the SceneObject referenced by this tree element changed in any way and updates the tree element. This
-		 * can involve recursing all children and updating them as well.
+		 * Checks it the SceneObject referenced by this tree element changed in any way and updates the tree element.
+		 *
+		 * @param[in]	element		Element to update.
+		 * @param[in]	recursive	If true, all children will be updated as well. Otherwise only the newly added children
+		 *							will be.
 		 */
-		void updateTreeElement(SceneTreeElement* element);
+		void updateTreeElement(SceneTreeElement* element, bool recursive);
+
+		/** Sorts the children of the provided tree element by their name. */
+		void sortChildren(SceneTreeElement* element);
+
+		/** Triggered by the scene manager whenever a scene object is added, removed or modified. */
+		void onHierarchyModified(const HSceneObject& so);
 
 		/**
 		 * Triggered when a drag and drop operation that was started by the tree view ends, regardless if it was processed
@@ -193,6 +205,10 @@ namespace bs
 		Vector<HSceneObject> mCopyList;
 		bool mCutFlag;
 
+		UnorderedMap<UINT64, SceneTreeElement*> mElementLookup;
+		UnorderedSet<UINT64> mDirtyObjects;
+		HEvent mHierarchyModifiedConn;
+
 		static const Color PREFAB_TINT;
 	};
 
@@ -21,6 +21,10 @@ namespace bs
 	 *
 	 * This class is abstract and meant to be extended by an implementation specific to some content type (for example scene
 	 * object hierarchy). 
+	 *
+	 * GUI elements are only created for tree elements that are within the visible area of the tree view (for example the
+	 * visible portion of a parent scroll area), so the cost of the tree view doesn't grow with the number of elements it
+	 * contains.
 	 */
 	class BS_ED_EXPORT GUITreeView : public GUIElementContainer
 	{
@@ -37,7 +41,7 @@ namespace bs
 
 		/**
 		 * Contains data about a single piece of content and all its children. This element may be visible and represented
-		 * by a GUI element, but might not (for example its parent is collapsed).
+		 * by a GUI element, but might not (for example its parent is collapsed, or it is scrolled out of view).
 		 */
 		struct TreeElement
 		{
@@ -52,6 +56,9 @@ namespace bs
 
 			String mName;
 
+			Vector2I mOptimalSize; /**< Optimal size of the element's label. Only valid if the element is visible. */
+			Rect2I mArea; /**< Area of the element's label, as of the last layout update. */
+
 			UINT32 mSortedIdx;
 			bool mIsExpanded;
 			bool mIsSelected;
@@ -70,16 +77,17 @@ namespace bs
 		 */
 		struct InteractableElement
 		{
-			InteractableElement(TreeElement* parent, UINT32 index, const Rect2I& bounds)
-				:parent(parent), index(index), bounds(bounds)
+			InteractableElement(TreeElement* parent, UINT32 index, const Rect2I& bounds, TreeElement* element = nullptr)
+				:parent(parent), index(index), bounds(bounds), element(element)
 			{ }
 
 			bool isTreeElement() const { return index % 2 == 1; }
-			TreeElement* getTreeElement() const;
+			TreeElement* getTreeElement() const { return element; }
 
 			TreeElement* parent;
 			UINT32 index;
 			Rect2I bounds;
+			TreeElement* element;
 		};
 
 		/**	Contains data about one of the currently selected tree elements. */
@@ -150,6 +158,9 @@ namespace bs
 		/** @copydoc GUIElement::_commandEvent */
 		bool _commandEvent(const GUICommandEvent& ev) override;
 
+		/** @copydoc GUIElement::_changeParentWidget */
+		void _changeParentWidget(GUIWidget* widget) override;
+
 		/**
 		 * Attempts to find an interactable element under the specified coordinates. Returns null if one cannot be found.
 		 *
@@ -234,9 +245,24 @@ namespace bs
 		/**	Collapses the provided TreeElement making its children hidden and not interactable. */
 		void collapseElement(TreeElement* element);
 
-		/**	Rebuilds the needed GUI elements for the provided TreeElement. */
+		/**
+		 * Refreshes the provided TreeElement after its contents or visibility changed. Updates its GUI elements if it has
+		 * any, or destroys them if the element is no longer visible.
+		 */
 		void updateElementGUI(TreeElement* element);
 
+		/** Creates GUI elements for the provided TreeElement. Called when the element comes into view. */
+		void createElementGUI(TreeElement* element);
+
+		/** Destroys GUI elements of the provided TreeElement, if it has any. */
+		void destroyElementGUI(TreeElement* element);
+
+		/** Updates the contents, tint and foldout button of the provided TreeElement's GUI elements. */
+		void refreshElementGUI(TreeElement* element);
+
+		/** Calculates the optimal size of the label displaying the provided TreeElement. */
+		Vector2I calculateElementSize(const TreeElement* element) const;
+
 		/**	Close any elements that were temporarily expanded due to a drag operation hovering over them. */
 		void closeTemporarilyExpandedElements();
 
@@ -240,6 +240,9 @@ namespace bs
 		 */
 		HSceneObject getSceneObject(UINT32 gizmoIdx);
 
+		/** Checks are there any gizmos queued for drawing that can be selected by the user. */
+		bool hasPickableGizmos() const;
+
 		/** @name Internal
 		 *  @{
 		 */
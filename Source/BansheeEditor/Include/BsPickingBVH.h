@@ -0,0 +1,180 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "BsAABox.h"
+#include "BsVector3.h"
+
+namespace bs
+{
+	class ConvexVolume;
+
+	/** @addtogroup Scene-Editor-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Bounding volume hierarchy over a dynamic set of axis aligned boxes. Boxes can be inserted, removed and moved
+	 * individually without rebuilding the hierarchy. Each box is stored slightly enlarged, so small movements don't
+	 * require the hierarchy to be modified at all.
+	 */
+	class BS_ED_EXPORT DynamicBVH
+	{
+		/** A single node in the hierarchy. Leaf nodes reference a single box, other nodes always have two children. */
+		struct Node
+		{
+			AABox bounds;
+			UINT32 parent;
+			UINT32 children[2];
+			UINT32 height;
+			UINT32 userData;
+
+			bool isLeaf() const { return children[0] == INVALID_NODE; }
+		};
+
+	public:
+		DynamicBVH();
+
+		/**
+		 * Inserts a new box into the hierarchy.
+		 *
+		 * @param[in]	bounds		Bounds of the object to insert.
+		 * @param[in]	userData	Arbitrary value to associate with the box, returned by the queries.
+		 * @return					Identifier of the box, to be used with update() and remove().
+		 */
+		UINT32 insert(const AABox& bounds, UINT32 userData);
+
+		/** Removes a box previously inserted with insert(). */
+		void remove(UINT32 id);
+
+		/**
+		 * Updates the bounds of a box previously inserted with insert(). Returns true if the hierarchy needed to be
+		 * modified, or false if the new bounds still fit within the stored (enlarged) bounds.
+		 */
+		bool update(UINT32 id, const AABox& bounds);
+
+		/** Returns user data for a box previously inserted with insert(). */
+		UINT32 getUserData(UINT32 id) const { return mNodes[id].userData; }
+
+		/**
+		 * Finds all boxes intersected by the provided ray and outputs their user data. Boxes are tested using their
+		 * enlarged bounds, so the caller should perform a more precise test on the returned objects.
+		 */
+		void intersects(const Ray& ray, Vector<UINT32>& output) const;
+
+		/**
+		 * Finds all boxes intersecting or contained within the provided volume and outputs their user data. Boxes are
+		 * tested using their enlarged bounds, so the caller should perform a more precise test on the returned objects.
+		 */
+		void intersects(const ConvexVolume& volume, Vector<UINT32>& output) const;
+
+		/** Removes all boxes from the hierarchy. */
+		void clear();
+
+	private:
+		/** Returns a new node from the free list, allocating more nodes if needed. */
+		UINT32 allocateNode();
+
+		/** Returns the node to the free list. */
+		void freeNode(UINT32 idx);
+
+		/** Inserts a leaf node into the hierarchy, finding the sibling that results in the smallest hierarchy cost. */
+		void insertLeaf(UINT32 leaf);
+
+		/** Removes a leaf node from the hierarchy, without freeing it. */
+		void removeLeaf(UINT32 leaf);
+
+		/** Recalculates bounds and heights of all the ancestors of the provided node, re-balancing them as needed. */
+		void refit(UINT32 idx);
+
+		/**
+		 * Performs a tree rotation on the provided node if its children heights differ by more than one. Returns the index
+		 * of the node now at the position of the provided node.
+		 */
+		UINT32 balance(UINT32 idx);
+
+		/** Returns the surface area of the provided box, used as the cost metric when building the hierarchy. */
+		static float getArea(const AABox& box);
+
+		/** Returns the box that encloses both provided boxes. */
+		static AABox merge(const AABox& a, const AABox& b);
+
+		static const UINT32 INVALID_NODE;
+
+		/** Relative amount to enlarge the inserted boxes by, in order to reduce the number of hierarchy updates. */
+		static const float BOUNDS_MARGIN;
+
+		Vector<Node> mNodes;
+		UINT32 mRoot;
+		UINT32 mFreeList;
+	};
+
+	/**
+	 * Bounding volume hierarchy over triangles of a single mesh, allowing quick ray intersection tests against the
+	 * mesh geometry.
+	 */
+	class BS_ED_EXPORT TriangleBVH
+	{
+		/**
+		 * A single node in the hierarchy. Leaf nodes reference a range of triangles, other nodes have two children, with
+		 * the first child always directly following the parent.
+		 */
+		struct Node
+		{
+			AABox bounds;
+			UINT32 start; /**< First triangle for leaf nodes, or the second child index for interior nodes. */
+			UINT32 count; /**< Number of triangles for leaf nodes, or zero for interior nodes. */
+		};
+
+	public:
+		TriangleBVH() { }
+
+		/**
+		 * Builds the hierarchy from the provided geometry.
+		 *
+		 * @param[in]	positions		Pointer to the first vertex position.
+		 * @param[in]	stride			Offset between two vertex positions, in bytes.
+		 * @param[in]	numVertices		Number of vertices.
+		 * @param[in]	indices			Pointer to the first index, as 16- or 32-bit values.
+		 * @param[in]	numIndices		Number of indices. Every three indices form a triangle.
+		 * @param[in]	indexSize		Size of a single index, in bytes (2 or 4).
+		 */
+		void build(const UINT8* positions, UINT32 stride, UINT32 numVertices, const UINT8* indices, UINT32 numIndices,
+			UINT32 indexSize);
+
+		/**
+		 * Finds the closest triangle intersected by the provided ray.
+		 *
+		 * @param[in]	ray			Ray to test, in the same space as the geometry the hierarchy was built with.
+		 * @param[out]	distance	Distance along the ray to the intersection.
+		 * @param[out]	normal		Normal of the intersected triangle, facing towards the ray origin.
+		 * @return					True if any triangle was intersected.
+		 */
+		bool intersects(const Ray& ray, float& distance, Vector3& normal) const;
+
+		/** Checks does the hierarchy contain any geometry. */
+		bool isEmpty() const { return mNodes.empty(); }
+
+	private:
+		/**
+		 * Calculates bounds of the provided node and splits it, recursively building the hierarchy below it.
+		 *
+		 * @param[in]	nodeIdx		Index of the node to split.
+		 * @param[in]	triangles	Vertex indices of all triangles, three per triangle.
+		 * @param[in]	order		Order of triangles referenced by the node ranges. Reordered as the nodes are split.
+		 * @param[in]	centroids	Centroid of every triangle.
+		 */
+		void split(UINT32 nodeIdx, const Vector<UINT32>& triangles, Vector<UINT32>& order, 
+			const Vector<Vector3>& centroids);
+
+		/** Maximum number of triangles in a leaf node. */
+		static const UINT32 MAX_LEAF_TRIANGLES;
+
+		Vector<Vector3> mPositions;
+		Vector<UINT32> mTriangles;
+		Vector<Node> mNodes;
+	};
+
+	/** @} */
+}
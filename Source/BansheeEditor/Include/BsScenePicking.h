@@ -7,6 +7,9 @@
 #include "BsMatrix4.h"
 #include "BsGpuParam.h"
 #include "BsParamBlocks.h"
+#include "BsPickingBVH.h"
+#include "BsConvexVolume.h"
+#include "BsAsyncOp.h"
 
 namespace bs
 {
@@ -31,7 +34,14 @@ namespace bs
 
 	namespace ct { class ScenePicking; }
 
-	/**	Handles picking of scene objects with a pointer in scene view. */
+	/**
+	 * Handles picking of scene objects with a pointer in scene view.
+	 *
+	 * Renderables are picked on the CPU, using a bounding volume hierarchy over their world bounds and per-mesh triangle
+	 * hierarchies built from CPU copies of the mesh data. The GPU is only used for objects that cannot be resolved on the
+	 * CPU (e.g. alpha tested materials, or meshes whose data isn't available yet), for gizmos, and for selecting the
+	 * visible objects in an area. Even then only the renderables overlapping the picked area are rendered.
+	 */
 	class BS_ED_EXPORT ScenePicking : public Module<ScenePicking>
 	{
 		/**	Contains information about a single pickable item (mesh). */
@@ -45,6 +55,31 @@ namespace bs
 			HTexture mainTexture;
 		};
 
+		/** Information about a renderable stored in the CPU picking hierarchy. */
+		struct PickableRenderable
+		{
+			SPtr<Renderable> renderable;
+			HSceneObject sceneObject;
+			Mesh* mesh;
+			AABox worldBounds;
+			Matrix4 worldTransform;
+			UINT32 transformHash;
+			UINT32 bvhId;
+			UINT64 updateIdx;
+		};
+
+		/** CPU copy of the mesh geometry, used for testing rays against individual mesh triangles. */
+		struct MeshPickData
+		{
+			std::weak_ptr<Mesh> mesh;
+			Vector<TriangleBVH> subMeshes;
+			bool isSupported = true;
+
+			/** Mesh data being read from the GPU, for meshes without a CPU cached copy. */
+			SPtr<MeshData> pendingData;
+			AsyncOp pendingReadOp;
+		};
+
 	public:
 		ScenePicking();
 		~ScenePicking();
@@ -84,6 +119,43 @@ namespace bs
 
 		typedef Set<RenderablePickData, std::function<bool(const RenderablePickData&, const RenderablePickData&)>> RenderableSet;
 
+		/** 
+		 * Updates the CPU picking hierarchy with any renderables that were added, removed or moved since the last call. 
+		 */
+		void updatePickables();
+
+		/**
+		 * Attempts to find the closest renderable under the provided position, using only the CPU.
+		 *
+		 * @param[in]	ray					Ray to test, in world space.
+		 * @param[in]	ignoreRenderables	A list of objects that should be ignored during scene picking.
+		 * @param[out]	closest				Index of the closest renderable in mPickables, or -1 if none was found.
+		 * @param[out]	distance			Distance to the closest renderable along the ray.
+		 * @param[out]	normal				Normal of the closest renderable surface, in its local space.
+		 * @param[out]	unresolved			Renderables closer than the returned one that could not be tested on the CPU.
+		 */
+		void pickClosestRenderable(const Ray& ray, const Vector<HSceneObject>& ignoreRenderables, UINT32& closest,
+			float& distance, Vector3& normal, Vector<UINT32>& unresolved);
+
+		/**
+		 * Renders the provided renderables and any pickable gizmos into an ID target on the GPU, and returns the objects
+		 * under the provided area.
+		 */
+		Vector<HSceneObject> pickObjectsGPU(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area,
+			const Vector<UINT32>& renderables, SnapData* data);
+
+		/**
+		 * Returns triangle hierarchies for the provided mesh, or null if they aren't available (yet). Mesh data is read
+		 * from the CPU cached copy if the mesh has one, otherwise it is read from the GPU asynchronously.
+		 */
+		SPtr<MeshPickData> getMeshPickData(const HMesh& mesh);
+
+		/** Checks can all the triangles of the provided renderable be tested on the CPU. */
+		static bool isOpaque(const Renderable& renderable);
+
+		/** Returns a volume encompassing the part of the camera frustum covered by the provided screen area. */
+		static ConvexVolume getAreaVolume(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area);
+
 		/**	Encodes a pickable object identifier to a unique color. */
 		static Color encodeIndex(UINT32 index);
 
@@ -91,6 +163,14 @@ namespace bs
 		static UINT32 decodeIndex(Color color);
 
 		ct::ScenePicking* mCore;
+
+		DynamicBVH mPickableBVH;
+		Vector<PickableRenderable> mPickables;
+		Vector<UINT32> mFreePickables;
+		UnorderedMap<Renderable*, UINT32> mPickableLookup;
+		UINT64 mUpdateIdx = 0;
+
+		UnorderedMap<Mesh*, SPtr<MeshPickData>> mMeshPickData;
 	};
 
 	/** @} */
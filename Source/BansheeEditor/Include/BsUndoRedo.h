@@ -52,8 +52,15 @@ namespace bs
 		 */
 		void popGroup(const String& name);
 
-		/**	Registers a new undo command. */
-		void registerCommand(const SPtr<EditorCommand>& command);
+		/**
+		 * Registers a new undo command. 
+		 *
+		 * @param[in]	command		Command to register.
+		 * @return					True if the command was added to the undo stack, or false if it was merged with the
+		 *							command currently on top of the stack (see EditorCommand::merge), in which case the
+		 *							new command should not be committed.
+		 */
+		bool registerCommand(const SPtr<EditorCommand>& command);
 
 		/**	Returns the unique identifier for the command on top of the undo stack. */
 		UINT32 getTopCommandId() const;
@@ -68,6 +75,13 @@ namespace bs
 		/**	Resets the undo/redo stacks. */
 		void clear();
 
+		/**
+		 * Sets the maximum amount of memory the commands on the undo/redo stacks are allowed to use, in bytes. When the 
+		 * limit is exceeded the oldest commands are removed from the undo stack. The most recent command is always kept,
+		 * regardless of its size.
+		 */
+		void setMemoryLimit(UINT64 bytes);
+
 	private:
 		/**	Removes the last undo command from the undo stack, and returns it. */
 		SPtr<EditorCommand> removeLastFromUndoStack();
@@ -81,7 +95,11 @@ namespace bs
 		/**	Removes all entries from the redo stack. */
 		void clearRedoStack();
 
+		/** Removes the oldest entries from the undo stack until the memory used by the commands is within the limit. */
+		void enforceMemoryLimit();
+
 		static const UINT32 MAX_STACK_ELEMENTS;
+		static const UINT64 DEFAULT_MEMORY_LIMIT;
 
 		SPtr<EditorCommand>* mUndoStack;
 		SPtr<EditorCommand>* mRedoStack;
@@ -93,6 +111,7 @@ namespace bs
 		UINT32 mRedoNumElements;
 
 		UINT32 mNextCommandId;
+		UINT64 mMemoryLimit;
 
 		Stack<GroupData> mGroups;
 	};
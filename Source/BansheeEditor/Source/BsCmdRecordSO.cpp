@@ -4,12 +4,25 @@
 #include "BsSceneObject.h"
 #include "BsComponent.h"
 #include "BsMemorySerializer.h"
+#include "BsBinarySerializer.h"
+#include "BsBinaryDiff.h"
+#include "BsSerializedObject.h"
+#include "BsRTTIType.h"
+#include "BsTime.h"
 
 namespace bs
 {
+	const float CmdRecordSO::MERGE_INTERVAL = 0.5f;
+
+	bool CmdRecordSO::SOProperties::operator==(const SOProperties& rhs) const
+	{
+		return name == rhs.name && position == rhs.position && rotation == rhs.rotation && scale == rhs.scale &&
+			mobility == rhs.mobility && active == rhs.active;
+	}
+
 	CmdRecordSO::CmdRecordSO(const WString& description, const HSceneObject& sceneObject, bool recordHierarchy)
-		: EditorCommand(description), mSceneObject(sceneObject), mRecordHierarchy(recordHierarchy)
-		, mSerializedObject(nullptr), mSerializedObjectSize(0)
+		: EditorCommand(description), mSceneObject(sceneObject), mRecordHierarchy(recordHierarchy), mState(State::Empty)
+		, mLastRecordTime(0.0f), mSerializedObject(nullptr), mSerializedObjectSize(0)
 	{
 
 	}
@@ -29,20 +42,40 @@ namespace bs
 			bs_free(mSerializedObject);
 			mSerializedObject = nullptr;
 		}
+
+		for (auto& delta : mDeltas)
+		{
+			for (auto& componentDelta : delta.components)
+			{
+				bs_free(componentDelta.undo.data);
+				bs_free(componentDelta.redo.data);
+			}
+		}
+
+		mRecordedState.clear();
+		mDeltas.clear();
+		mState = State::Empty;
 	}
 
 	void CmdRecordSO::execute(const HSceneObject& sceneObject, bool recordHierarchy, const WString& description)
 	{
-		// Register command and commit it
+		// Register command and commit it, unless it was merged with the previous record of the same object
 		CmdRecordSO* command = new (bs_alloc<CmdRecordSO>()) CmdRecordSO(description, sceneObject, recordHierarchy);
 		SPtr<CmdRecordSO> commandPtr = bs_shared_ptr(command);
 
-		UndoRedo::instance().registerCommand(commandPtr);
-		commandPtr->commit();
+		if (UndoRedo::instance().registerCommand(commandPtr))
+			commandPtr->commit();
 	}
 
 	void CmdRecordSO::commit()
 	{
+		// Re-applying the change after it was reverted
+		if (mState == State::Delta)
+		{
+			applyDelta(false);
+			return;
+		}
+
 		clear();
 
 		if (mSceneObject == nullptr || mSceneObject.isDestroyed())
@@ -56,6 +89,174 @@ namespace bs
 		if (mSceneObject == nullptr || mSceneObject.isDestroyed())
 			return;
 
+		compact();
+
+		if (mState == State::Delta)
+			applyDelta(true);
+		else if (mState == State::Full)
+			restoreFull();
+	}
+
+	UINT32 CmdRecordSO::getSize() const
+	{
+		UINT32 size = sizeof(*this) + mSerializedObjectSize;
+
+		// Recorded state isn't counted here, as it's only present while the change is ongoing
+		for (auto& delta : mDeltas)
+		{
+			size += sizeof(SODelta);
+			for (auto& componentDelta : delta.components)
+				size += sizeof(ComponentDelta) + componentDelta.undo.size + componentDelta.redo.size;
+		}
+
+		return size;
+	}
+
+	bool CmdRecordSO::merge(const EditorCommand& command)
+	{
+		if (mState != State::Recording)
+			return false;
+
+		const CmdRecordSO* other = dynamic_cast<const CmdRecordSO*>(&command);
+		if (other == nullptr)
+			return false;
+
+		if (other->mSceneObject != mSceneObject || other->mRecordHierarchy != mRecordHierarchy || 
+			other->mDescription != mDescription)
+			return false;
+
+		float time = gTime().getTime();
+		if ((time - mLastRecordTime) > MERGE_INTERVAL)
+			return false;
+
+		// State recorded by this command is still the state before the change, so the new record can be ignored
+		mLastRecordTime = time;
+		return true;
+	}
+
+	void CmdRecordSO::compact()
+	{
+		if (mState != State::Recording)
+			return;
+
+		// Object could still be restored by another command (e.g. undoing its deletion), so keep the full state
+		if (mSceneObject.isDestroyed())
+		{
+			mRecordedState.clear();
+			mState = State::Full;
+			return;
+		}
+
+		Vector<SOState> currentState;
+		recordState(mSceneObject, currentState);
+
+		if (!canRecordDelta(mRecordedState, currentState))
+		{
+			mRecordedState.clear();
+			mState = State::Full;
+			return;
+		}
+
+		auto encodeDiff = [](const SPtr<SerializedObject>& diff)
+		{
+			EncodedDiff output;
+
+			MemorySerializer serializer;
+			output.data = serializer.encode(diff.get(), output.size);
+
+			return output;
+		};
+
+		for (UINT32 i = 0; i < (UINT32)currentState.size(); i++)
+		{
+			const SOState& before = mRecordedState[i];
+			const SOState& after = currentState[i];
+
+			SODelta delta;
+			delta.sceneObject = after.sceneObject;
+			delta.undoProperties = before.properties;
+			delta.redoProperties = after.properties;
+			delta.propertiesChanged = !(before.properties == after.properties);
+
+			for (UINT32 j = 0; j < (UINT32)after.components.size(); j++)
+			{
+				const HComponent& component = after.components[j];
+				IDiff& diffHandler = component->getRTTI()->getDiffHandler();
+
+				SPtr<SerializedObject> undoDiff = diffHandler.generateDiff(after.componentData[j], 
+					before.componentData[j]);
+
+				if (undoDiff == nullptr)
+					continue;
+
+				SPtr<SerializedObject> redoDiff = diffHandler.generateDiff(before.componentData[j], 
+					after.componentData[j]);
+
+				ComponentDelta componentDelta;
+				componentDelta.component = component;
+				componentDelta.undo = encodeDiff(undoDiff);
+
+				if(redoDiff != nullptr)
+					componentDelta.redo = encodeDiff(redoDiff);
+
+				delta.components.push_back(componentDelta);
+			}
+
+			if (delta.propertiesChanged || !delta.components.empty())
+				mDeltas.push_back(delta);
+		}
+
+		// Full state is no longer needed
+		bs_free(mSerializedObject);
+		mSerializedObject = nullptr;
+		mSerializedObjectSize = 0;
+
+		mRecordedState.clear();
+		mState = State::Delta;
+	}
+
+	void CmdRecordSO::applyDelta(bool undo)
+	{
+		// Diffs may contain game object handles that need to be resolved
+		GameObjectManager::instance().startDeserialization();
+
+		for (auto& delta : mDeltas)
+		{
+			if (delta.sceneObject.isDestroyed())
+				continue;
+
+			if (delta.propertiesChanged)
+			{
+				const SOProperties& properties = undo ? delta.undoProperties : delta.redoProperties;
+
+				delta.sceneObject->setName(properties.name);
+				delta.sceneObject->setPosition(properties.position);
+				delta.sceneObject->setRotation(properties.rotation);
+				delta.sceneObject->setScale(properties.scale);
+				delta.sceneObject->setMobility(properties.mobility);
+				delta.sceneObject->setActive(properties.active);
+			}
+
+			for (auto& componentDelta : delta.components)
+			{
+				const EncodedDiff& diff = undo ? componentDelta.undo : componentDelta.redo;
+				if (diff.data == nullptr || componentDelta.component.isDestroyed())
+					continue;
+
+				MemorySerializer serializer;
+				SPtr<SerializedObject> diffData = 
+					std::static_pointer_cast<SerializedObject>(serializer.decode(diff.data, diff.size));
+
+				IDiff& diffHandler = componentDelta.component->getRTTI()->getDiffHandler();
+				diffHandler.applyDiff(componentDelta.component.getInternalPtr(), diffData);
+			}
+		}
+
+		GameObjectManager::instance().endDeserialization();
+	}
+
+	void CmdRecordSO::restoreFull()
+	{
 		HSceneObject parent = mSceneObject->getParent();
 
 		UINT32 numChildren = mSceneObject->getNumChildren();
@@ -91,6 +292,9 @@ namespace bs
 		}
 
 		restored->_instantiate();
+
+		// Restored object was re-created from the full state, so it needs to be recorded from scratch if re-applied
+		clear();
 	}
 
 	void CmdRecordSO::recordSO(const HSceneObject& sceneObject)
@@ -128,5 +332,60 @@ namespace bs
 
 			bs_stack_delete(children, numChildren);
 		}
+
+		recordState(mSceneObject, mRecordedState);
+
+		mLastRecordTime = gTime().getTime();
+		mState = State::Recording;
+	}
+
+	void CmdRecordSO::recordState(const HSceneObject& sceneObject, Vector<SOState>& output) const
+	{
+		output.push_back(SOState());
+		SOState& state = output.back();
+
+		state.sceneObject = sceneObject;
+		state.properties.name = sceneObject->getName();
+		state.properties.position = sceneObject->getPosition();
+		state.properties.rotation = sceneObject->getRotation();
+		state.properties.scale = sceneObject->getScale();
+		state.properties.mobility = sceneObject->getMobility();
+		state.properties.active = sceneObject->getActive(true);
+		state.prefabLink = sceneObject->_getPrefabLinkUUID();
+		state.prefabDiff = sceneObject->_getPrefabDiff();
+
+		BinarySerializer serializer;
+		for (auto& component : sceneObject->getComponents())
+		{
+			state.components.push_back(component);
+			state.componentData.push_back(serializer._encodeToIntermediate(component.get()));
+		}
+
+		if (!mRecordHierarchy)
+			return;
+
+		UINT32 numChildren = sceneObject->getNumChildren();
+		for (UINT32 i = 0; i < numChildren; i++)
+			recordState(sceneObject->getChild(i), output);
+	}
+
+	bool CmdRecordSO::canRecordDelta(const Vector<SOState>& before, const Vector<SOState>& after)
+	{
+		if (before.size() != after.size())
+			return false;
+
+		for (UINT32 i = 0; i < (UINT32)before.size(); i++)
+		{
+			if (before[i].sceneObject != after[i].sceneObject)
+				return false;
+
+			if (before[i].prefabLink != after[i].prefabLink || before[i].prefabDiff != after[i].prefabDiff)
+				return false;
+
+			if (before[i].components != after[i].components)
+				return false;
+		}
+
+		return true;
 	}
 }
\ No newline at end of file
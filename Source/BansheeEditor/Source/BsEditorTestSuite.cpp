@@ -16,6 +16,14 @@
 #include "BsFrameAlloc.h"
 #include "BsFileSystem.h"
 #include "BsSceneManager.h"
+#include "BsGUIPanel.h"
+#include "BsGUILayoutX.h"
+#include "BsGUILayoutY.h"
+#include "BsGUISpace.h"
+#include "BsGUILayoutData.h"
+#include "BsTimer.h"
+#include "BsPixelUtil.h"
+#include <random>
 
 namespace bs
 {
@@ -406,6 +414,102 @@ namespace bs
 		return TestComponentD::getRTTIStatic();
 	}
 
+	/**
+	 * Fills the provided layout with a hierarchy of the provided depth, alternating between horizontal layouts, vertical
+	 * layouts and panels. Layouts at the last level are filled with fixed and flexible spaces, and fixed spaces are
+	 * returned in @p leaves.
+	 */
+	void buildTestLayout(GUILayout* parent, UINT32 depth, UINT32 numChildren, Vector<GUIFixedSpace*>& leaves)
+	{
+		for (UINT32 i = 0; i < numChildren; i++)
+		{
+			if (depth == 0)
+			{
+				if ((i % 2) == 0)
+					leaves.push_back(parent->addNewElement<GUIFixedSpace>(10 + (UINT32)leaves.size() % 20));
+				else
+					parent->addNewElement<GUIFlexibleSpace>();
+
+				continue;
+			}
+
+			GUILayout* child;
+			switch (depth % 3)
+			{
+			case 0:
+				child = parent->addNewElement<GUILayoutX>();
+				break;
+			case 1:
+				child = parent->addNewElement<GUILayoutY>();
+				break;
+			default:
+				child = parent->addNewElement<GUIPanel>();
+				break;
+			}
+
+			buildTestLayout(child, depth - 1, numChildren, leaves);
+		}
+	}
+
+	/** Lays out the hierarchy under the provided root panel and cleans its dirty flags, same as GUIWidget would. */
+	void updateTestLayout(GUIPanel* root, UINT32 width, UINT32 height)
+	{
+		GUILayoutData layoutData;
+		layoutData.area.width = width;
+		layoutData.area.height = height;
+		layoutData.clipRect = Rect2I(0, 0, width, height);
+
+		if (root->_getLayoutData().area != layoutData.area)
+		{
+			root->setWidth(width);
+			root->setHeight(height);
+			root->_setLayoutData(layoutData);
+		}
+
+		root->_updateLayout(root->_getLayoutData());
+
+		Stack<GUIElementBase*> todo;
+		todo.push(root);
+
+		while (!todo.empty())
+		{
+			GUIElementBase* currentElem = todo.top();
+			todo.pop();
+
+			currentElem->_markAsClean();
+
+			UINT32 numChildren = currentElem->_getNumChildren();
+			for (UINT32 i = 0; i < numChildren; i++)
+			{
+				GUIElementBase* child = currentElem->_getChild(i);
+				if (child->_isHierarchyDirty())
+					todo.push(child);
+			}
+		}
+	}
+
+	/** Checks if all elements in two hierarchies of the same structure were assigned the same areas. */
+	bool compareTestLayouts(GUIElementBase* a, GUIElementBase* b)
+	{
+		if (a->_getLayoutData().area != b->_getLayoutData().area)
+			return false;
+
+		if (a->_getLayoutData().clipRect != b->_getLayoutData().clipRect)
+			return false;
+
+		UINT32 numChildren = a->_getNumChildren();
+		if (numChildren != b->_getNumChildren())
+			return false;
+
+		for (UINT32 i = 0; i < numChildren; i++)
+		{
+			if (!compareTestLayouts(a->_getChild(i), b->_getChild(i)))
+				return false;
+		}
+
+		return true;
+	}
+
 	EditorTestSuite::EditorTestSuite()
 	{
 		BS_ADD_TEST(EditorTestSuite::SceneObjectRecord_UndoRedo);
@@ -414,6 +518,8 @@ namespace bs
 		BS_ADD_TEST(EditorTestSuite::TestPrefabComplex);
 		BS_ADD_TEST(EditorTestSuite::TestPrefabDiff);
 		BS_ADD_TEST(EditorTestSuite::TestFrameAlloc);
+		BS_ADD_TEST(EditorTestSuite::TestGUILayout);
+		BS_ADD_TEST(EditorTestSuite::TestPixelUtilSIMD);
 	}
 
 	void EditorTestSuite::SceneObjectRecord_UndoRedo()
@@ -808,4 +914,180 @@ namespace bs
 		alloc.dealloc(a13);
 		alloc.clear();
 	}
+	void EditorTestSuite::TestGUILayout()
+	{
+		const UINT32 DEPTH = 6;
+		const UINT32 NUM_CHILDREN = 4;
+		const UINT32 NUM_ITERATIONS = 50;
+
+		Vector<GUIFixedSpace*> leaves;
+		GUIPanel* root = GUIPanel::create();
+		buildTestLayout(root, DEPTH, NUM_CHILDREN, leaves);
+
+		Vector<GUIFixedSpace*> refLeaves;
+		GUIPanel* refRoot = GUIPanel::create();
+		buildTestLayout(refRoot, DEPTH, NUM_CHILDREN, refLeaves);
+
+		// Full layout of a fresh hierarchy, nothing cached
+		Timer timer;
+		updateTestLayout(refRoot, 1280, 720);
+		UINT64 initialTime = timer.getMicroseconds();
+
+		updateTestLayout(root, 1280, 720);
+		BS_TEST_ASSERT(compareTestLayouts(root, refRoot));
+
+		// Resize, affecting the area of every element
+		timer.reset();
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			updateTestLayout(root, 1280 + (i % 2) * 100, 720 + (i % 2) * 50);
+
+		UINT64 resizeTime = timer.getMicroseconds();
+
+		// Change of a single element deep in the hierarchy
+		GUIFixedSpace* leaf = leaves[leaves.size() / 2];
+
+		timer.reset();
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+		{
+			leaf->setSize(10 + (i % 2) * 40);
+			updateTestLayout(root, 1380, 770);
+		}
+
+		UINT64 singleElementTime = timer.getMicroseconds();
+
+		// Compare with an uncached layout of the same hierarchy
+		GUILayout::destroy(refRoot);
+
+		refLeaves.clear();
+		refRoot = GUIPanel::create();
+		buildTestLayout(refRoot, DEPTH, NUM_CHILDREN, refLeaves);
+		refLeaves[refLeaves.size() / 2]->setSize(leaf->getSize());
+
+		updateTestLayout(refRoot, 1380, 770);
+		BS_TEST_ASSERT(compareTestLayouts(root, refRoot));
+
+		LOGDBG("GUI layout of a hierarchy " + toString(DEPTH) + " levels deep. Uncached: " + 
+			toString(initialTime) + "us, resize: " + toString(resizeTime / NUM_ITERATIONS) + "us, single element change: " +
+			toString(singleElementTime / NUM_ITERATIONS) + "us.");
+
+		GUILayout::destroy(refRoot);
+		GUILayout::destroy(root);
+	}
+
+	void EditorTestSuite::TestPixelUtilSIMD()
+	{
+		// Image width is not a multiple of the SIMD width, so scalar handling of row ends is tested as well
+		const UINT32 WIDTH = 1027;
+		const UINT32 HEIGHT = 517;
+		const UINT32 NUM_ITERATIONS = 10;
+
+		std::mt19937 generator(1234);
+		std::uniform_int_distribution<UINT32> byteDistribution(0, 255);
+		std::uniform_real_distribution<float> floatDistribution(-0.25f, 1.25f); // Includes values that need clamping
+
+		auto createImage = [&](PixelFormat format)
+		{
+			SPtr<PixelData> image = PixelData::create(WIDTH, HEIGHT, 1, format);
+
+			UINT32 numChannels = WIDTH * HEIGHT * 4;
+			if (format == PF_FLOAT32_RGBA)
+			{
+				float* data = (float*)image->getData();
+				for (UINT32 i = 0; i < numChannels; i++)
+					data[i] = floatDistribution(generator);
+			}
+			else
+			{
+				UINT8* data = image->getData();
+				for (UINT32 i = 0; i < numChannels; i++)
+					data[i] = (UINT8)byteDistribution(generator);
+			}
+
+			return image;
+		};
+
+		SPtr<PixelData> rgbaImage = createImage(PF_R8G8B8A8);
+		SPtr<PixelData> bgraImage = createImage(PF_B8G8R8A8);
+		SPtr<PixelData> floatImage = createImage(PF_FLOAT32_RGBA);
+
+		auto convert = [](const SPtr<PixelData>& src, PixelFormat format)
+		{
+			SPtr<PixelData> dst = PixelData::create(src->getWidth(), src->getHeight(), 1, format);
+			PixelUtil::bulkPixelConversion(*src, *dst);
+
+			return dst;
+		};
+
+		auto scale = [](const SPtr<PixelData>& src, UINT32 width, UINT32 height)
+		{
+			SPtr<PixelData> dst = PixelData::create(width, height, 1, src->getFormat());
+			PixelUtil::scale(*src, *dst, PixelUtil::FILTER_LINEAR);
+
+			return dst;
+		};
+
+		auto mirror = [](const SPtr<PixelData>& src)
+		{
+			SPtr<PixelData> dst = PixelData::create(src->getWidth(), src->getHeight(), 1, src->getFormat());
+			memcpy(dst->getData(), src->getData(), src->getConsecutiveSize());
+			PixelUtil::mirror(*dst, MirrorModeBits::X | MirrorModeBits::Y);
+
+			return dst;
+		};
+
+		struct Operation
+		{
+			String name;
+			std::function<SPtr<PixelData>()> execute;
+		};
+
+		Vector<Operation> operations =
+		{
+			{ "RGBA8 to BGRA8 conversion", [&]() { return convert(rgbaImage, PF_B8G8R8A8); } },
+			{ "RGBA8 to FLOAT32_RGBA conversion", [&]() { return convert(rgbaImage, PF_FLOAT32_RGBA); } },
+			{ "BGRA8 to FLOAT32_RGBA conversion", [&]() { return convert(bgraImage, PF_FLOAT32_RGBA); } },
+			{ "FLOAT32_RGBA to RGBA8 conversion", [&]() { return convert(floatImage, PF_R8G8B8A8); } },
+			{ "FLOAT32_RGBA to BGRA8 conversion", [&]() { return convert(floatImage, PF_B8G8R8A8); } },
+			{ "RGBA8 downscale", [&]() { return scale(rgbaImage, 733, 391); } },
+			{ "RGBA8 upscale", [&]() { return scale(rgbaImage, 1500, 900); } },
+			{ "FLOAT32_RGBA downscale", [&]() { return scale(floatImage, 733, 391); } },
+			{ "RGBA8 mirror", [&]() { return mirror(rgbaImage); } },
+		};
+
+		const char* levelNames[] = { "scalar", "SSE2", "AVX2" };
+		PixelSIMDLevel supportedLevel = PixelUtil::_getSupportedSIMDLevel();
+
+		for (auto& operation : operations)
+		{
+			SPtr<PixelData> scalarOutput;
+			String timings;
+
+			for (UINT32 i = 0; i <= (UINT32)supportedLevel; i++)
+			{
+				PixelUtil::_setSIMDLevel((PixelSIMDLevel)i);
+
+				Timer timer;
+				SPtr<PixelData> output;
+				for (UINT32 j = 0; j < NUM_ITERATIONS; j++)
+					output = operation.execute();
+
+				UINT64 time = timer.getMicroseconds() / NUM_ITERATIONS;
+
+				// All SIMD paths are expected to produce bit-identical results to the scalar path
+				if (scalarOutput == nullptr)
+					scalarOutput = output;
+				else
+				{
+					bool isEqual = memcmp(scalarOutput->getData(), output->getData(), output->getConsecutiveSize()) == 0;
+					BS_TEST_ASSERT_MSG(isEqual, operation.name + ": " + levelNames[i] + " result differs from scalar.");
+				}
+
+				timings += String(" ") + levelNames[i] + ": " + toString(time) + "us";
+			}
+
+			LOGDBG(operation.name + " of a " + toString(WIDTH) + "x" + toString(HEIGHT) + " image." + timings);
+		}
+
+		PixelUtil::_setSIMDLevel(supportedLevel);
+	}
 }
\ No newline at end of file
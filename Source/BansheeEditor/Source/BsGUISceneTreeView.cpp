@@ -13,6 +13,8 @@
 #include "BsGUIResourceTreeView.h"
 #include "BsGUIContextMenu.h"
 
+using namespace std::placeholders;
+
 namespace bs
 {
 	const MessageId GUISceneTreeView::SELECTION_CHANGED_MSG = MessageId("SceneTreeView_SelectionChanged");
@@ -50,10 +52,14 @@ namespace bs
 		contextMenu->addMenuItem(L"Paste", std::bind(&GUISceneTreeView::paste, this), 36, ShortcutKey(ButtonModifier::Ctrl, BC_V));
 
 		setContextMenu(contextMenu);
+
+		mHierarchyModifiedConn = gSceneManager().onHierarchyModified.connect(
+			std::bind(&GUISceneTreeView::onHierarchyModified, this, _1));
 	}
 
 	GUISceneTreeView::~GUISceneTreeView()
 	{
+		mHierarchyModifiedConn.disconnect();
 		SceneTreeViewLocator::_remove(this);
 	}
 
@@ -74,7 +80,7 @@ namespace bs
 			dragHighlightStyle, dragSepHighlightStyle, GUIDimensions::create(options));
 	}
 
-	void GUISceneTreeView::updateTreeElement(SceneTreeElement* element)
+	void GUISceneTreeView::updateTreeElement(SceneTreeElement* element, bool recursive)
 	{
 		HSceneObject currentSO = element->mSceneObject;
 
@@ -114,6 +120,7 @@ namespace bs
 
 		// Not a complete match, compare everything and insert/delete elements as needed
 		bool needsUpdate = false;
+		Vector<SceneTreeElement*> addedChildren;
 		if(!completeMatch)
 		{
 			Vector<TreeElement*> newChildren;
@@ -122,6 +129,13 @@ namespace bs
 			for(UINT32 i = 0; i < (UINT32)element->mChildren.size(); i++)
 				tempToDelete[i] = true;
 
+			UnorderedMap<UINT64, UINT32> childLookup;
+			for(UINT32 i = 0; i < (UINT32)element->mChildren.size(); i++)
+			{
+				SceneTreeElement* currentChild = static_cast<SceneTreeElement*>(element->mChildren[i]);
+				childLookup[currentChild->mId] = i;
+			}
+
 			for(UINT32 i = 0; i < currentSO->getNumChildren(); i++)
 			{
 				HSceneObject currentSOChild = currentSO->getChild(i);
@@ -138,24 +152,17 @@ namespace bs
 #endif
 
 				UINT64 curId = currentSOChild->getInstanceId();
-				bool found = false;
 
-				for(UINT32 j = 0; j < element->mChildren.size(); j++)
+				auto iterFind = childLookup.find(curId);
+				if(iterFind != childLookup.end())
 				{
-					SceneTreeElement* currentChild = static_cast<SceneTreeElement*>(element->mChildren[j]);
+					SceneTreeElement* currentChild = static_cast<SceneTreeElement*>(element->mChildren[iterFind->second]);
 
-					if(curId == currentChild->mId)
-					{
-						tempToDelete[j] = false;
-						currentChild->mSortedIdx = (UINT32)newChildren.size();
-						newChildren.push_back(currentChild);
-
-						found = true;
-						break;
-					}
+					tempToDelete[iterFind->second] = false;
+					currentChild->mSortedIdx = (UINT32)newChildren.size();
+					newChildren.push_back(currentChild);
 				}
-
-				if(!found)
+				else
 				{
 					SceneTreeElement* newChild = bs_new<SceneTreeElement>();
 					newChild->mParent = element;
@@ -169,6 +176,8 @@ namespace bs
 					newChild->mIsPrefabInstance = isPrefabInstance;
 
 					newChildren.push_back(newChild);
+					addedChildren.push_back(newChild);
+					mElementLookup[newChild->mId] = newChild;
 
 					updateElementGUI(newChild);
 				}
@@ -193,7 +202,10 @@ namespace bs
 		if(element->mName != name)
 		{
 			element->mName = name;
-			needsUpdate = true;	
+			needsUpdate = true;
+
+			if (element->mParent != nullptr)
+				sortChildren(static_cast<SceneTreeElement*>(element->mParent));
 		}
 
 		// Check if active state needs updating
@@ -216,49 +228,102 @@ namespace bs
 			bool isInternal = element->mSceneObject->hasFlag(SOF_Internal);
 			element->mTint = isInternal ? Color::Red : (isPrefabInstance ? PREFAB_TINT : Color::White);
 
+			// Prefab instance state is inherited from the parents, so the children need to be checked as well
+			recursive = true;
 			needsUpdate = true;
 		}
 
 		if(needsUpdate)
 			updateElementGUI(element);
 
-		for(UINT32 i = 0; i < (UINT32)element->mChildren.size(); i++)
+		if (recursive)
+		{
+			for(UINT32 i = 0; i < (UINT32)element->mChildren.size(); i++)
+			{
+				SceneTreeElement* sceneElement = static_cast<SceneTreeElement*>(element->mChildren[i]);
+				updateTreeElement(sceneElement, true);
+			}
+		}
+		else
 		{
-			SceneTreeElement* sceneElement = static_cast<SceneTreeElement*>(element->mChildren[i]);
-			updateTreeElement(sceneElement);
+			for (auto& child : addedChildren)
+				updateTreeElement(child, true);
 		}
 
+		if(!completeMatch)
+			sortChildren(element);
+	}
+
+	void GUISceneTreeView::sortChildren(SceneTreeElement* element)
+	{
 		// Calculate the sorted index of the elements based on their name
 		bs_frame_mark();
-		FrameVector<SceneTreeElement*> sortVector;
-		for (auto& child : element->mChildren)
-			sortVector.push_back(static_cast<SceneTreeElement*>(child));
-
-		std::sort(sortVector.begin(), sortVector.end(),
-			[&](const SceneTreeElement* lhs, const SceneTreeElement* rhs)
 		{
-			return StringUtil::compare(lhs->mName, rhs->mName, false) < 0;
-		});
+			FrameVector<SceneTreeElement*> sortVector;
+			for (auto& child : element->mChildren)
+				sortVector.push_back(static_cast<SceneTreeElement*>(child));
 
-		UINT32 idx = 0;
-		for (auto& child : sortVector)
-		{
-			child->mSortedIdx = idx;
-			idx++;
-		}
+			std::sort(sortVector.begin(), sortVector.end(),
+				[&](const SceneTreeElement* lhs, const SceneTreeElement* rhs)
+			{
+				return StringUtil::compare(lhs->mName, rhs->mName, false) < 0;
+			});
 
+			UINT32 idx = 0;
+			for (auto& child : sortVector)
+			{
+				child->mSortedIdx = idx;
+				idx++;
+			}
+		}
 		bs_frame_clear();
+
+		_markLayoutAsDirty();
 	}
 
 	void GUISceneTreeView::updateTreeElementHierarchy()
 	{
 		HSceneObject root = gSceneManager().getRootNode();
-		mRootElement.mSceneObject = root;
-		mRootElement.mId = root->getInstanceId();
-		mRootElement.mSortedIdx = 0;
-		mRootElement.mIsExpanded = true;
 
-		updateTreeElement(&mRootElement);
+		// Root changed (for example a new scene was loaded), check the entire hierarchy
+		if (mRootElement.mId != root->getInstanceId() || mRootElement.mSceneObject.isDestroyed())
+		{
+			mRootElement.mSceneObject = root;
+			mRootElement.mId = root->getInstanceId();
+			mRootElement.mSortedIdx = 0;
+			mRootElement.mIsExpanded = true;
+
+			mElementLookup[mRootElement.mId] = &mRootElement;
+			mDirtyObjects.clear();
+
+			updateTreeElement(&mRootElement, true);
+			return;
+		}
+
+		if (mDirtyObjects.empty())
+			return;
+
+		UnorderedSet<UINT64> dirtyObjects;
+		std::swap(dirtyObjects, mDirtyObjects);
+
+		for (auto& id : dirtyObjects)
+		{
+			// Element might have been removed while updating one of the other dirty elements
+			auto iterFind = mElementLookup.find(id);
+			if (iterFind == mElementLookup.end())
+				continue;
+
+			SceneTreeElement* element = iterFind->second;
+			if (element->mSceneObject.isDestroyed())
+				continue;
+
+			updateTreeElement(element, false);
+		}
+	}
+
+	void GUISceneTreeView::onHierarchyModified(const HSceneObject& so)
+	{
+		mDirtyObjects.insert(so->getInstanceId());
 	}
 
 	void GUISceneTreeView::renameTreeElement(GUITreeView::TreeElement* element, const WString& name)
@@ -286,11 +351,31 @@ namespace bs
 	{
 		closeTemporarilyExpandedElements(); // In case this element is one of them
 
-		if (element->mIsHighlighted)
-			clearPing();
+		// Children get deleted along with the element, so make sure nothing references any of them
+		Stack<TreeElement*> todo;
+		todo.push(element);
+
+		while (!todo.empty())
+		{
+			SceneTreeElement* curElem = static_cast<SceneTreeElement*>(todo.top());
+			todo.pop();
+
+			auto iterFind = mElementLookup.find(curElem->mId);
+			if (iterFind != mElementLookup.end() && iterFind->second == curElem)
+				mElementLookup.erase(iterFind);
+
+			if (curElem->mIsHighlighted)
+				clearPing();
+
+			if (curElem->mIsSelected)
+				unselectElement(curElem);
 
-		if(element->mIsSelected)
-			unselectElement(element);
+			if (curElem == mEditElement)
+				disableEdit(false);
+
+			for (auto& child : curElem->mChildren)
+				todo.push(child);
+		}
 
 		bs_delete(element);
 	}
@@ -401,72 +486,32 @@ namespace bs
 		// for better performance.
 		updateTreeElementHierarchy();
 
-		Stack<SceneTreeElement*> todo;
-		todo.push(&mRootElement);
-
-		while (!todo.empty())
+		for (auto& object : objects)
 		{
-			SceneTreeElement* currentElem = todo.top();
-			todo.pop();
-
-			auto iterFind = std::find(objects.begin(), objects.end(), currentElem->mSceneObject);
-			if (iterFind != objects.end())
-			{
-				expandToElement(currentElem);
-				selectElement(currentElem);
-			}
+			SceneTreeElement* element = findTreeElement(object);
+			if (element == nullptr)
+				continue;
 
-			for (auto& child : currentElem->mChildren)
-			{
-				SceneTreeElement* sceneChild = static_cast<SceneTreeElement*>(child);
-				todo.push(sceneChild);
-			}
+			expandToElement(element);
+			selectElement(element);
 		}
 	}
 
 	void GUISceneTreeView::ping(const HSceneObject& object)
 	{
-		Stack<SceneTreeElement*> todo;
-		todo.push(&mRootElement);
-
-		while (!todo.empty())
-		{
-			SceneTreeElement* currentElem = todo.top();
-			todo.pop();
-
-			if (currentElem->mSceneObject == object)
-			{
-				GUITreeView::ping(currentElem);
-				break;
-			}
-
-			for (auto& child : currentElem->mChildren)
-			{
-				SceneTreeElement* sceneChild = static_cast<SceneTreeElement*>(child);
-				todo.push(sceneChild);
-			}
-		}
+		SceneTreeElement* element = findTreeElement(object);
+		if (element != nullptr)
+			GUITreeView::ping(element);
 	}
 
 	GUISceneTreeView::SceneTreeElement* GUISceneTreeView::findTreeElement(const HSceneObject& so)
 	{
-		Stack<SceneTreeElement*> todo;
-		todo.push(&mRootElement);
-
-		while (!todo.empty())
-		{
-			SceneTreeElement* currentElem = todo.top();
-			todo.pop();
-
-			if (so == currentElem->mSceneObject)
-				return currentElem;
+		if (so.isDestroyed())
+			return nullptr;
 
-			for (auto& child : currentElem->mChildren)
-			{
-				SceneTreeElement* sceneChild = static_cast<SceneTreeElement*>(child);
-				todo.push(sceneChild);
-			}
-		}
+		auto iterFind = mElementLookup.find(so->getInstanceId());
+		if (iterFind != mElementLookup.end())
+			return iterFind->second;
 
 		return nullptr;
 	}
@@ -15,6 +15,8 @@
 #include "BsGUIVirtualButtonEvent.h"
 #include "BsGUIScrollArea.h"
 #include "BsDragAndDropManager.h"
+#include "BsGUIHelper.h"
+#include "BsGUIDimensions.h"
 #include "BsTime.h"
 
 using namespace std::placeholders;
@@ -64,22 +66,6 @@ namespace bs
 		return false;
 	}
 
-	GUITreeView::TreeElement* GUITreeView::InteractableElement::getTreeElement() const
-	{
-		if(!isTreeElement())
-			return nullptr;
-
-		UINT32 sortedIdx = (index - 1) / 2;
-
-		auto findIter = std::find_if(parent->mChildren.begin(), parent->mChildren.end(),
-			[&](const TreeElement* x) { return x->mSortedIdx == sortedIdx; });
-
-		if(findIter != parent->mChildren.end())
-			return *findIter;
-
-		return nullptr;
-	}
-
 	GUITreeView::GUITreeView(const String& backgroundStyle, const String& elementBtnStyle, 
 		const String& foldoutBtnStyle, const String& selectionBackgroundStyle, const String& highlightBackgroundStyle, 
 		const String& editBoxStyle, const String& dragHighlightStyle, const String& dragSepHighlightStyle, const GUIDimensions& dimensions)
@@ -152,10 +138,6 @@ namespace bs
 			temporarilyExpandElement(element);
 		}
 
-		// NOTE - Instead of iterating through every visible element and comparing it with internal values,
-		// I might just want to add callbacks to SceneManager that notify me of any changes and then only perform
-		// update if anything is actually dirty
-
 		updateTreeElementHierarchy();
 
 		// Attempt to scroll if needed
@@ -496,6 +478,35 @@ namespace bs
 		return GUIElementContainer::_commandEvent(ev);
 	}
 
+	void GUITreeView::_changeParentWidget(GUIWidget* widget)
+	{
+		GUIElementContainer::_changeParentWidget(widget);
+
+		if(widget == nullptr)
+			return;
+
+		// Element sizes depend on the style provided by the widget's skin
+		Stack<TreeElement*> todo;
+		todo.push(&getRootElement());
+
+		while(!todo.empty())
+		{
+			TreeElement* curElem = todo.top();
+			todo.pop();
+
+			if(curElem->mIsVisible && curElem != &getRootElement())
+				curElem->mOptimalSize = calculateElementSize(curElem);
+
+			for(auto& child : curElem->mChildren)
+			{
+				if(child->mIsVisible)
+					todo.push(child);
+			}
+		}
+
+		_markLayoutAsDirty();
+	}
+
 	bool GUITreeView::isSelectionActive() const
 	{
 		return mIsElementSelected && mSelectedElements.size() > 0;
@@ -752,73 +763,104 @@ namespace bs
 
 		if(element->mIsVisible)
 		{
-			HString name(toWString(element->mName));
-			if(element->mElement == nullptr)
-			{
-				element->mElement = GUILabel::create(name, mElementBtnStyle);
-				_registerChildElement(element->mElement);
-			}
+			// GUI elements are created during layout, once we know whether the element is in view
+			element->mOptimalSize = calculateElementSize(element);
 
-			if (element->mIsCut)
-			{
-				Color cutTint = element->mTint;
-				cutTint.a = CUT_COLOR.a;
+			if(element->mElement != nullptr)
+				refreshElementGUI(element);
+		}
+		else
+		{
+			destroyElementGUI(element);
 
-				element->mElement->setTint(cutTint);
-			}
-			else if(element->mIsDisabled)
-			{
-				Color disabledTint = element->mTint;
-				disabledTint.a = DISABLED_COLOR.a;
+			if(element->mIsSelected && element->mIsExpanded)
+				unselectElement(element);
+		}
 
-				element->mElement->setTint(disabledTint);
-			}
-			else
-				element->mElement->setTint(element->mTint);
+		_markLayoutAsDirty();
+	}
 
-			if(element->mChildren.size() > 0)
-			{
-				if(element->mFoldoutBtn == nullptr)
-				{
-					element->mFoldoutBtn = GUIToggle::create(GUIContent(HString(L"")), mFoldoutBtnStyle);
-					_registerChildElement(element->mFoldoutBtn);
+	void GUITreeView::createElementGUI(TreeElement* element)
+	{
+		HString name(toWString(element->mName));
+		element->mElement = GUILabel::create(name, mElementBtnStyle);
+		_registerChildElement(element->mElement);
 
-					element->mFoldoutBtn->onToggled.connect(std::bind(&GUITreeView::elementToggled, this, element, _1));
+		if(element == mEditElement)
+			element->mElement->setVisible(false);
 
-					if(element->mIsExpanded)
-						element->mFoldoutBtn->toggleOn();
-				}
-			}
-			else
-			{
-				if(element->mFoldoutBtn != nullptr)
-				{
-					GUIElement::destroy(element->mFoldoutBtn);
-					element->mFoldoutBtn = nullptr;
-				}
-			}
+		refreshElementGUI(element);
+	}
+
+	void GUITreeView::destroyElementGUI(TreeElement* element)
+	{
+		if(element->mElement != nullptr)
+		{
+			GUIElement::destroy(element->mElement);
+			element->mElement = nullptr;
+		}
+
+		if(element->mFoldoutBtn != nullptr)
+		{
+			GUIElement::destroy(element->mFoldoutBtn);
+			element->mFoldoutBtn = nullptr;
+		}
+	}
+
+	void GUITreeView::refreshElementGUI(TreeElement* element)
+	{
+		if (element->mIsCut)
+		{
+			Color cutTint = element->mTint;
+			cutTint.a = CUT_COLOR.a;
 
-			element->mElement->setContent(GUIContent(name));
+			element->mElement->setTint(cutTint);
+		}
+		else if(element->mIsDisabled)
+		{
+			Color disabledTint = element->mTint;
+			disabledTint.a = DISABLED_COLOR.a;
+
+			element->mElement->setTint(disabledTint);
 		}
 		else
+			element->mElement->setTint(element->mTint);
+
+		if(element->mChildren.size() > 0)
 		{
-			if(element->mElement != nullptr)
+			if(element->mFoldoutBtn == nullptr)
 			{
-				GUIElement::destroy(element->mElement);
-				element->mElement = nullptr;
-			}
+				element->mFoldoutBtn = GUIToggle::create(GUIContent(HString(L"")), mFoldoutBtnStyle);
+				_registerChildElement(element->mFoldoutBtn);
+
+				element->mFoldoutBtn->onToggled.connect(std::bind(&GUITreeView::elementToggled, this, element, _1));
 
+				if(element->mIsExpanded)
+					element->mFoldoutBtn->toggleOn();
+			}
+		}
+		else
+		{
 			if(element->mFoldoutBtn != nullptr)
 			{
 				GUIElement::destroy(element->mFoldoutBtn);
 				element->mFoldoutBtn = nullptr;
 			}
-
-			if(element->mIsSelected && element->mIsExpanded)
-				unselectElement(element);
 		}
 
-		_markLayoutAsDirty();
+		element->mElement->setContent(GUIContent(HString(toWString(element->mName))));
+	}
+
+	Vector2I GUITreeView::calculateElementSize(const TreeElement* element) const
+	{
+		const GUIElementStyle* style = &GUISkin::DefaultStyle;
+		if(_getParentWidget() != nullptr)
+			style = _getParentWidget()->getSkin().getStyle(mElementBtnStyle);
+
+		GUIDimensions dimensions = GUIDimensions::create();
+		dimensions.updateWithStyle(style);
+
+		return GUIHelper::calcOptimalContentsSize(toWString(element->mName), *style, dimensions);
 	}
 
 	void GUITreeView::elementToggled(TreeElement* element, bool toggled)
@@ -916,9 +958,9 @@ namespace bs
 				todo.pop();
 
 				INT32 yOffset = 0;
-				if(current->mElement != nullptr)
+				if(current != &getRootElementConst())
 				{
-					Vector2I curOptimalSize = current->mElement->_getOptimalSize();
+					const Vector2I& curOptimalSize = current->mOptimalSize;
 					optimalSize.x = std::max(optimalSize.x, 
 						(INT32)(INITIAL_INDENT_OFFSET + curOptimalSize.x + currentUpdateElement.indent * INDENT_SIZE));
 					yOffset = curOptimalSize.y + ELEMENT_EXTRA_SPACING;
@@ -984,9 +1026,6 @@ namespace bs
 		Stack<UpdateTreeElement> todo;
 		todo.push(UpdateTreeElement(&getRootElement(), 0));
 
-		// NOTE - Instead of iterating through all elements, try to find those within the clip rect
-		// and only iterate through those. Others should somehow be marked in-active (similar to GUIElement::isDisabled()?)
-
 		Vector<TreeElement*> tempOrderedElements;
 
 		Vector2I offset(data.area.x, data.area.y);
@@ -1000,24 +1039,33 @@ namespace bs
 
 			INT32 btnHeight = 0;
 			INT32 yOffset = 0;
-			if(current->mElement != nullptr)
+			if(current != &getRootElement())
 			{
-				Vector2I elementSize = current->mElement->_getOptimalSize();
+				Vector2I elementSize = current->mOptimalSize;
 				btnHeight = elementSize.y;
 
 				mVisibleElements.push_back(InteractableElement(current->mParent, current->mSortedIdx * 2 + 0, Rect2I(data.area.x, offset.y, data.area.width, ELEMENT_EXTRA_SPACING)));
-				mVisibleElements.push_back(InteractableElement(current->mParent, current->mSortedIdx * 2 + 1, Rect2I(data.area.x, offset.y + ELEMENT_EXTRA_SPACING, data.area.width, btnHeight)));
+				mVisibleElements.push_back(InteractableElement(current->mParent, current->mSortedIdx * 2 + 1, Rect2I(data.area.x, offset.y + ELEMENT_EXTRA_SPACING, data.area.width, btnHeight), current));
 
 				offset.x = data.area.x + INITIAL_INDENT_OFFSET + indent * INDENT_SIZE;
 				offset.y += ELEMENT_EXTRA_SPACING;
 
-				GUILayoutData childData = data;
-				childData.area.x = offset.x;
-				childData.area.y = offset.y;
-				childData.area.width = elementSize.x;
-				childData.area.height = elementSize.y;
+				current->mArea = Rect2I(offset.x, offset.y, elementSize.x, elementSize.y);
 
-				current->mElement->_setLayoutData(childData);
+				// Only elements within the visible area are represented by GUI elements
+				Rect2I rowBounds(data.area.x, offset.y, data.area.width, btnHeight);
+				if(rowBounds.overlaps(data.clipRect))
+				{
+					if(current->mElement == nullptr)
+						createElementGUI(current);
+
+					GUILayoutData childData = data;
+					childData.area = current->mArea;
+
+					current->mElement->_setLayoutData(childData);
+				}
+				else
+					destroyElementGUI(current);
 
 				yOffset = btnHeight;
 			}
@@ -1073,25 +1121,25 @@ namespace bs
 
 		for(auto selectedElem : mSelectedElements)
 		{
-			GUILabel* targetElement = selectedElem.element->mElement;
-			if (targetElement == nullptr)
+			TreeElement* targetElement = selectedElem.element;
+			if (!targetElement->mIsVisible)
 				continue;
 
 			GUILayoutData childData = data;
-			childData.area.y = targetElement->_getLayoutData().area.y;
-			childData.area.height = targetElement->_getLayoutData().area.height;
+			childData.area.y = targetElement->mArea.y;
+			childData.area.height = targetElement->mArea.height;
 
 			selectedElem.background->_setLayoutData(childData);
 		}
 
 		if (mIsElementHighlighted)
 		{
-			GUILabel* targetElement = mHighlightedElement.element->mElement;
-			if (targetElement != nullptr)
+			TreeElement* targetElement = mHighlightedElement.element;
+			if (targetElement->mIsVisible)
 			{
 				GUILayoutData childData = data;
-				childData.area.y = targetElement->_getLayoutData().area.y;
-				childData.area.height = targetElement->_getLayoutData().area.height;
+				childData.area.y = targetElement->mArea.y;
+				childData.area.height = targetElement->mArea.height;
 
 				mHighlightedElement.background->_setLayoutData(childData);
 			}
@@ -1099,13 +1147,12 @@ namespace bs
 
 		if(mEditElement != nullptr)
 		{
-			GUILabel* targetElement = mEditElement->mElement;
-			if (targetElement != nullptr)
+			if (mEditElement->mIsVisible)
 			{
 				UINT32 remainingWidth = (UINT32)std::max(0, (((INT32)data.area.width) - (offset.x - data.area.x)));
 
 				GUILayoutData childData = data;
-				childData.area = targetElement->_getLayoutData().area;
+				childData.area = mEditElement->mArea;
 				childData.area.width = remainingWidth;
 
 				mNameEditBox->_setLayoutData(childData);
@@ -1167,13 +1214,16 @@ namespace bs
 
 	const GUITreeView::InteractableElement* GUITreeView::findElementUnderCoord(const Vector2I& coord) const
 	{
-		for(auto& element : mVisibleElements)
-		{
-			if(element.bounds.contains(coord))
-			{
-				return &element;
-			}
-		}
+		// Elements are laid out from top to bottom, so find the last element starting above the coordinate
+		auto iterFind = std::upper_bound(mVisibleElements.begin(), mVisibleElements.end(), coord.y,
+			[](INT32 y, const InteractableElement& x) { return y < x.bounds.y; });
+
+		if(iterFind == mVisibleElements.begin())
+			return nullptr;
+
+		--iterFind;
+		if(iterFind->bounds.contains(coord))
+			return &(*iterFind);
 
 		return nullptr;
 	}
@@ -1293,7 +1343,7 @@ namespace bs
 
 	void GUITreeView::scrollToElement(TreeElement* element, bool center)
 	{
-		if(element->mElement == nullptr)
+		if(!element->mIsVisible)
 			return;
 
 		GUIScrollArea* scrollArea = findParentScrollArea();
@@ -1304,7 +1354,7 @@ namespace bs
 		{
 			Rect2I myBounds = _getClippedBounds();
 			INT32 clipVertCenter = myBounds.y + (INT32)Math::roundToInt(myBounds.height * 0.5f);
-			INT32 elemVertCenter = element->mElement->_getLayoutData().area.y + (INT32)Math::roundToInt(element->mElement->_getLayoutData().area.height * 0.5f);
+			INT32 elemVertCenter = element->mArea.y + (INT32)Math::roundToInt(element->mArea.height * 0.5f);
 
 			if(elemVertCenter > clipVertCenter)
 				scrollArea->scrollDownPx(elemVertCenter - clipVertCenter);
@@ -1314,8 +1364,8 @@ namespace bs
 		else
 		{
 			Rect2I myBounds = _getClippedBounds();
-			INT32 elemVertTop = element->mElement->_getLayoutData().area.y;
-			INT32 elemVertBottom = element->mElement->_getLayoutData().area.y + element->mElement->_getLayoutData().area.height;
+			INT32 elemVertTop = element->mArea.y;
+			INT32 elemVertBottom = element->mArea.y + element->mArea.height;
 
 			INT32 top = myBounds.y;
 			INT32 bottom = myBounds.y + myBounds.height;
@@ -933,6 +933,28 @@ namespace bs
 		return HSceneObject();
 	}
 
+	/** Checks is any of the provided gizmos pickable. */
+	template<class T>
+	bool anyPickable(const Vector<T>& gizmos)
+	{
+		for (auto& entry : gizmos)
+		{
+			if (entry.pickable)
+				return true;
+		}
+
+		return false;
+	}
+
+	bool GizmoManager::hasPickableGizmos() const
+	{
+		return anyPickable(mSolidCubeData) || anyPickable(mWireCubeData) || anyPickable(mSolidSphereData) ||
+			anyPickable(mWireSphereData) || anyPickable(mSolidConeData) || anyPickable(mWireConeData) ||
+			anyPickable(mLineData) || anyPickable(mLineListData) || anyPickable(mSolidDiscData) ||
+			anyPickable(mWireDiscData) || anyPickable(mWireArcData) || anyPickable(mWireMeshData) ||
+			anyPickable(mFrustumData) || anyPickable(mIconData) || anyPickable(mTextData);
+	}
+
 	namespace ct
 	{
 	GizmoParamBlockDef gGizmoParamBlockDef;
@@ -0,0 +1,498 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsPickingBVH.h"
+#include "BsRay.h"
+#include "BsConvexVolume.h"
+
+namespace bs
+{
+	const UINT32 DynamicBVH::INVALID_NODE = (UINT32)-1;
+	const float DynamicBVH::BOUNDS_MARGIN = 0.1f;
+
+	DynamicBVH::DynamicBVH()
+		:mRoot(INVALID_NODE), mFreeList(INVALID_NODE)
+	{ }
+
+	UINT32 DynamicBVH::insert(const AABox& bounds, UINT32 userData)
+	{
+		UINT32 leaf = allocateNode();
+
+		Vector3 margin = bounds.getSize() * BOUNDS_MARGIN;
+		mNodes[leaf].bounds = AABox(bounds.getMin() - margin, bounds.getMax() + margin);
+		mNodes[leaf].userData = userData;
+
+		insertLeaf(leaf);
+		return leaf;
+	}
+
+	void DynamicBVH::remove(UINT32 id)
+	{
+		removeLeaf(id);
+		freeNode(id);
+	}
+
+	bool DynamicBVH::update(UINT32 id, const AABox& bounds)
+	{
+		if (mNodes[id].bounds.contains(bounds))
+			return false;
+
+		removeLeaf(id);
+
+		Vector3 margin = bounds.getSize() * BOUNDS_MARGIN;
+		mNodes[id].bounds = AABox(bounds.getMin() - margin, bounds.getMax() + margin);
+
+		insertLeaf(id);
+		return true;
+	}
+
+	void DynamicBVH::intersects(const Ray& ray, Vector<UINT32>& output) const
+	{
+		if (mRoot == INVALID_NODE)
+			return;
+
+		Vector<UINT32> todo;
+		todo.push_back(mRoot);
+
+		while (!todo.empty())
+		{
+			const Node& node = mNodes[todo.back()];
+			todo.pop_back();
+
+			if (!node.bounds.intersects(ray).first)
+				continue;
+
+			if (node.isLeaf())
+				output.push_back(node.userData);
+			else
+			{
+				todo.push_back(node.children[0]);
+				todo.push_back(node.children[1]);
+			}
+		}
+	}
+
+	void DynamicBVH::intersects(const ConvexVolume& volume, Vector<UINT32>& output) const
+	{
+		if (mRoot == INVALID_NODE)
+			return;
+
+		Vector<UINT32> todo;
+		todo.push_back(mRoot);
+
+		while (!todo.empty())
+		{
+			const Node& node = mNodes[todo.back()];
+			todo.pop_back();
+
+			if (!volume.intersects(node.bounds))
+				continue;
+
+			if (node.isLeaf())
+				output.push_back(node.userData);
+			else
+			{
+				todo.push_back(node.children[0]);
+				todo.push_back(node.children[1]);
+			}
+		}
+	}
+
+	void DynamicBVH::clear()
+	{
+		mNodes.clear();
+		mRoot = INVALID_NODE;
+		mFreeList = INVALID_NODE;
+	}
+
+	UINT32 DynamicBVH::allocateNode()
+	{
+		UINT32 idx;
+		if (mFreeList != INVALID_NODE)
+		{
+			idx = mFreeList;
+			mFreeList = mNodes[idx].parent;
+		}
+		else
+		{
+			idx = (UINT32)mNodes.size();
+			mNodes.push_back(Node());
+		}
+
+		Node& node = mNodes[idx];
+		node.parent = INVALID_NODE;
+		node.children[0] = INVALID_NODE;
+		node.children[1] = INVALID_NODE;
+		node.height = 0;
+		node.userData = 0;
+
+		return idx;
+	}
+
+	void DynamicBVH::freeNode(UINT32 idx)
+	{
+		// Free nodes are linked through their parent index
+		mNodes[idx].parent = mFreeList;
+		mFreeList = idx;
+	}
+
+	void DynamicBVH::insertLeaf(UINT32 leaf)
+	{
+		if (mRoot == INVALID_NODE)
+		{
+			mRoot = leaf;
+			mNodes[leaf].parent = INVALID_NODE;
+			return;
+		}
+
+		AABox leafBounds = mNodes[leaf].bounds;
+
+		// Find the best sibling for the new leaf, by descending towards the child whose bounds would grow the least
+		UINT32 idx = mRoot;
+		while (!mNodes[idx].isLeaf())
+		{
+			const Node& node = mNodes[idx];
+
+			float area = getArea(node.bounds);
+			float combinedArea = getArea(merge(node.bounds, leafBounds));
+
+			// Cost of creating a new parent for this node and the new leaf
+			float cost = 2.0f * combinedArea;
+
+			// Minimum cost of pushing the leaf further down the hierarchy
+			float inheritanceCost = 2.0f * (combinedArea - area);
+
+			float childCosts[2];
+			for (UINT32 i = 0; i < 2; i++)
+			{
+				const Node& child = mNodes[node.children[i]];
+
+				float childCost = getArea(merge(child.bounds, leafBounds));
+				if (!child.isLeaf())
+					childCost -= getArea(child.bounds);
+
+				childCosts[i] = childCost + inheritanceCost;
+			}
+
+			if (cost < childCosts[0] && cost < childCosts[1])
+				break;
+
+			idx = childCosts[0] < childCosts[1] ? node.children[0] : node.children[1];
+		}
+
+		UINT32 sibling = idx;
+		UINT32 oldParent = mNodes[sibling].parent;
+		UINT32 newParent = allocateNode();
+
+		Node& parentNode = mNodes[newParent];
+		parentNode.parent = oldParent;
+		parentNode.bounds = merge(leafBounds, mNodes[sibling].bounds);
+		parentNode.height = mNodes[sibling].height + 1;
+		parentNode.children[0] = sibling;
+		parentNode.children[1] = leaf;
+
+		mNodes[sibling].parent = newParent;
+		mNodes[leaf].parent = newParent;
+
+		if (oldParent != INVALID_NODE)
+		{
+			Node& oldParentNode = mNodes[oldParent];
+			if (oldParentNode.children[0] == sibling)
+				oldParentNode.children[0] = newParent;
+			else
+				oldParentNode.children[1] = newParent;
+		}
+		else
+			mRoot = newParent;
+
+		refit(newParent);
+	}
+
+	void DynamicBVH::removeLeaf(UINT32 leaf)
+	{
+		if (leaf == mRoot)
+		{
+			mRoot = INVALID_NODE;
+			return;
+		}
+
+		UINT32 parent = mNodes[leaf].parent;
+		UINT32 grandParent = mNodes[parent].parent;
+		UINT32 sibling = mNodes[parent].children[0] == leaf ? mNodes[parent].children[1] : mNodes[parent].children[0];
+
+		// Sibling takes the place of the parent
+		if (grandParent != INVALID_NODE)
+		{
+			Node& grandParentNode = mNodes[grandParent];
+			if (grandParentNode.children[0] == parent)
+				grandParentNode.children[0] = sibling;
+			else
+				grandParentNode.children[1] = sibling;
+
+			mNodes[sibling].parent = grandParent;
+			freeNode(parent);
+
+			refit(grandParent);
+		}
+		else
+		{
+			mRoot = sibling;
+			mNodes[sibling].parent = INVALID_NODE;
+			freeNode(parent);
+		}
+
+		mNodes[leaf].parent = INVALID_NODE;
+	}
+
+	void DynamicBVH::refit(UINT32 idx)
+	{
+		while (idx != INVALID_NODE)
+		{
+			idx = balance(idx);
+
+			Node& node = mNodes[idx];
+			const Node& childA = mNodes[node.children[0]];
+			const Node& childB = mNodes[node.children[1]];
+
+			node.height = 1 + std::max(childA.height, childB.height);
+			node.bounds = merge(childA.bounds, childB.bounds);
+
+			idx = node.parent;
+		}
+	}
+
+	UINT32 DynamicBVH::balance(UINT32 idx)
+	{
+		Node& node = mNodes[idx];
+		if (node.isLeaf() || node.height < 2)
+			return idx;
+
+		INT32 heightDiff = (INT32)mNodes[node.children[1]].height - (INT32)mNodes[node.children[0]].height;
+		if (heightDiff >= -1 && heightDiff <= 1)
+			return idx;
+
+		// Rotate the taller child up, into the place of this node
+		UINT32 upSlot = heightDiff > 1 ? 1 : 0;
+		UINT32 up = node.children[upSlot];
+		UINT32 other = node.children[1 - upSlot];
+
+		Node& upNode = mNodes[up];
+		UINT32 upChildA = upNode.children[0];
+		UINT32 upChildB = upNode.children[1];
+
+		upNode.children[0] = idx;
+		upNode.parent = node.parent;
+		node.parent = up;
+
+		if (upNode.parent != INVALID_NODE)
+		{
+			Node& parentNode = mNodes[upNode.parent];
+			if (parentNode.children[0] == idx)
+				parentNode.children[0] = up;
+			else
+				parentNode.children[1] = up;
+		}
+		else
+			mRoot = up;
+
+		// Taller of the rotated node's children stays with it, while the other one is moved to the original node
+		UINT32 keep = mNodes[upChildA].height > mNodes[upChildB].height ? upChildA : upChildB;
+		UINT32 move = keep == upChildA ? upChildB : upChildA;
+
+		upNode.children[1] = keep;
+		node.children[upSlot] = move;
+		mNodes[move].parent = idx;
+
+		node.bounds = merge(mNodes[other].bounds, mNodes[move].bounds);
+		node.height = 1 + std::max(mNodes[other].height, mNodes[move].height);
+
+		upNode.bounds = merge(node.bounds, mNodes[keep].bounds);
+		upNode.height = 1 + std::max(node.height, mNodes[keep].height);
+
+		return up;
+	}
+
+	float DynamicBVH::getArea(const AABox& box)
+	{
+		Vector3 size = box.getSize();
+		return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+	}
+
+	AABox DynamicBVH::merge(const AABox& a, const AABox& b)
+	{
+		return AABox(Vector3::min(a.getMin(), b.getMin()), Vector3::max(a.getMax(), b.getMax()));
+	}
+
+	const UINT32 TriangleBVH::MAX_LEAF_TRIANGLES = 4;
+
+	void TriangleBVH::build(const UINT8* positions, UINT32 stride, UINT32 numVertices, const UINT8* indices,
+		UINT32 numIndices, UINT32 indexSize)
+	{
+		mPositions.clear();
+		mTriangles.clear();
+		mNodes.clear();
+
+		UINT32 numTriangles = numIndices / 3;
+		if (numVertices == 0 || numTriangles == 0)
+			return;
+
+		mPositions.resize(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+			memcpy(&mPositions[i], positions + i * stride, sizeof(Vector3));
+
+		Vector<UINT32> triangles(numTriangles * 3);
+		for (UINT32 i = 0; i < numTriangles * 3; i++)
+		{
+			UINT32 index;
+			if (indexSize == sizeof(UINT16))
+				index = ((const UINT16*)indices)[i];
+			else
+				index = ((const UINT32*)indices)[i];
+
+			// Ignore out of range indices rather than reading outside of the vertex array
+			triangles[i] = std::min(index, numVertices - 1);
+		}
+
+		Vector<UINT32> order(numTriangles);
+		Vector<Vector3> centroids(numTriangles);
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			order[i] = i;
+			centroids[i] = (mPositions[triangles[i * 3 + 0]] + mPositions[triangles[i * 3 + 1]] +
+				mPositions[triangles[i * 3 + 2]]) / 3.0f;
+		}
+
+		mNodes.push_back({ AABox(), 0, numTriangles });
+		split(0, triangles, order, centroids);
+
+		// Store the triangles in the order referenced by the leaf nodes
+		mTriangles.resize(numTriangles * 3);
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			mTriangles[i * 3 + 0] = triangles[order[i] * 3 + 0];
+			mTriangles[i * 3 + 1] = triangles[order[i] * 3 + 1];
+			mTriangles[i * 3 + 2] = triangles[order[i] * 3 + 2];
+		}
+	}
+
+	void TriangleBVH::split(UINT32 nodeIdx, const Vector<UINT32>& triangles, Vector<UINT32>& order,
+		const Vector<Vector3>& centroids)
+	{
+		UINT32 start = mNodes[nodeIdx].start;
+		UINT32 count = mNodes[nodeIdx].count;
+
+		Vector3 min = mPositions[triangles[order[start] * 3]];
+		Vector3 max = min;
+		Vector3 centroidMin = centroids[order[start]];
+		Vector3 centroidMax = centroidMin;
+
+		for (UINT32 i = start; i < start + count; i++)
+		{
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				const Vector3& position = mPositions[triangles[order[i] * 3 + j]];
+
+				min = Vector3::min(min, position);
+				max = Vector3::max(max, position);
+			}
+
+			centroidMin = Vector3::min(centroidMin, centroids[order[i]]);
+			centroidMax = Vector3::max(centroidMax, centroids[order[i]]);
+		}
+
+		mNodes[nodeIdx].bounds = AABox(min, max);
+
+		if (count <= MAX_LEAF_TRIANGLES)
+			return;
+
+		// Split at the median centroid along the axis with the largest centroid extent
+		Vector3 extent = centroidMax - centroidMin;
+
+		UINT32 axis = 0;
+		if (extent.y > extent.x)
+			axis = 1;
+
+		if (extent.z > extent[axis])
+			axis = 2;
+
+		// All centroids are at the same position, there is no reasonable way to split
+		if (extent[axis] <= 0.0f)
+			return;
+
+		UINT32 mid = start + count / 2;
+		std::nth_element(order.begin() + start, order.begin() + mid, order.begin() + start + count,
+			[&](UINT32 a, UINT32 b) { return centroids[a][axis] < centroids[b][axis]; });
+
+		UINT32 left = (UINT32)mNodes.size();
+		mNodes.push_back({ AABox(), start, mid - start });
+		split(left, triangles, order, centroids);
+
+		UINT32 right = (UINT32)mNodes.size();
+		mNodes.push_back({ AABox(), mid, start + count - mid });
+		split(right, triangles, order, centroids);
+
+		mNodes[nodeIdx].start = right;
+		mNodes[nodeIdx].count = 0;
+	}
+
+	bool TriangleBVH::intersects(const Ray& ray, float& distance, Vector3& normal) const
+	{
+		if (mNodes.empty())
+			return false;
+
+		float closestDistance = std::numeric_limits<float>::max();
+		Vector3 closestNormal;
+		bool found = false;
+
+		Vector<UINT32> todo;
+		todo.push_back(0);
+
+		while (!todo.empty())
+		{
+			UINT32 nodeIdx = todo.back();
+			todo.pop_back();
+
+			const Node& node = mNodes[nodeIdx];
+
+			std::pair<bool, float> boundsHit = node.bounds.intersects(ray);
+			if (!boundsHit.first || boundsHit.second > closestDistance)
+				continue;
+
+			if (node.count == 0)
+			{
+				todo.push_back(node.start);
+				todo.push_back(nodeIdx + 1);
+				continue;
+			}
+
+			for (UINT32 i = node.start; i < node.start + node.count; i++)
+			{
+				const Vector3& a = mPositions[mTriangles[i * 3 + 0]];
+				const Vector3& b = mPositions[mTriangles[i * 3 + 1]];
+				const Vector3& c = mPositions[mTriangles[i * 3 + 2]];
+
+				Vector3 triNormal = Vector3::cross(b - a, c - a);
+				if (triNormal.squaredLength() < std::numeric_limits<float>::epsilon())
+					continue;
+
+				std::pair<bool, float> hit = ray.intersects(a, b, c, triNormal);
+				if (hit.first && hit.second < closestDistance)
+				{
+					closestDistance = hit.second;
+					closestNormal = triNormal;
+					found = true;
+				}
+			}
+		}
+
+		if (!found)
+			return false;
+
+		distance = closestDistance;
+		normal = Vector3::normalize(closestNormal);
+
+		if (normal.dot(ray.getDirection()) > 0.0f)
+			normal = -normal;
+
+		return true;
+	}
+}
@@ -25,6 +25,9 @@
 #include "BsRenderer.h"
 #include "BsGizmoManager.h"
 #include "BsRendererUtility.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsRay.h"
 
 using namespace std::placeholders;
 
@@ -70,6 +73,229 @@ namespace bs
 
 	Vector<HSceneObject> ScenePicking::pickObjects(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area, 
 		Vector<HSceneObject>& ignoreRenderables, SnapData* data)
+	{
+		updatePickables();
+
+		bool hasGizmos = GizmoManager::instance().hasPickableGizmos();
+
+		// Marquee selection only selects the visible parts of objects, which requires rendering them. Only the objects
+		// overlapping the area are rendered, as objects outside of it cannot occlude anything within it.
+		if (area.x > 1 || area.y > 1)
+		{
+			ConvexVolume volume = getAreaVolume(cam, position, area);
+
+			Vector<UINT32> candidates;
+			mPickableBVH.intersects(volume, candidates);
+
+			Vector<UINT32> renderables;
+			for (auto& idx : candidates)
+			{
+				const PickableRenderable& pickable = mPickables[idx];
+				if (!volume.intersects(pickable.worldBounds))
+					continue;
+
+				auto iterFind = std::find(ignoreRenderables.begin(), ignoreRenderables.end(), pickable.sceneObject);
+				if (iterFind != ignoreRenderables.end())
+					continue;
+
+				renderables.push_back(idx);
+			}
+
+			if (renderables.empty() && !hasGizmos)
+				return Vector<HSceneObject>();
+
+			return pickObjectsGPU(cam, position, area, renderables, data);
+		}
+
+		Ray ray = cam->screenPointToRay(position);
+
+		UINT32 closest;
+		float distance;
+		Vector3 normal;
+		Vector<UINT32> unresolved;
+		pickClosestRenderable(ray, ignoreRenderables, closest, distance, normal, unresolved);
+
+		if (!unresolved.empty() || hasGizmos)
+		{
+			// Only render the objects that could be under the pointer
+			if (closest != (UINT32)-1)
+				unresolved.push_back(closest);
+
+			return pickObjectsGPU(cam, position, area, unresolved, data);
+		}
+
+		if (closest == (UINT32)-1)
+			return Vector<HSceneObject>();
+
+		if (data != nullptr)
+		{
+			data->pickPosition = ray.getPoint(distance);
+			data->normal = normal;
+		}
+
+		return { mPickables[closest].sceneObject };
+	}
+
+	void ScenePicking::updatePickables()
+	{
+		mUpdateIdx++;
+
+		const Map<Renderable*, SceneRenderableData>& renderables = SceneManager::instance().getAllRenderables();
+		for (auto& entry : renderables)
+		{
+			const SPtr<Renderable>& renderable = entry.second.renderable;
+			const HSceneObject& so = entry.second.sceneObject;
+
+			HMesh mesh = renderable->getMesh();
+			bool isPickable = so->getActive() && mesh.isLoaded();
+
+			auto iterFind = mPickableLookup.find(entry.first);
+			if (iterFind == mPickableLookup.end())
+			{
+				if (!isPickable)
+					continue;
+
+				UINT32 idx;
+				if (!mFreePickables.empty())
+				{
+					idx = mFreePickables.back();
+					mFreePickables.pop_back();
+				}
+				else
+				{
+					idx = (UINT32)mPickables.size();
+					mPickables.push_back(PickableRenderable());
+				}
+
+				PickableRenderable& pickable = mPickables[idx];
+				pickable.renderable = renderable;
+				pickable.sceneObject = so;
+				pickable.mesh = mesh.get();
+				pickable.worldTransform = so->getWorldTfrm();
+				pickable.transformHash = so->getTransformHash();
+				pickable.worldBounds = mesh->getProperties().getBounds().getBox();
+				pickable.worldBounds.transformAffine(pickable.worldTransform);
+				pickable.bvhId = mPickableBVH.insert(pickable.worldBounds, idx);
+				pickable.updateIdx = mUpdateIdx;
+
+				mPickableLookup[entry.first] = idx;
+				continue;
+			}
+
+			if (!isPickable)
+				continue;
+
+			PickableRenderable& pickable = mPickables[iterFind->second];
+			pickable.updateIdx = mUpdateIdx;
+
+			if (pickable.transformHash == so->getTransformHash() && pickable.mesh == mesh.get())
+				continue;
+
+			pickable.mesh = mesh.get();
+			pickable.worldTransform = so->getWorldTfrm();
+			pickable.transformHash = so->getTransformHash();
+			pickable.worldBounds = mesh->getProperties().getBounds().getBox();
+			pickable.worldBounds.transformAffine(pickable.worldTransform);
+
+			mPickableBVH.update(pickable.bvhId, pickable.worldBounds);
+		}
+
+		// Remove renderables that were destroyed or are no longer pickable
+		for (auto iter = mPickableLookup.begin(); iter != mPickableLookup.end();)
+		{
+			PickableRenderable& pickable = mPickables[iter->second];
+			if (pickable.updateIdx == mUpdateIdx)
+			{
+				++iter;
+				continue;
+			}
+
+			mPickableBVH.remove(pickable.bvhId);
+			pickable = PickableRenderable();
+
+			mFreePickables.push_back(iter->second);
+			iter = mPickableLookup.erase(iter);
+		}
+
+		for (auto iter = mMeshPickData.begin(); iter != mMeshPickData.end();)
+		{
+			if (iter->second->mesh.expired())
+				iter = mMeshPickData.erase(iter);
+			else
+				++iter;
+		}
+	}
+
+	void ScenePicking::pickClosestRenderable(const Ray& ray, const Vector<HSceneObject>& ignoreRenderables, 
+		UINT32& closest, float& distance, Vector3& normal, Vector<UINT32>& unresolved)
+	{
+		closest = (UINT32)-1;
+		distance = std::numeric_limits<float>::max();
+
+		Vector<UINT32> candidates;
+		mPickableBVH.intersects(ray, candidates);
+
+		Vector<std::pair<float, UINT32>> sortedCandidates;
+		for (auto& idx : candidates)
+		{
+			const PickableRenderable& pickable = mPickables[idx];
+
+			std::pair<bool, float> boundsHit = pickable.worldBounds.intersects(ray);
+			if (!boundsHit.first)
+				continue;
+
+			auto iterFind = std::find(ignoreRenderables.begin(), ignoreRenderables.end(), pickable.sceneObject);
+			if (iterFind != ignoreRenderables.end())
+				continue;
+
+			sortedCandidates.push_back(std::make_pair(boundsHit.second, idx));
+		}
+
+		std::sort(sortedCandidates.begin(), sortedCandidates.end());
+
+		for (auto& candidate : sortedCandidates)
+		{
+			// Bounds are further away than the closest hit, and so is everything after them
+			if (candidate.first > distance)
+				break;
+
+			const PickableRenderable& pickable = mPickables[candidate.second];
+
+			SPtr<MeshPickData> meshPickData;
+			if (isOpaque(*pickable.renderable))
+				meshPickData = getMeshPickData(pickable.renderable->getMesh());
+
+			if (meshPickData == nullptr)
+			{
+				unresolved.push_back(candidate.second);
+				continue;
+			}
+
+			Ray localRay = ray;
+			localRay.transformAffine(pickable.worldTransform.inverseAffine());
+
+			for (auto& subMesh : meshPickData->subMeshes)
+			{
+				float localDistance;
+				Vector3 localNormal;
+				if (!subMesh.intersects(localRay, localDistance, localNormal))
+					continue;
+
+				Vector3 worldPoint = pickable.worldTransform.multiplyAffine(localRay.getPoint(localDistance));
+				float worldDistance = worldPoint.distance(ray.getOrigin());
+
+				if (worldDistance < distance)
+				{
+					closest = candidate.second;
+					distance = worldDistance;
+					normal = localNormal;
+				}
+			}
+		}
+	}
+
+	Vector<HSceneObject> ScenePicking::pickObjectsGPU(const SPtr<Camera>& cam, const Vector2I& position, 
+		const Vector2I& area, const Vector<UINT32>& renderables, SnapData* data)
 	{
 		auto comparePickElement = [&] (const ScenePicking::RenderablePickData& a, const ScenePicking::RenderablePickData& b)
 		{
@@ -87,78 +313,51 @@ namespace bs
 
 		Matrix4 viewProjMatrix = cam->getProjectionMatrixRS() * cam->getViewMatrix();
 
-		const Map<Renderable*, SceneRenderableData>& renderables = SceneManager::instance().getAllRenderables();
 		RenderableSet pickData(comparePickElement);
 		Map<UINT32, HSceneObject> idxToRenderable;
 
-		for (auto& renderableData : renderables)
+		for (auto& pickableIdx : renderables)
 		{
-			SPtr<Renderable> renderable = renderableData.second.renderable;
-			HSceneObject so = renderableData.second.sceneObject;
-
-			if (!so->getActive())
-				continue;
+			const PickableRenderable& pickable = mPickables[pickableIdx];
+			const SPtr<Renderable>& renderable = pickable.renderable;
+			const HSceneObject& so = pickable.sceneObject;
 
 			HMesh mesh = renderable->getMesh();
 			if (!mesh.isLoaded())
 				continue;
 
-			bool found = false;
-			for (int i = 0; i < ignoreRenderables.size(); i++)
-			{
-				if (ignoreRenderables[i] == so)
-				{
-					found = true;
-					break;
-				}
-			}
-			
-			if (found)
-				continue;
-
-			Bounds worldBounds = mesh->getProperties().getBounds();
 			Matrix4 worldTransform = so->getWorldTfrm();
-			worldBounds.transformAffine(worldTransform);
-
-			const ConvexVolume& frustum = cam->getWorldFrustum();
-			if (frustum.intersects(worldBounds.getSphere()))
+			for (UINT32 i = 0; i < mesh->getProperties().getNumSubMeshes(); i++)
 			{
-				// More precise with the box
-				if (frustum.intersects(worldBounds.getBox()))
-				{
-					for (UINT32 i = 0; i < mesh->getProperties().getNumSubMeshes(); i++)
-					{
-						UINT32 idx = (UINT32)pickData.size();
+				UINT32 idx = (UINT32)pickData.size();
 
-						bool useAlphaShader = false;
-						SPtr<RasterizerState> rasterizerState;
+				bool useAlphaShader = false;
+				SPtr<RasterizerState> rasterizerState;
 
-						HMaterial originalMat = renderable->getMaterial(i);
-						if (originalMat != nullptr && originalMat->getNumPasses() > 0)
-						{
-							SPtr<Pass> firstPass = originalMat->getPass(0); // Note: We only ever check the first pass, problem?
-							useAlphaShader = firstPass->hasBlending();
+				HMaterial originalMat = renderable->getMaterial(i);
+				if (originalMat != nullptr && originalMat->getNumPasses() > 0)
+				{
+					SPtr<Pass> firstPass = originalMat->getPass(0); // Note: We only ever check the first pass, problem?
+					useAlphaShader = firstPass->hasBlending();
 
-							if (firstPass->getRasterizerState() == nullptr)
-								rasterizerState = RasterizerState::getDefault();
-							else
-								rasterizerState = firstPass->getRasterizerState();
-						}
-						else
-							rasterizerState = RasterizerState::getDefault();
+					if (firstPass->getRasterizerState() == nullptr)
+						rasterizerState = RasterizerState::getDefault();
+					else
+						rasterizerState = firstPass->getRasterizerState();
+				}
+				else
+					rasterizerState = RasterizerState::getDefault();
 
-						CullingMode cullMode = rasterizerState->getProperties().getCullMode();
+				CullingMode cullMode = rasterizerState->getProperties().getCullMode();
 
-						HTexture mainTexture;
-						if (useAlphaShader)
-							mainTexture = originalMat->getTexture("gAlbedoTex");
+				HTexture mainTexture;
+				if (useAlphaShader)
+					mainTexture = originalMat->getTexture("gAlbedoTex");
 
-						idxToRenderable[idx] = so;
+				idxToRenderable[idx] = so;
 
-						Matrix4 wvpTransform = viewProjMatrix * worldTransform;
-						pickData.insert({ mesh->getCore(), idx, wvpTransform, useAlphaShader, cullMode, mainTexture });
-					}
-				}
+				Matrix4 wvpTransform = viewProjMatrix * worldTransform;
+				pickData.insert({ mesh->getCore(), idx, wvpTransform, useAlphaShader, cullMode, mainTexture });
 			}
 		}
 
@@ -208,6 +407,130 @@ namespace bs
 		return results;
 	}
 
+	SPtr<ScenePicking::MeshPickData> ScenePicking::getMeshPickData(const HMesh& mesh)
+	{
+		SPtr<MeshPickData> pickData;
+
+		auto iterFind = mMeshPickData.find(mesh.get());
+		if (iterFind != mMeshPickData.end() && iterFind->second->mesh.lock() == mesh.getInternalPtr())
+			pickData = iterFind->second;
+		else
+		{
+			pickData = bs_shared_ptr_new<MeshPickData>();
+			pickData->mesh = mesh.getInternalPtr();
+
+			// Read from the GPU without waiting for it, the mesh will be picked on the GPU until the data is available
+			pickData->pendingData = mesh->allocBuffer();
+			if ((mesh->getUsage() & MU_CPUCACHED) != 0)
+				mesh->readCachedData(*pickData->pendingData);
+			else
+				pickData->pendingReadOp = mesh->readData(pickData->pendingData);
+
+			mMeshPickData[mesh.get()] = pickData;
+		}
+
+		if (pickData->pendingData != nullptr)
+		{
+			if ((mesh->getUsage() & MU_CPUCACHED) == 0 && !pickData->pendingReadOp.hasCompleted())
+				return nullptr;
+
+			const MeshData& meshData = *pickData->pendingData;
+			SPtr<VertexDataDesc> vertexDesc = meshData.getVertexDesc();
+
+			const VertexElement* positionElement = vertexDesc->getElement(VES_POSITION);
+			if (positionElement != nullptr && positionElement->getType() == VET_FLOAT3)
+			{
+				UINT32 streamIdx = positionElement->getStreamIdx();
+				UINT32 stride = vertexDesc->getVertexStride(streamIdx);
+				UINT8* positions = meshData.getElementData(VES_POSITION, 0, streamIdx);
+
+				UINT32 indexSize = meshData.getIndexElementSize();
+				UINT8* indices;
+				if (indexSize == sizeof(UINT32))
+					indices = (UINT8*)meshData.getIndices32();
+				else
+					indices = (UINT8*)meshData.getIndices16();
+
+				const MeshProperties& props = mesh->getProperties();
+				UINT32 numSubMeshes = props.getNumSubMeshes();
+
+				pickData->subMeshes.resize(numSubMeshes);
+				for (UINT32 i = 0; i < numSubMeshes; i++)
+				{
+					const SubMesh& subMesh = props.getSubMesh(i);
+					if (subMesh.drawOp != DOT_TRIANGLE_LIST)
+					{
+						pickData->isSupported = false;
+						break;
+					}
+
+					pickData->subMeshes[i].build(positions, stride, meshData.getNumVertices(), 
+						indices + subMesh.indexOffset * indexSize, subMesh.indexCount, indexSize);
+				}
+			}
+			else
+				pickData->isSupported = false;
+
+			pickData->pendingData = nullptr;
+			pickData->pendingReadOp = AsyncOp();
+		}
+
+		if (!pickData->isSupported)
+			return nullptr;
+
+		return pickData;
+	}
+
+	bool ScenePicking::isOpaque(const Renderable& renderable)
+	{
+		UINT32 numSubMeshes = renderable.getMesh()->getProperties().getNumSubMeshes();
+		for (UINT32 i = 0; i < numSubMeshes; i++)
+		{
+			// Alpha tested materials need to sample the texture, so they're picked on the GPU
+			HMaterial material = renderable.getMaterial(i);
+			if (material != nullptr && material->getNumPasses() > 0 && material->getPass(0)->hasBlending())
+				return false;
+		}
+
+		return true;
+	}
+
+	ConvexVolume ScenePicking::getAreaVolume(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area)
+	{
+		Ray corners[4] =
+		{
+			cam->screenPointToRay(position),
+			cam->screenPointToRay(Vector2I(position.x + area.x, position.y)),
+			cam->screenPointToRay(Vector2I(position.x + area.x, position.y + area.y)),
+			cam->screenPointToRay(Vector2I(position.x, position.y + area.y))
+		};
+
+		Vector3 center = cam->screenPointToRay(Vector2I(position.x + area.x / 2, position.y + area.y / 2)).getPoint(1.0f);
+
+		// Planes going through the edges of the area, and the camera near and far planes
+		Vector<Plane> frustumPlanes = cam->getWorldFrustum().getPlanes();
+
+		Vector<Plane> planes;
+		planes.push_back(frustumPlanes[FRUSTUM_PLANE_NEAR]);
+		planes.push_back(frustumPlanes[FRUSTUM_PLANE_FAR]);
+
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			const Ray& a = corners[i];
+			const Ray& b = corners[(i + 1) % 4];
+
+			Plane plane(a.getOrigin(), a.getPoint(1.0f), b.getPoint(1.0f));
+
+			// Make sure the plane is facing inwards
+			if (plane.getDistance(center) < 0.0f)
+				plane = Plane(-plane.normal, -plane.d);
+
+			planes.push_back(plane);
+		}
+
+		return ConvexVolume(planes);
+	}
+
 	Color ScenePicking::encodeIndex(UINT32 index)
 	{
 		Color encoded;
@@ -6,10 +6,11 @@
 namespace bs
 {
 	const UINT32 UndoRedo::MAX_STACK_ELEMENTS = 1000;
+	const UINT64 UndoRedo::DEFAULT_MEMORY_LIMIT = 128 * 1024 * 1024;
 
 	UndoRedo::UndoRedo()
 		: mUndoStack(nullptr), mRedoStack(nullptr), mUndoStackPtr(0), mUndoNumElements(0), mRedoStackPtr(0)
-		, mRedoNumElements(0), mNextCommandId(0)
+		, mRedoNumElements(0), mNextCommandId(0), mMemoryLimit(DEFAULT_MEMORY_LIMIT)
 	{
 		mUndoStack = bs_newN<SPtr<EditorCommand>>(MAX_STACK_ELEMENTS);
 		mRedoStack = bs_newN<SPtr<EditorCommand>>(MAX_STACK_ELEMENTS);
@@ -29,6 +30,7 @@ namespace bs
 			return;
 
 		SPtr<EditorCommand> command = removeLastFromUndoStack();
+		command->compact();
 		
 		mRedoStackPtr = (mRedoStackPtr + 1) % MAX_STACK_ELEMENTS;
 		mRedoStack[mRedoStackPtr] = command;
@@ -86,8 +88,23 @@ namespace bs
 		clearRedoStack();
 	}
 
-	void UndoRedo::registerCommand(const SPtr<EditorCommand>& command)
+	bool UndoRedo::registerCommand(const SPtr<EditorCommand>& command)
 	{
+		if (mUndoNumElements > 0)
+		{
+			const SPtr<EditorCommand>& topCommand = mUndoStack[mUndoStackPtr];
+
+			// Don't merge with commands outside of the current group
+			bool isInCurrentGroup = mGroups.empty() || mGroups.top().numEntries > 0;
+			if (isInCurrentGroup && topCommand->merge(*command))
+			{
+				clearRedoStack();
+				return false;
+			}
+
+			topCommand->compact();
+		}
+
 		command->mId = mNextCommandId++;
 		command->onCommandAdded();
 
@@ -96,6 +113,9 @@ namespace bs
 			existingCommand->onCommandRemoved();
 
 		clearRedoStack();
+		enforceMemoryLimit();
+
+		return true;
 	}
 
 	UINT32 UndoRedo::getTopCommandId() const
@@ -167,6 +187,46 @@ namespace bs
 		clearRedoStack();
 	}
 
+	void UndoRedo::setMemoryLimit(UINT64 bytes)
+	{
+		mMemoryLimit = bytes;
+		enforceMemoryLimit();
+	}
+
+	void UndoRedo::enforceMemoryLimit()
+	{
+		UINT64 totalSize = 0;
+		for (UINT32 i = 0; i < mUndoNumElements; i++)
+		{
+			UINT32 idx = (mUndoStackPtr + MAX_STACK_ELEMENTS - i) % MAX_STACK_ELEMENTS;
+			totalSize += mUndoStack[idx]->getSize();
+		}
+
+		for (UINT32 i = 0; i < mRedoNumElements; i++)
+		{
+			UINT32 idx = (mRedoStackPtr + MAX_STACK_ELEMENTS - i) % MAX_STACK_ELEMENTS;
+			totalSize += mRedoStack[idx]->getSize();
+		}
+
+		while (totalSize > mMemoryLimit && mUndoNumElements > 1)
+		{
+			UINT32 oldestIdx = (mUndoStackPtr + MAX_STACK_ELEMENTS - (mUndoNumElements - 1)) % MAX_STACK_ELEMENTS;
+
+			SPtr<EditorCommand> command = mUndoStack[oldestIdx];
+			mUndoStack[oldestIdx] = SPtr<EditorCommand>();
+			mUndoNumElements--;
+
+			totalSize -= command->getSize();
+			command->onCommandRemoved();
+		}
+
+		if (!mGroups.empty())
+		{
+			GroupData& topGroup = mGroups.top();
+			topGroup.numEntries = std::min(topGroup.numEntries, mUndoNumElements);
+		}
+	}
+
 	SPtr<EditorCommand> UndoRedo::removeLastFromUndoStack()
 	{
 		SPtr<EditorCommand> command = mUndoStack[mUndoStackPtr];
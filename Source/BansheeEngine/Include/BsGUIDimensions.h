@@ -14,6 +14,16 @@ namespace bs
 	/**	Contains valid size range for a GUI element in a GUI layout. */
 	struct BS_EXPORT LayoutSizeRange
 	{
+		bool operator== (const LayoutSizeRange& rhs) const
+		{
+			return optimal == rhs.optimal && min == rhs.min && max == rhs.max;
+		}
+
+		bool operator!= (const LayoutSizeRange& rhs) const
+		{
+			return !(*this == rhs);
+		}
+
 		Vector2I optimal;
 		Vector2I min;
 		Vector2I max;
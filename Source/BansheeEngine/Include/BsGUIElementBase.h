@@ -39,7 +39,8 @@ namespace bs
 			GUIElem_HiddenSelf = 0x08,
 			GUIElem_InactiveSelf = 0x10,
 			GUIElem_Disabled = 0x20,
-			GUIElem_DisabledSelf = 0x40
+			GUIElem_DisabledSelf = 0x40,
+			GUIElem_HierarchyDirty = 0x80 /**< Element or one of its descendants requested a layout update. */
 		};
 
 	public:
@@ -144,7 +145,11 @@ namespace bs
 		 */
 		virtual void _updateLayout(const GUILayoutData& data);
 
-		/** Calculates optimal sizes of all child elements, as determined by their style and layout options. */
+		/**
+		 * Calculates optimal sizes of all child elements, as determined by their style and layout options. Only children
+		 * whose hierarchy was marked as dirty since the last layout update are recalculated, others keep their cached
+		 * size ranges.
+		 */
 		virtual void _updateOptimalLayoutSizes();
 
 		/** @copydoc _updateLayout */
@@ -194,6 +199,19 @@ namespace bs
 		 */
 		virtual LayoutSizeRange _getLayoutSizeRange() const;
 
+		/**
+		 * Returns a size range that was cached during the last _updateOptimalLayoutSizes() call on this element or its
+		 * parent.
+		 */
+		const LayoutSizeRange& _getCachedSizeRange() const { return mSizeRange; }
+
+		/**
+		 * Checks if assigning the provided layout data to this element would require its layout to be updated. This is
+		 * false if the element was already assigned the same area, clip rectangle and depth, and nothing in its hierarchy
+		 * changed since.
+		 */
+		bool _needsLayoutUpdate(const GUILayoutData& data) const;
+
 		/**
 		 * Returns element padding that determines how far apart to space out this element from other elements in a layout.
 		 */
@@ -285,7 +303,13 @@ namespace bs
 		/**	Returns true if elements contents have changed since last update. */
 		bool _isDirty() const { return (mFlags & GUIElem_Dirty) != 0; }
 
-		/**	Marks the element contents to be up to date (meaning it's processed by the GUI system). */
+		/**
+		 * Returns true if this element or any of its descendants had their layout marked as dirty since the last layout
+		 * update. Layout updates only need to visit dirty hierarchies, as layout of all other elements remains valid.
+		 */
+		bool _isHierarchyDirty() const { return (mFlags & GUIElem_HierarchyDirty) != 0; }
+
+		/**	Marks the element contents and hierarchy to be up to date (meaning it's processed by the GUI system). */
 		void _markAsClean();
 
 		/** @} */
@@ -328,6 +352,7 @@ namespace bs
 
 		GUIDimensions mDimensions;
 		GUILayoutData mLayoutData;
+		LayoutSizeRange mSizeRange;
 	};
 
 	/** @} */
@@ -70,7 +70,8 @@ namespace bs
 
 		/**
 		 * Updates the input tool with new text descriptor and parent GUI element. These values will be used for all 
-		 * further calculations.
+		 * further calculations. Text layout is only recalculated if the element or the layout-affecting properties of
+		 * the descriptor changed since the last call.
 		 */
 		void updateText(const GUIElement* element, const TEXT_SPRITE_DESC& textDesc);
 	protected:
@@ -137,6 +138,7 @@ namespace bs
 		UINT32 mNumQuads;
 
 		TEXT_SPRITE_DESC mTextDesc;
+		TextLayoutKey mLayoutKey;
 
 		Vector<GUIInputLineDesc> mLineDescs;
 	};
@@ -67,9 +67,6 @@ namespace bs
 		/** @copydoc GUIElementBase::_getLayoutSizeRange */
 		LayoutSizeRange _getLayoutSizeRange() const override { return _getCachedSizeRange(); }
 
-		/** Returns a size range that was cached during the last GUIElementBase::_updateOptimalLayoutSizes call. */
-		LayoutSizeRange _getCachedSizeRange() const { return mSizeRange; }
-
 		/**
 		 * Returns a size ranges for all children that was cached during the last GUIElementBase::_updateOptimalLayoutSizes
 		 * call.
@@ -89,7 +86,6 @@ namespace bs
 
 	protected:
 		Vector<LayoutSizeRange> mChildSizeRanges;
-		LayoutSizeRange mSizeRange;
 	};
 
 	/** @} */
@@ -61,6 +61,16 @@ namespace bs
 			return localClipRect;
 		}
 
+		/**
+		 * Checks do the two layout data objects assign the same area, clip rectangle and depth. Custom element depth
+		 * (least significant part) is ignored since it is not assigned by the layout.
+		 */
+		bool isLayoutEqual(const GUILayoutData& other) const
+		{
+			return area == other.area && clipRect == other.clipRect && (depth & 0xFFFFFF00) == (other.depth & 0xFFFFFF00) &&
+				depthRangeMin == other.depthRangeMin && depthRangeMax == other.depthRangeMax;
+		}
+
 		Rect2I area;
 		Rect2I clipRect;
 		UINT32 depth;
@@ -294,6 +294,9 @@ namespace bs
 		/**	Called when the mouse leaves the specified window. */
 		void onMouseLeftWindow(RenderWindow& win);
 
+		/**	Called when characters of a dynamic font are evicted from its cache. */
+		void onFontGlyphsEvicted(const Font& font);
+
 		/**	Converts pointer buttons to mouse buttons. */
 		GUIMouseButton buttonToGUIButton(PointerEventButton pointerButton) const;
 
@@ -351,6 +354,7 @@ namespace bs
 
 		SPtr<ct::GUIRenderer> mRenderer;
 		bool mCoreDirty;
+		bool mFontGlyphsEvicted;
 
 		SPtr<VertexDataDesc> mTriangleVertexDesc;
 		SPtr<VertexDataDesc> mLineVertexDesc;
@@ -417,6 +421,7 @@ namespace bs
 		HEvent mWindowLostFocusConn;
 
 		HEvent mMouseLeftWindowConn;
+		HEvent mFontGlyphsEvictedConn;
 	};
 
 	namespace ct
@@ -212,7 +212,6 @@ namespace bs
 		Vector2I mContentSize;
 
 		Vector<LayoutSizeRange> mChildSizeRanges;
-		LayoutSizeRange mSizeRange;
 
 		static const UINT32 MinHandleSize;
 		static const UINT32 WheelScrollAmount;
@@ -117,6 +117,21 @@ namespace bs { namespace ct
 		void drawMorph(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, const SPtr<VertexBuffer>& morphVertices, 
 			const SPtr<VertexDeclaration>& morphVertexDeclaration);
 
+		/**
+		 * Draws the specified mesh, using vertices from the provided vertex buffer instead of the mesh's own vertices.
+		 * Used for rendering meshes whose vertices have been animated ahead of time.
+		 *
+		 * @param[in]	mesh			Mesh to draw. Must have only a single vertex stream.
+		 * @param[in]	subMesh			Portion of the mesh to draw.
+		 * @param[in]	vertices		Buffer containing the vertices to draw. Expected to be in the same format and contain
+		 *								the same number of vertices as the mesh's vertex buffer.
+		 * @param[in]	numInstances	Number of times to draw the mesh using instanced rendering.
+		 *
+		 * @note	Core thread.
+		 */
+		void drawSkinned(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, const SPtr<VertexBuffer>& vertices,
+			UINT32 numInstances = 1);
+
 		/**
 		 * Blits contents of the provided texture into the currently bound render target. If the provided texture contains
 		 * multiple samples, they will be resolved.
@@ -49,6 +49,32 @@ namespace bs
 		bool wordBreak; /**< If enabled together with word wrap it will allow words to be broken if they don't fit. */
 	};
 
+	/**
+	 * Contains all properties of a TEXT_SPRITE_DESC that influence the text layout and the generated geometry. Used for
+	 * detecting when cached text layout can be reused.
+	 */
+	struct BS_EXPORT TextLayoutKey
+	{
+		TextLayoutKey();
+		TextLayoutKey(const TEXT_SPRITE_DESC& desc);
+
+		bool operator==(const TextLayoutKey& rhs) const;
+		bool operator!=(const TextLayoutKey& rhs) const { return !(*this == rhs); }
+
+		WString text;
+		size_t textHash;
+		const Font* font; /**< Font used at the time the key was created, or null if the font wasn't loaded. */
+		UINT32 fontVersion; /**< Glyph cache version of the font, changes when characters are evicted from the font. */
+		UINT32 fontSize;
+		UINT32 width;
+		UINT32 height;
+		SpriteAnchor anchor;
+		TextHorzAlign horzAlign;
+		TextVertAlign vertAlign;
+		bool wordWrap;
+		bool wordBreak;
+	};
+
 	/**	A sprite consisting of a quads representing a text string. */
 	class BS_EXPORT TextSprite : public Sprite
 	{
@@ -57,7 +83,9 @@ namespace bs
 		~TextSprite();
 
 		/**
-		 * Recreates internal sprite data according the specified description structure.
+		 * Recreates internal sprite data according the specified description structure. If none of the properties
+		 * affecting the text layout changed since the last call, the existing geometry is kept and only the material
+		 * properties are updated.
 		 *
 		 * @param[in]	desc	Describes the geometry and material of the sprite.
 		 * @param[in]	groupId	Group identifier that forces different materials to be used for different groups (for 
@@ -133,7 +161,15 @@ namespace bs
 		/**	Clears internal geometry buffers. */
 		void clearMesh();
 
+		/** Releases references to the font pages the sprite's text is displayed with. */
+		void releaseFontPages();
+
 		mutable StaticAlloc<STATIC_BUFFER_SIZE, STATIC_BUFFER_SIZE> mAlloc;
+		Vector<UINT32> mQuadCapacity;
+		TextLayoutKey mLayoutKey;
+
+		HFont mFont;
+		UINT32 mFontPageMask = 0;
 	};
 
 	/** @} */
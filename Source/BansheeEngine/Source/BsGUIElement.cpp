@@ -95,6 +95,9 @@ namespace bs
 
 	void GUIElement::_setLayoutData(const GUILayoutData& data)
 	{
+		// Contents only need to be rebuilt if the layout actually moved or resized the element
+		bool layoutChanged = !mLayoutData.isLayoutEqual(data);
+
 		// Preserve element depth as that is not controlled by layout but is stored
 		// there only for convenience
 		UINT8 elemDepth = _getElementDepth();
@@ -102,6 +105,9 @@ namespace bs
 		_setElementDepth(elemDepth);
 
 		updateClippedBounds();
+
+		if (layoutChanged)
+			_markContentAsDirty();
 	}
 
 	void GUIElement::_changeParentWidget(GUIWidget* widget)
@@ -12,14 +12,14 @@ namespace bs
 {
 	GUIElementBase::GUIElementBase()
 		: mParentWidget(nullptr), mAnchorParent(nullptr), mUpdateParent(nullptr), mParentElement(nullptr)
-		, mFlags(GUIElem_Dirty)
+		, mFlags(GUIElem_Dirty | GUIElem_HierarchyDirty)
 	{
 
 	}
 
 	GUIElementBase::GUIElementBase(const GUIDimensions& dimensions)
 		: mParentWidget(nullptr), mAnchorParent(nullptr), mUpdateParent(nullptr), mParentElement(nullptr)
-		, mFlags(GUIElem_Dirty), mDimensions(dimensions)
+		, mFlags(GUIElem_Dirty | GUIElem_HierarchyDirty), mDimensions(dimensions)
 	{
 
 	}
@@ -203,14 +203,24 @@ namespace bs
 	
 	void GUIElementBase::_markAsClean()
 	{
-		mFlags &= ~GUIElem_Dirty;
+		mFlags &= ~(GUIElem_Dirty | GUIElem_HierarchyDirty);
 	}
 
 	void GUIElementBase::_markLayoutAsDirty() 
 	{ 
+		// Hidden elements get their layout marked as dirty when they become visible again, so there's no need to flag
+		// them now. Flagging the path without an update parent to process it would only leave it to be walked every frame.
 		if(!_isVisible())
 			return;
 
+		// Flag the path to the root so layout updates can find this element and know its cached size range is invalid
+		GUIElementBase* currentElement = this;
+		while (currentElement != nullptr)
+		{
+			currentElement->mFlags |= GUIElem_HierarchyDirty;
+			currentElement = currentElement->mParentElement;
+		}
+
 		if (mUpdateParent != nullptr)
 			mUpdateParent->mFlags |= GUIElem_Dirty;
 		else
@@ -401,6 +411,8 @@ namespace bs
 	void GUIElementBase::_updateLayout(const GUILayoutData& data)
 	{
 		_updateOptimalLayoutSizes(); // We calculate optimal sizes of all layouts as a pre-processing step, as they are requested often during update
+		mSizeRange = _getLayoutSizeRange();
+
 		_updateLayoutInternal(data);
 	}
 
@@ -408,7 +420,12 @@ namespace bs
 	{
 		for(auto& child : mChildren)
 		{
+			// Size range of a child can only change if something in its hierarchy was marked as dirty
+			if (!child->_isHierarchyDirty())
+				continue;
+
 			child->_updateOptimalLayoutSizes();
+			child->mSizeRange = child->_getLayoutSizeRange();
 		}
 	}
 
@@ -431,6 +448,11 @@ namespace bs
 		return _calculateLayoutSizeRange();
 	}
 
+	bool GUIElementBase::_needsLayoutUpdate(const GUILayoutData& data) const
+	{
+		return _isHierarchyDirty() || !mLayoutData.isLayoutEqual(data);
+	}
+
 	void GUIElementBase::_getElementAreas(const Rect2I& layoutArea, Rect2I* elementAreas, UINT32 numElements,
 		const Vector<LayoutSizeRange>& sizeRanges, const LayoutSizeRange& mySizeRange) const
 	{
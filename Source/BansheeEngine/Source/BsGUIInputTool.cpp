@@ -17,9 +17,18 @@ namespace bs
 
 	void GUIInputTool::updateText(const GUIElement* element, const TEXT_SPRITE_DESC& textDesc)
 	{
+		TextLayoutKey layoutKey(textDesc);
+		bool layoutDirty = element != mElement || layoutKey != mLayoutKey;
+
 		mElement = element;
 		mTextDesc = textDesc;
 
+		// Input elements call this often with unchanged text (e.g. on every caret move or scroll), in which case the
+		// cached quads and line information are still valid
+		if (!layoutDirty)
+			return;
+
+		mLayoutKey = layoutKey;
 		mLineDescs.clear();
 
 		bs_frame_mark();
@@ -62,7 +62,7 @@ namespace bs
 
 			if (child->_isActive())
 			{
-				childSizeRange = child->_getLayoutSizeRange();
+				childSizeRange = child->_getCachedSizeRange();
 				if (child->_getType() == GUIElementBase::Type::FixedSpace)
 				{
 					childSizeRange.optimal.x = 0;
@@ -414,8 +414,12 @@ namespace bs
 				childData.clipRect = childData.area;
 				childData.clipRect.clip(data.clipRect);
 
-				child->_setLayoutData(childData);
-				child->_updateLayoutInternal(childData);
+				// Children that didn't move and have nothing dirty in their hierarchy keep their current layout
+				if (child->_needsLayoutUpdate(childData))
+				{
+					child->_setLayoutData(childData);
+					child->_updateLayoutInternal(childData);
+				}
 			}
 
 			childIdx++;
@@ -37,6 +37,7 @@
 #include "BsSamplerState.h"
 #include "BsRenderStateManager.h"
 #include "BsBuiltinResources.h"
+#include "BsFont.h"
 
 using namespace std::placeholders;
 
@@ -74,7 +75,7 @@ namespace bs
 	const UINT32 GUIManager::MESH_HEAP_INITIAL_NUM_INDICES = 49152;
 
 	GUIManager::GUIManager()
-		: mCoreDirty(false), mActiveMouseButton(GUIMouseButton::Left), mShowTooltip(false), mTooltipElementHoverStart(0.0f)
+		: mCoreDirty(false), mFontGlyphsEvicted(false), mActiveMouseButton(GUIMouseButton::Left), mShowTooltip(false), mTooltipElementHoverStart(0.0f)
 		, mInputCaret(nullptr), mInputSelection(nullptr), mSeparateMeshesByWidget(true), mDragState(DragState::NoDrag)
 		, mCaretColor(1.0f, 0.6588f, 0.0f), mCaretBlinkInterval(0.5f), mCaretLastBlinkTime(0.0f), mIsCaretOn(false)
 		, mActiveCursor(CursorType::Arrow), mTextSelectionColor(0.0f, 114/255.0f, 188/255.0f)
@@ -93,6 +94,7 @@ namespace bs
 		mWindowGainedFocusConn = RenderWindowManager::instance().onFocusGained.connect(std::bind(&GUIManager::onWindowFocusGained, this, _1));
 		mWindowLostFocusConn = RenderWindowManager::instance().onFocusLost.connect(std::bind(&GUIManager::onWindowFocusLost, this, _1));
 		mMouseLeftWindowConn = RenderWindowManager::instance().onMouseLeftWindow.connect(std::bind(&GUIManager::onMouseLeftWindow, this, _1));
+		mFontGlyphsEvictedConn = Font::onGlyphsEvicted.connect(std::bind(&GUIManager::onFontGlyphsEvicted, this, _1));
 
 		mInputCaret = bs_new<GUIInputCaret>();
 		mInputSelection = bs_new<GUIInputSelection>();
@@ -151,6 +153,7 @@ namespace bs
 		mWindowLostFocusConn.disconnect();
 
 		mMouseLeftWindowConn.disconnect();
+		mFontGlyphsEvictedConn.disconnect();
 
 		bs_delete(mInputCaret);
 		bs_delete(mInputSelection);
@@ -425,6 +428,20 @@ namespace bs
 
 	void GUIManager::updateMeshes()
 	{
+		// Text laid out before an eviction might reference characters no longer present in the font atlas, so all 
+		// elements are refreshed. Evictions are rare, so this doesn't bother finding the elements using the font. 
+		// Elements are only marked here, as evictions happen while the dirty elements are being updated.
+		if (mFontGlyphsEvicted)
+		{
+			for (auto& widgetInfo : mWidgets)
+			{
+				for (auto& element : widgetInfo.widget->getElements())
+					element->_markContentAsDirty();
+			}
+
+			mFontGlyphsEvicted = false;
+		}
+
 		for(auto& cachedMeshData : mCachedGUIData)
 		{
 			GUIRenderData& renderData = cachedMeshData.second;
@@ -1521,6 +1538,11 @@ namespace bs
 		}
 	}
 	
+	void GUIManager::onFontGlyphsEvicted(const Font& font)
+	{
+		mFontGlyphsEvicted = true;
+	}
+
 	void GUIManager::hideTooltip()
 	{
 		GUITooltipManager::instance().hide();
@@ -68,7 +68,7 @@ namespace bs
 	{
 		if (element->_getType() == GUIElementBase::Type::FixedSpace || element->_getType() == GUIElementBase::Type::FlexibleSpace)
 		{
-			LayoutSizeRange sizeRange = element->_getLayoutSizeRange();
+			LayoutSizeRange sizeRange = element->_getCachedSizeRange();
 			sizeRange.optimal.x = 0;
 			sizeRange.optimal.y = 0;
 			sizeRange.min.x = 0;
@@ -77,7 +77,7 @@ namespace bs
 			return sizeRange;
 		}
 
-		return element->_getLayoutSizeRange();
+		return element->_getCachedSizeRange();
 	}
 
 	void GUIPanel::_updateOptimalLayoutSizes()
@@ -258,6 +258,10 @@ namespace bs
 		childData.clipRect = data.area;
 		childData.clipRect.clip(data.clipRect);
 
+		// Children that didn't move and have nothing dirty in their hierarchy keep their current layout
+		if (!element->_needsLayoutUpdate(childData))
+			return;
+
 		element->_setLayoutData(childData);
 		element->_updateLayoutInternal(childData);
 	}
@@ -87,7 +87,7 @@ namespace bs
 		for (auto& child : mChildren)
 		{
 			if (child->_isActive())
-				mChildSizeRanges[childIdx] = child->_getLayoutSizeRange();
+				mChildSizeRanges[childIdx] = child->_getCachedSizeRange();
 			else
 				mChildSizeRanges[childIdx] = LayoutSizeRange();
 
@@ -157,9 +157,10 @@ namespace bs
 	{
 		bs_frame_mark();
 
-		// Determine dirty contents and layouts
+		// Determine dirty contents and layouts. Only hierarchies marked as dirty can contain elements needing an update.
 		FrameStack<GUIElementBase*> todo;
-		todo.push(mPanel);
+		if (mPanel->_isHierarchyDirty())
+			todo.push(mPanel);
 
 		while (!todo.empty())
 		{
@@ -180,7 +181,11 @@ namespace bs
 			{
 				UINT32 numChildren = currentElem->_getNumChildren();
 				for (UINT32 i = 0; i < numChildren; i++)
-					todo.push(currentElem->_getChild(i));
+				{
+					GUIElementBase* child = currentElem->_getChild(i);
+					if (child->_isHierarchyDirty())
+						todo.push(child);
+				}
 			}
 		}
 
@@ -199,6 +204,8 @@ namespace bs
 		else
 			updateParent = elem;
 
+		LayoutSizeRange oldSizeRange = updateParent->_getCachedSizeRange();
+
 		// For GUIPanel we can do a an optimization and update only the element in question instead
 		// of all the children
 		if (isPanelOptimized)
@@ -206,7 +213,9 @@ namespace bs
 			GUIPanel* panel = static_cast<GUIPanel*>(updateParent);
 
 			GUIElementBase* dirtyElement = elem;
-			dirtyElement->_updateOptimalLayoutSizes();
+
+			// Only dirty children are re-measured, so this is cheap and keeps the panel's cached size ranges valid
+			panel->_updateOptimalLayoutSizes();
 
 			LayoutSizeRange elementSizeRange = panel->_getElementSizeRange(dirtyElement);
 			Rect2I elementArea = panel->_getElementArea(panel->_getLayoutData().area, dirtyElement, elementSizeRange);
@@ -223,7 +232,8 @@ namespace bs
 			updateParent->_updateLayout(childLayoutData);
 		}
 		
-		// Mark dirty contents
+		// Mark dirty contents. Elements whose layout changed were already marked when their layout data was assigned, so
+		// only elements that requested the update themselves need to be found here.
 		bs_frame_mark();
 		{
 			FrameStack<GUIElementBase*> todo;
@@ -241,10 +251,42 @@ namespace bs
 
 				UINT32 numChildren = currentElem->_getNumChildren();
 				for (UINT32 i = 0; i < numChildren; i++)
-					todo.push(currentElem->_getChild(i));
+				{
+					GUIElementBase* child = currentElem->_getChild(i);
+					if (child->_isHierarchyDirty())
+						todo.push(child);
+				}
 			}
 		}
 		bs_frame_clear();
+
+		// If the size range of the updated hierarchy didn't change then the layout of its parents is still valid, and they
+		// can be cleaned up if they don't contain any other dirty elements. Otherwise they stay dirty so they get
+		// re-measured the next time they are laid out.
+		if (updateParent->_getCachedSizeRange() != oldSizeRange)
+			return;
+
+		GUIElementBase* currentParent = elem->_getParent();
+		while (currentParent != nullptr && currentParent->_isHierarchyDirty() && !currentParent->_isDirty())
+		{
+			bool hasDirtyChildren = false;
+
+			UINT32 numChildren = currentParent->_getNumChildren();
+			for (UINT32 i = 0; i < numChildren; i++)
+			{
+				if (currentParent->_getChild(i)->_isHierarchyDirty())
+				{
+					hasDirtyChildren = true;
+					break;
+				}
+			}
+
+			if (hasDirtyChildren)
+				break;
+
+			currentParent->_markAsClean();
+			currentParent = currentParent->_getParent();
+		}
 	}
 
 	void GUIWidget::_registerElement(GUIElementBase* elem)
@@ -250,6 +250,29 @@ namespace bs { namespace ct
 		mesh->_notifyUsedOnGPU();
 	}
 
+	void RendererUtility::drawSkinned(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, 
+		const SPtr<VertexBuffer>& vertices, UINT32 numInstances)
+	{
+		RenderAPI& rapi = RenderAPI::instance();
+
+		SPtr<VertexData> vertexData = mesh->getVertexData();
+		rapi.setVertexDeclaration(vertexData->vertexDeclaration);
+
+		SPtr<VertexBuffer> buffers[] = { vertices };
+		rapi.setVertexBuffers(0, buffers, 1);
+
+		SPtr<IndexBuffer> indexBuffer = mesh->getIndexBuffer();
+		rapi.setIndexBuffer(indexBuffer);
+
+		rapi.setDrawOperation(subMesh.drawOp);
+
+		UINT32 indexCount = subMesh.indexCount;
+		rapi.drawIndexed(subMesh.indexOffset + mesh->getIndexOffset(), indexCount, mesh->getVertexOffset(),
+			vertexData->vertexCount, numInstances);
+
+		mesh->_notifyUsedOnGPU();
+	}
+
 	void RendererUtility::blit(const SPtr<Texture>& texture, const Rect2I& area, bool flipUV, bool isDepth)
 	{
 		auto& texProps = texture->getProperties();
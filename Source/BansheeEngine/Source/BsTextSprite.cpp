@@ -4,6 +4,7 @@
 #include "BsTextData.h"
 #include "BsVector2.h"
 #include "BsSpriteManager.h"
+#include "BsFont.h"
 
 namespace bs
 {
@@ -17,38 +18,98 @@ namespace bs
 		clearMesh();
 	}
 
+	TextLayoutKey::TextLayoutKey()
+		: textHash(0), font(nullptr), fontVersion(0), fontSize(0), width(0), height(0), anchor(SA_TopLeft), horzAlign(THA_Left)
+		, vertAlign(TVA_Top), wordWrap(false), wordBreak(false)
+	{ }
+
+	TextLayoutKey::TextLayoutKey(const TEXT_SPRITE_DESC& desc)
+		: text(desc.text), textHash(std::hash<WString>()(desc.text)), font(nullptr), fontVersion(0)
+		, fontSize(desc.fontSize), width(desc.width), height(desc.height), anchor(desc.anchor), horzAlign(desc.horzAlign)
+		, vertAlign(desc.vertAlign), wordWrap(desc.wordWrap), wordBreak(desc.wordBreak)
+	{
+		if (desc.font.isLoaded(false))
+		{
+			font = desc.font.get();
+			fontVersion = font->_getGlyphCacheVersion();
+		}
+	}
+
+	bool TextLayoutKey::operator==(const TextLayoutKey& rhs) const
+	{
+		// Hash is compared first so that different strings are usually rejected without comparing their contents
+		return textHash == rhs.textHash && font == rhs.font && fontVersion == rhs.fontVersion &&
+			fontSize == rhs.fontSize && width == rhs.width && height == rhs.height && anchor == rhs.anchor &&
+			horzAlign == rhs.horzAlign && vertAlign == rhs.vertAlign && wordWrap == rhs.wordWrap &&
+			wordBreak == rhs.wordBreak && text == rhs.text;
+	}
+
 	void TextSprite::update(const TEXT_SPRITE_DESC& desc, UINT64 groupId)
 	{
+		TextLayoutKey layoutKey(desc);
+		if (layoutKey == mLayoutKey)
+		{
+			// Geometry is unchanged, only update the material properties
+			for (auto& cachedElem : mCachedRenderElements)
+			{
+				cachedElem.matInfo.groupId = groupId;
+				cachedElem.matInfo.tint = desc.color;
+			}
+
+			if (mFont.isLoaded(false))
+				mFont->_markPagesUsed(mFontPageMask);
+
+			return;
+		}
+
 		bs_frame_mark();
 		{
 			TextData<FrameAlloc> textData(desc.text, desc.font, desc.fontSize, desc.width, desc.height, desc.wordWrap, desc.wordBreak);
 
 			UINT32 numPages = textData.getNumPages();
 
-			// Free all previous memory
-			for (auto& cachedElem : mCachedRenderElements)
+			// Keep the existing buffers if they can fit the new geometry
+			bool reuseBuffers = mCachedRenderElements.size() == numPages;
+			for (UINT32 i = 0; i < numPages && reuseBuffers; i++)
+				reuseBuffers = textData.getNumQuadsForPage(i) <= mQuadCapacity[i];
+
+			if (!reuseBuffers)
 			{
-				if (cachedElem.vertices != nullptr) mAlloc.free(cachedElem.vertices);
-				if (cachedElem.uvs != nullptr) mAlloc.free(cachedElem.uvs);
-				if (cachedElem.indexes != nullptr) mAlloc.free(cachedElem.indexes);
-			}
+				// Free all previous memory
+				for (auto& cachedElem : mCachedRenderElements)
+				{
+					if (cachedElem.vertices != nullptr) mAlloc.free(cachedElem.vertices);
+					if (cachedElem.uvs != nullptr) mAlloc.free(cachedElem.uvs);
+					if (cachedElem.indexes != nullptr) mAlloc.free(cachedElem.indexes);
+				}
 
-			mAlloc.clear();
+				mAlloc.clear();
 
-			// Resize cached mesh array to needed size
-			if (mCachedRenderElements.size() != numPages)
-				mCachedRenderElements.resize(numPages);
+				// Resize cached mesh array to needed size
+				if (mCachedRenderElements.size() != numPages)
+				{
+					mCachedRenderElements.resize(numPages);
+					mQuadCapacity.resize(numPages);
+				}
+
+				for (UINT32 i = 0; i < numPages; i++)
+				{
+					UINT32 newNumQuads = textData.getNumQuadsForPage(i);
+
+					SpriteRenderElement& cachedElem = mCachedRenderElements[i];
+					cachedElem.vertices = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
+					cachedElem.uvs = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
+					cachedElem.indexes = (UINT32*)mAlloc.alloc(sizeof(UINT32) * newNumQuads * 6);
+
+					mQuadCapacity[i] = newNumQuads;
+				}
+			}
 
 			// Actually generate a mesh
 			UINT32 texPage = 0;
 			for (auto& cachedElem : mCachedRenderElements)
 			{
-				UINT32 newNumQuads = textData.getNumQuadsForPage(texPage);
-
-				cachedElem.vertices = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
-				cachedElem.uvs = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
-				cachedElem.indexes = (UINT32*)mAlloc.alloc(sizeof(UINT32) * newNumQuads * 6);
-				cachedElem.numQuads = newNumQuads;
+				cachedElem.numQuads = textData.getNumQuadsForPage(texPage);
 
 				const HTexture& tex = textData.getTextureForPage(texPage);
 
@@ -68,12 +129,29 @@ namespace bs
 				SpriteRenderElement& renderElem = mCachedRenderElements[j];
 
 				genTextQuads(j, textData, desc.width, desc.height, desc.horzAlign, desc.vertAlign, desc.anchor,
-					renderElem.vertices, renderElem.uvs, renderElem.indexes, renderElem.numQuads);
+					renderElem.vertices, renderElem.uvs, renderElem.indexes, mQuadCapacity[j]);
+			}
+
+			// Let the font know which of its pages are displayed, so they're not evicted before pages of text that is 
+			// no longer displayed
+			releaseFontPages();
+
+			if (desc.font.isLoaded(false))
+			{
+				for (UINT32 j = 0; j < numPages && j < 32; j++)
+				{
+					if (textData.getNumQuadsForPage(j) > 0)
+						mFontPageMask |= 1 << j;
+				}
+
+				mFont = desc.font;
+				mFont->_addPageReferences(mFontPageMask);
 			}
 		}
 
 		bs_frame_clear();
 
+		mLayoutKey = layoutKey;
 		updateBounds();
 	}
 
@@ -221,8 +299,21 @@ namespace bs
 		}
 
 		mCachedRenderElements.clear();
+		mQuadCapacity.clear();
 		mAlloc.clear();
 
+		mLayoutKey = TextLayoutKey();
+		releaseFontPages();
+
 		updateBounds();
 	}
+
+	void TextSprite::releaseFontPages()
+	{
+		if (mFont.isLoaded(false))
+			mFont->_removePageReferences(mFontPageMask);
+
+		mFont = nullptr;
+		mFontPageMask = 0;
+	}
 }
\ No newline at end of file
@@ -31,6 +31,10 @@ namespace bs
 		float animSampleRate = 1.0f / 60.0f;
 		bool animResample = false;
 		bool reduceKeyframes = true;
+		UINT32 numLODs = 0;
+		float lodReduction = 0.5f;
+		bool optimizeVertexOrder = true;
+		bool optimizeOverdraw = false;
 	};
 
 	/**	Represents a single node in the FBX transform hierarchy. */
@@ -43,6 +47,12 @@ namespace bs
 		String name;
 		FbxNode* fbxNode;
 
+		/** LOD group node this node is a part of, or null if not part of an LOD group. */
+		FBXImportNode* lodGroup;
+
+		/** Level of detail of the geometry referenced by this node, relevant only if part of an LOD group. */
+		UINT32 lodLevel;
+
 		Vector<FBXImportNode*> children;
 	};
 
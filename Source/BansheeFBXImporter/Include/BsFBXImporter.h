@@ -51,10 +51,12 @@ namespace bs
 
 		/** 
 		 * Reads the FBX file and outputs mesh data from the read file. Sub-mesh information will be output in @p subMeshes.
+		 * Sub-meshes for levels of detail other than the first, either authored in the file or generated on import, are
+		 * output in @p lodSubMeshes, and their screen sizes in @p lodScreenSizes (see MESH_DESC).
 		 */
 		SPtr<RendererMeshData> importMeshData(const Path& filePath, SPtr<const ImportOptions> importOptions, 
-			Vector<SubMesh>& subMeshes, Vector<FBXAnimationClipData>& animationClips, SPtr<Skeleton>& skeleton, 
-			SPtr<MorphShapes>& morphShapes);
+			Vector<SubMesh>& subMeshes, Vector<SubMesh>& lodSubMeshes, Vector<float>& lodScreenSizes,
+			Vector<FBXAnimationClipData>& animationClips, SPtr<Skeleton>& skeleton, SPtr<MorphShapes>& morphShapes);
 
 		/**
 		 * Loads the data from the file at the provided path into the provided FBX scene. Returns false if the file
@@ -133,9 +135,44 @@ namespace bs
 		 */
 		void generateMissingTangentSpace(FBXImportScene& scene, const FBXImportOptions& options);
 
-		/** Converts the mesh data from the imported FBX scene into mesh data that can be used for initializing a mesh. */
+		/** 
+		 * Converts the mesh data from the imported FBX scene into mesh data that can be used for initializing a mesh. 
+		 * Sub-meshes of geometry that is part of an LOD group, at a level other than the first, are output separately in
+		 * @p outputLODSubMeshes, in the format expected by MESH_DESC::lodSubMeshes.
+		 */
 		SPtr<RendererMeshData> generateMeshData(const FBXImportScene& scene, const FBXImportOptions& options, 
-			Vector<SubMesh>& outputSubMeshes);
+			Vector<SubMesh>& outputSubMeshes, Vector<SubMesh>& outputLODSubMeshes);
+
+		/**
+		 * Generates additional levels of detail by simplifying each of the provided sub-meshes. Simplified levels
+		 * reference the same vertices as the original mesh, and their indices are appended after the original indices.
+		 *
+		 * @param[in]	meshData			Mesh data containing the vertices and indices of the highest level of detail.
+		 * @param[in]	subMeshes			Sub-meshes of the highest level of detail.
+		 * @param[in]	options				Options determining the number of levels and how much to reduce each one.
+		 * @param[out]	outputLODSubMeshes	Sub-meshes of the generated levels, in the format expected by 
+		 *									MESH_DESC::lodSubMeshes.
+		 * @return							Mesh data containing the original vertices, and both the original and the
+		 *									generated indices.
+		 */
+		SPtr<MeshData> generateLODs(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes, 
+			const FBXImportOptions& options, Vector<SubMesh>& outputLODSubMeshes);
+
+		/** Creates a copy of the provided mesh data, with the same vertices but with its indices replaced. */
+		SPtr<MeshData> replaceIndices(const SPtr<MeshData>& meshData, const Vector<UINT32>& indices);
+
+		/**
+		 * Reorders triangles of all the provided sub-meshes for better vertex cache use (and optionally less overdraw),
+		 * and then reorders vertices in the order they are referenced. Mesh data is modified in place.
+		 *
+		 * @param[in]	meshData		Mesh data to optimize.
+		 * @param[in]	subMeshes		Sub-meshes of the highest level of detail.
+		 * @param[in]	lodSubMeshes	Sub-meshes of all other levels of detail, if any.
+		 * @param[in]	options			Options determining which optimizations to perform.
+		 * @param[out]	vertexRemap		New index of each vertex in the vertex buffer.
+		 */
+		void optimizeMesh(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes, 
+			const Vector<SubMesh>& lodSubMeshes, const FBXImportOptions& options, Vector<UINT32>& vertexRemap);
 
 		/** 
 		 * Parses the scene and outputs a skeleton for the imported meshes using the imported raw data. 
@@ -147,8 +184,15 @@ namespace bs
 		 */
 		SPtr<Skeleton> createSkeleton(const FBXImportScene& scene, bool sharedRoot);
 
-		/** Parses the scene and generates morph shapes for the imported meshes using the imported raw data. */
-		SPtr<MorphShapes> createMorphShapes(const FBXImportScene& scene);
+		/** 
+		 * Parses the scene and generates morph shapes for the imported meshes using the imported raw data. 
+		 *
+		 * @param[in]	scene		Scene whose meshes to parse.
+		 * @param[in]	vertexRemap	Maps indices of vertices in the combined mesh to their position after the vertices
+		 *							were reordered. Empty if vertices weren't reordered.
+		 * @return					Morph shapes for all the meshes, or null if meshes don't contain any.
+		 */
+		SPtr<MorphShapes> createMorphShapes(const FBXImportScene& scene, const Vector<UINT32>& vertexRemap);
 
 		/**	Creates an internal representation of an FBX node from an FbxNode object. */
 		FBXImportNode* createImportNode(FBXImportScene& scene, FbxNode* fbxNode, FBXImportNode* parent);
@@ -121,8 +121,8 @@ namespace bs
 		MESH_DESC desc;
 
 		Vector<FBXAnimationClipData> dummy;
-		SPtr<RendererMeshData> rendererMeshData = importMeshData(filePath, importOptions, desc.subMeshes, dummy, 
-			desc.skeleton, desc.morphShapes);
+		SPtr<RendererMeshData> rendererMeshData = importMeshData(filePath, importOptions, desc.subMeshes, 
+			desc.lodSubMeshes, desc.lodScreenSizes, dummy, desc.skeleton, desc.morphShapes);
 
 		const MeshImportOptions* meshImportOptions = static_cast<const MeshImportOptions*>(importOptions.get());
 
@@ -143,8 +143,8 @@ namespace bs
 		MESH_DESC desc;
 
 		Vector<FBXAnimationClipData> animationClips;
-		SPtr<RendererMeshData> rendererMeshData = importMeshData(filePath, importOptions, desc.subMeshes, animationClips, 
-			desc.skeleton, desc.morphShapes);
+		SPtr<RendererMeshData> rendererMeshData = importMeshData(filePath, importOptions, desc.subMeshes, 
+			desc.lodSubMeshes, desc.lodScreenSizes, animationClips, desc.skeleton, desc.morphShapes);
 
 		const MeshImportOptions* meshImportOptions = static_cast<const MeshImportOptions*>(importOptions.get());
 
@@ -170,7 +170,23 @@ namespace bs
 					PhysicsMeshType type = collisionMeshType == CollisionMeshType::Convex ? 
 						PhysicsMeshType::Convex : PhysicsMeshType::Triangle;
 
-					SPtr<PhysicsMesh> physicsMesh = PhysicsMesh::_createPtr(rendererMeshData->getData(), type);
+					// Only use the highest level of detail for collision
+					SPtr<MeshData> collisionMeshData = rendererMeshData->getData();
+					if(!desc.lodSubMeshes.empty())
+					{
+						UINT32* indices = collisionMeshData->getIndices32();
+
+						Vector<UINT32> collisionIndices;
+						for(auto& subMesh : desc.subMeshes)
+						{
+							collisionIndices.insert(collisionIndices.end(), indices + subMesh.indexOffset, 
+								indices + subMesh.indexOffset + subMesh.indexCount);
+						}
+
+						collisionMeshData = replaceIndices(collisionMeshData, collisionIndices);
+					}
+
+					SPtr<PhysicsMesh> physicsMesh = PhysicsMesh::_createPtr(collisionMeshData, type);
 
 					output.push_back({ L"collision", physicsMesh });
 				}
@@ -203,8 +219,8 @@ namespace bs
 	}
 
 	SPtr<RendererMeshData> FBXImporter::importMeshData(const Path& filePath, SPtr<const ImportOptions> importOptions, 
-		Vector<SubMesh>& subMeshes, Vector<FBXAnimationClipData>& animation, SPtr<Skeleton>& skeleton, 
-		SPtr<MorphShapes>& morphShapes)
+		Vector<SubMesh>& subMeshes, Vector<SubMesh>& lodSubMeshes, Vector<float>& lodScreenSizes, 
+		Vector<FBXAnimationClipData>& animation, SPtr<Skeleton>& skeleton, SPtr<MorphShapes>& morphShapes)
 	{
 		FbxScene* fbxScene = nullptr;
 
@@ -222,6 +238,10 @@ namespace bs
 		fbxImportOptions.importBlendShapes = meshImportOptions->getImportBlendShapes();
 		fbxImportOptions.importSkin = meshImportOptions->getImportSkin();
 		fbxImportOptions.importScale = meshImportOptions->getImportScale();
+		fbxImportOptions.numLODs = meshImportOptions->getNumLODs();
+		fbxImportOptions.lodReduction = meshImportOptions->getLODReduction();
+		fbxImportOptions.optimizeVertexOrder = meshImportOptions->getOptimizeVertexOrder();
+		fbxImportOptions.optimizeOverdraw = meshImportOptions->getOptimizeOverdraw();
 
 		FBXImportScene importedScene;
 		bakeTransforms(fbxScene);
@@ -239,10 +259,55 @@ namespace bs
 		splitMeshVertices(importedScene);
 		generateMissingTangentSpace(importedScene, fbxImportOptions);
 
-		SPtr<RendererMeshData> rendererMeshData = generateMeshData(importedScene, fbxImportOptions, subMeshes);
+		SPtr<RendererMeshData> rendererMeshData = generateMeshData(importedScene, fbxImportOptions, subMeshes, 
+			lodSubMeshes);
+
+		// Generate levels of detail, unless they were provided in the file
+		if (rendererMeshData != nullptr && lodSubMeshes.empty() && fbxImportOptions.numLODs > 0)
+		{
+			SPtr<MeshData> meshData = generateLODs(rendererMeshData->getData(), subMeshes, fbxImportOptions, 
+				lodSubMeshes);
+
+			rendererMeshData = RendererMeshData::create(meshData);
+		}
+
+		Vector<UINT32> vertexRemap;
+		if (rendererMeshData != nullptr && fbxImportOptions.optimizeVertexOrder)
+			optimizeMesh(rendererMeshData->getData(), subMeshes, lodSubMeshes, fbxImportOptions, vertexRemap);
+
+		// Switch to a lower level of detail once the object's screen size drops to the point where the number of its
+		// triangles per pixel matches the highest level of detail at full size
+		lodScreenSizes.clear();
+		if (!subMeshes.empty())
+		{
+			UINT32 numSubMeshes = (UINT32)subMeshes.size();
+			UINT32 numLODs = (UINT32)lodSubMeshes.size() / numSubMeshes;
+
+			UINT32 numIndices = 0;
+			for (auto& subMesh : subMeshes)
+				numIndices += subMesh.indexCount;
+
+			for (UINT32 i = 0; i < numLODs; i++)
+			{
+				UINT32 numLODIndices = 0;
+				for (UINT32 j = 0; j < numSubMeshes; j++)
+					numLODIndices += lodSubMeshes[i * numSubMeshes + j].indexCount;
+
+				float screenSize = 0.0f;
+				if (numIndices > 0)
+					screenSize = std::sqrt(numLODIndices / (float)numIndices);
 
-		skeleton = createSkeleton(importedScene, subMeshes.size() > 1);
-		morphShapes = createMorphShapes(importedScene);		
+				// Keep the sizes decreasing, even if an authored level has more triangles than the one before it
+				if (!lodScreenSizes.empty())
+					screenSize = std::min(screenSize, lodScreenSizes.back());
+
+				lodScreenSizes.push_back(screenSize);
+			}
+		}
+
+		// Authored levels of detail are separate meshes in the scene and require a shared root, while generated ones don't
+		skeleton = createSkeleton(importedScene, subMeshes.size() > 1 || importedScene.meshes.size() > 1);
+		morphShapes = createMorphShapes(importedScene, vertexRemap);
 
 		// Import animation clips
 		if (!importedScene.clips.empty())
@@ -251,7 +316,7 @@ namespace bs
 			convertAnimations(importedScene.clips, splits, skeleton, meshImportOptions->getImportRootMotion(), animation);
 		}
 
-		// TODO - Later: Optimize mesh: Remove bad and degenerate polygons, weld nearby vertices, optimize for vertex cache
+		// TODO - Later: Optimize mesh: Remove bad and degenerate polygons, weld nearby vertices
 
 		shutDownSdk();
 
@@ -337,7 +402,7 @@ namespace bs
 		return nullptr;
 	}
 
-	SPtr<MorphShapes> FBXImporter::createMorphShapes(const FBXImportScene& scene)
+	SPtr<MorphShapes> FBXImporter::createMorphShapes(const FBXImportScene& scene, const Vector<UINT32>& vertexRemap)
 	{
 		// Combine morph shapes from all sub-meshes, and transform them
 		struct RawMorphShape
@@ -397,8 +462,12 @@ namespace bs
 								else
 									normalDelta = Vector3::ZERO;
 
+								UINT32 vertexIdx = totalNumVertices + i;
+								if (!vertexRemap.empty())
+									vertexIdx = vertexRemap[vertexIdx];
+
 								if (positionDelta.squaredLength() > 0.000001f || normalDelta.squaredLength() > 0.0001f)
-									shape.vertices.push_back(MorphVertex(positionDelta, normalDelta, totalNumVertices + i));
+									shape.vertices.push_back(MorphVertex(positionDelta, normalDelta, vertexIdx));
 							}
 						}
 						else
@@ -598,9 +667,24 @@ namespace bs
 		node->localTransform.setTRS(translation, rotation, scale);
 		node->name = fbxNode->GetNameWithoutNameSpacePrefix().Buffer();
 		node->fbxNode = fbxNode;
+		node->lodGroup = nullptr;
+		node->lodLevel = 0;
 
 		if (parent != nullptr)
 		{
+			// Each child of an LOD group represents one level of detail
+			FbxNodeAttribute* parentAttrib = parent->fbxNode->GetNodeAttribute();
+			if (parentAttrib != nullptr && parentAttrib->GetAttributeType() == FbxNodeAttribute::eLODGroup)
+			{
+				node->lodGroup = parent;
+				node->lodLevel = (UINT32)parent->children.size();
+			}
+			else
+			{
+				node->lodGroup = parent->lodGroup;
+				node->lodLevel = parent->lodLevel;
+			}
+
 			node->worldTransform = node->localTransform * parent->worldTransform;
 
 			parent->children.push_back(node);
@@ -817,10 +901,11 @@ namespace bs
 	}
 
 	SPtr<RendererMeshData> FBXImporter::generateMeshData(const FBXImportScene& scene, const FBXImportOptions& options, 
-		Vector<SubMesh>& outputSubMeshes)
+		Vector<SubMesh>& outputSubMeshes, Vector<SubMesh>& outputLODSubMeshes)
 	{
 		Vector<SPtr<MeshData>> allMeshData;
 		Vector<Vector<SubMesh>> allSubMeshes;
+		Vector<FBXImportNode*> allNodes;
 		Vector<BONE_DESC> allBones;
 		UnorderedMap<FBXImportNode*, UINT32> boneMap;
 		UINT32 boneIndexOffset = 0;
@@ -1012,23 +1097,287 @@ namespace bs
 
 				allMeshData.push_back(meshData->getData());
 				allSubMeshes.push_back(subMeshes);
+				allNodes.push_back(node);
 			}
 
 			UINT32 numBones = (UINT32)mesh->bones.size();
 			boneIndexOffset += numBones;
 		}
 
+		if (allMeshData.empty())
+			return nullptr;
+
+		SPtr<MeshData> combinedMeshData;
+		Vector<SubMesh> combinedSubMeshes;
 		if (allMeshData.size() > 1)
+			combinedMeshData = MeshData::combine(allMeshData, allSubMeshes, combinedSubMeshes);
+		else
 		{
-			return RendererMeshData::create(MeshData::combine(allMeshData, allSubMeshes, outputSubMeshes));
+			combinedSubMeshes = allSubMeshes[0];
+			combinedMeshData = allMeshData[0];
 		}
-		else if (allMeshData.size() == 1)
+
+		UINT32 numLODs = 1;
+		bool hasFirstLOD = false;
+		for (auto& node : allNodes)
 		{
-			outputSubMeshes = allSubMeshes[0];
-			return RendererMeshData::create(allMeshData[0]);
+			numLODs = std::max(numLODs, node->lodLevel + 1);
+			hasFirstLOD |= node->lodLevel == 0;
 		}
 
-		return nullptr;
+		if (numLODs == 1 || !hasFirstLOD)
+		{
+			outputSubMeshes = combinedSubMeshes;
+			return RendererMeshData::create(combinedMeshData);
+		}
+
+		// Geometry from the first level of detail of LOD groups, as well as geometry not in any LOD group, makes up the
+		// primary set of sub-meshes. Geometry from other levels of detail is then matched to those sub-meshes by the
+		// LOD group it belongs to and its sub-mesh index within its node (i.e. the index of its material on the node). 
+		// If multiple nodes in the same level provide the same sub-mesh index they're assigned to matching first level
+		// sub-meshes in the order the nodes are encountered.
+		Map<std::pair<FBXImportNode*, UINT32>, Vector<UINT32>> lodSubMeshSlots;
+		Vector<UINT32> firstSubMeshIndices(allNodes.size());
+
+		UINT32 subMeshIdx = 0;
+		for (UINT32 i = 0; i < (UINT32)allNodes.size(); i++)
+		{
+			firstSubMeshIndices[i] = (UINT32)outputSubMeshes.size();
+
+			FBXImportNode* node = allNodes[i];
+			UINT32 numSubMeshes = (UINT32)allSubMeshes[i].size();
+			if (node->lodLevel == 0)
+			{
+				for (UINT32 j = 0; j < numSubMeshes; j++)
+				{
+					if (node->lodGroup != nullptr)
+						lodSubMeshSlots[std::make_pair(node->lodGroup, j)].push_back((UINT32)outputSubMeshes.size());
+
+					outputSubMeshes.push_back(combinedSubMeshes[subMeshIdx + j]);
+				}
+			}
+
+			subMeshIdx += numSubMeshes;
+		}
+
+		UINT32 numOutputSubMeshes = (UINT32)outputSubMeshes.size();
+		outputLODSubMeshes.resize((numLODs - 1) * numOutputSubMeshes);
+
+		Map<std::tuple<FBXImportNode*, UINT32, UINT32>, UINT32> numUsedSlots;
+		subMeshIdx = 0;
+		for (UINT32 i = 0; i < (UINT32)allNodes.size(); i++)
+		{
+			FBXImportNode* node = allNodes[i];
+			UINT32 numSubMeshes = (UINT32)allSubMeshes[i].size();
+			for (UINT32 j = 0; j < numSubMeshes; j++)
+			{
+				const SubMesh& subMesh = combinedSubMeshes[subMeshIdx + j];
+
+				// Geometry outside of LOD groups is present at every level
+				if (node->lodGroup == nullptr)
+				{
+					for (UINT32 k = 1; k < numLODs; k++)
+						outputLODSubMeshes[(k - 1) * numOutputSubMeshes + firstSubMeshIndices[i] + j] = subMesh;
+				}
+				else if (node->lodLevel > 0 && subMesh.indexCount > 0)
+				{
+					auto iterFind = lodSubMeshSlots.find(std::make_pair(node->lodGroup, j));
+					UINT32& slotIdx = numUsedSlots[std::make_tuple(node->lodGroup, j, node->lodLevel)];
+
+					if (iterFind == lodSubMeshSlots.end() || slotIdx >= (UINT32)iterFind->second.size())
+					{
+						LOGWRN("Ignoring LOD " + toString(node->lodLevel) + " geometry of node \"" + node->name + 
+							"\" as it doesn't have matching geometry in the first level of detail.");
+						continue;
+					}
+
+					outputLODSubMeshes[(node->lodLevel - 1) * numOutputSubMeshes + iterFind->second[slotIdx]] = subMesh;
+					slotIdx++;
+				}
+			}
+
+			subMeshIdx += numSubMeshes;
+		}
+
+		return RendererMeshData::create(combinedMeshData);
+	}
+
+	SPtr<MeshData> FBXImporter::generateLODs(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes, 
+		const FBXImportOptions& options, Vector<SubMesh>& outputLODSubMeshes)
+	{
+		UINT32 numVertices = meshData->getNumVertices();
+		Vector<Vector3> positions(numVertices);
+		meshData->getVertexData(VES_POSITION, (UINT8*)positions.data(), numVertices * sizeof(Vector3));
+
+		UINT32 numIndices = meshData->getNumIndices();
+		UINT32 indexSize = meshData->getIndexElementSize();
+
+		UINT8* srcIndices = meshData->getIndexData();
+
+		Vector<UINT32> indices(numIndices);
+		for (UINT32 i = 0; i < numIndices; i++)
+			memcpy(&indices[i], srcIndices + i * indexSize, indexSize);
+
+		// Each level is generated by simplifying the previous one, which is both faster and keeps the levels consistent
+		Vector<Vector<UINT32>> previousLevel(subMeshes.size());
+		for (UINT32 i = 0; i < (UINT32)subMeshes.size(); i++)
+		{
+			const SubMesh& subMesh = subMeshes[i];
+			if (subMesh.drawOp != DOT_TRIANGLE_LIST)
+				continue;
+
+			previousLevel[i].assign(indices.begin() + subMesh.indexOffset, 
+				indices.begin() + subMesh.indexOffset + subMesh.indexCount);
+		}
+
+		float reduction = Math::clamp(options.lodReduction, 0.01f, 0.99f);
+		float factor = 1.0f;
+
+		Vector<UINT32> simplifiedIndices;
+		for (UINT32 i = 0; i < options.numLODs; i++)
+		{
+			factor *= reduction;
+
+			bool anyReduced = false;
+			UINT32 levelStart = (UINT32)indices.size();
+			Vector<SubMesh> levelSubMeshes;
+			for (UINT32 j = 0; j < (UINT32)subMeshes.size(); j++)
+			{
+				Vector<UINT32>& source = previousLevel[j];
+				UINT32 targetNumIndices = (UINT32)(subMeshes[j].indexCount * factor) / 3 * 3;
+
+				MeshUtility::simplify(positions.data(), (UINT8*)source.data(), numVertices, (UINT32)source.size(), 
+					targetNumIndices, simplifiedIndices);
+
+				anyReduced |= simplifiedIndices.size() < source.size();
+
+				levelSubMeshes.push_back(SubMesh((UINT32)indices.size(), (UINT32)simplifiedIndices.size(), 
+					DOT_TRIANGLE_LIST));
+				indices.insert(indices.end(), simplifiedIndices.begin(), simplifiedIndices.end());
+
+				std::swap(source, simplifiedIndices);
+			}
+
+			// Stop once the mesh cannot be simplified any further
+			if (!anyReduced)
+			{
+				indices.resize(levelStart);
+				break;
+			}
+
+			outputLODSubMeshes.insert(outputLODSubMeshes.end(), levelSubMeshes.begin(), levelSubMeshes.end());
+		}
+
+		return replaceIndices(meshData, indices);
+	}
+
+	SPtr<MeshData> FBXImporter::replaceIndices(const SPtr<MeshData>& meshData, const Vector<UINT32>& indices)
+	{
+		UINT32 numIndices = (UINT32)indices.size();
+		SPtr<MeshData> output = MeshData::create(meshData->getNumVertices(), numIndices, meshData->getVertexDesc());
+
+		memcpy(output->getIndices32(), indices.data(), numIndices * sizeof(UINT32));
+
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		UINT32 numStreams = vertexDesc->getMaxStreamIdx() + 1;
+		for (UINT32 i = 0; i < numStreams; i++)
+		{
+			if (!vertexDesc->hasStream(i))
+				continue;
+
+			UINT32 streamSize = vertexDesc->getVertexStride(i) * meshData->getNumVertices();
+			memcpy(output->getStreamData(i), meshData->getStreamData(i), streamSize);
+		}
+
+		return output;
+	}
+
+	void FBXImporter::optimizeMesh(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes, 
+		const Vector<SubMesh>& lodSubMeshes, const FBXImportOptions& options, Vector<UINT32>& vertexRemap)
+	{
+		static const UINT32 VERTEX_CACHE_SIZE = 16;
+
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numIndices = meshData->getNumIndices();
+		UINT32 indexSize = meshData->getIndexElementSize();
+
+		UINT8* indices = meshData->getIndexData();
+
+		Vector<Vector3> positions;
+		if (options.optimizeOverdraw)
+		{
+			positions.resize(numVertices);
+			meshData->getVertexData(VES_POSITION, (UINT8*)positions.data(), numVertices * sizeof(Vector3));
+		}
+
+		// Reorder triangles within each sub-mesh. Sub-meshes of geometry present in multiple levels of detail can
+		// reference the same indices, so make sure each is only processed once.
+		UnorderedSet<UINT32> processedOffsets;
+		float numMissesBefore = 0.0f;
+		float numMissesAfter = 0.0f;
+		UINT32 numTriangles = 0;
+
+		auto optimizeSubMesh = [&](const SubMesh& subMesh)
+		{
+			if (subMesh.drawOp != DOT_TRIANGLE_LIST || subMesh.indexCount < 3)
+				return;
+
+			if (!processedOffsets.insert(subMesh.indexOffset).second)
+				return;
+
+			UINT8* subMeshIndices = indices + subMesh.indexOffset * indexSize;
+			UINT32 numSubMeshTriangles = subMesh.indexCount / 3;
+
+			numMissesBefore += MeshUtility::calculateACMR(subMeshIndices, numVertices, subMesh.indexCount, 
+				VERTEX_CACHE_SIZE, indexSize) * numSubMeshTriangles;
+
+			MeshUtility::optimizeVertexCache(subMeshIndices, numVertices, subMesh.indexCount, VERTEX_CACHE_SIZE, 
+				indexSize);
+
+			if (options.optimizeOverdraw)
+			{
+				MeshUtility::optimizeOverdraw(positions.data(), subMeshIndices, numVertices, subMesh.indexCount, 1.05f,
+					VERTEX_CACHE_SIZE, indexSize);
+			}
+
+			numMissesAfter += MeshUtility::calculateACMR(subMeshIndices, numVertices, subMesh.indexCount, 
+				VERTEX_CACHE_SIZE, indexSize) * numSubMeshTriangles;
+			numTriangles += numSubMeshTriangles;
+		};
+
+		for (auto& subMesh : subMeshes)
+			optimizeSubMesh(subMesh);
+
+		for (auto& subMesh : lodSubMeshes)
+			optimizeSubMesh(subMesh);
+
+		if (numTriangles > 0)
+		{
+			LOGDBG("Vertex cache miss ratio (ACMR) before optimization: " + toString(numMissesBefore / numTriangles) + 
+				", after optimization: " + toString(numMissesAfter / numTriangles));
+		}
+
+		// Renumber vertices in the order they're first referenced, and move the vertex data accordingly
+		MeshUtility::optimizeVertexFetch(indices, numVertices, numIndices, vertexRemap, indexSize);
+
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		UINT32 numStreams = 0;
+		for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+			numStreams = std::max(numStreams, (UINT32)vertexDesc->getElement(i).getStreamIdx() + 1);
+
+		Vector<UINT8> sourceVertices;
+		for (UINT32 i = 0; i < numStreams; i++)
+		{
+			UINT32 stride = vertexDesc->getVertexStride(i);
+			if (stride == 0)
+				continue;
+
+			UINT8* streamData = meshData->getStreamData(i);
+
+			sourceVertices.assign(streamData, streamData + numVertices * stride);
+			for (UINT32 j = 0; j < numVertices; j++)
+				memcpy(streamData + vertexRemap[j] * stride, sourceVertices.data() + j * stride, stride);
+		}
 	}
 
 	template<class TFBX, class TNative>
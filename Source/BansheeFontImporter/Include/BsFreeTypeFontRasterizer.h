@@ -0,0 +1,65 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsFontPrerequisites.h"
+#include "BsFontRasterizer.h"
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+namespace bs
+{
+	/** @addtogroup Font
+	 *  @{
+	 */
+
+	/** Font face implementation that rasterizes characters using the FreeType library. */
+	class FreeTypeFontFace : public FontFace
+	{
+	public:
+		FreeTypeFontFace(FT_Library library, FT_Face face, UINT32 dpi, FT_Int32 loadFlags);
+		~FreeTypeFontFace();
+
+		/** @copydoc FontFace::getMetrics */
+		void getMetrics(UINT32 size, INT32& baselineOffset, UINT32& lineHeight, UINT32& spaceWidth) override;
+
+		/** @copydoc FontFace::rasterize */
+		bool rasterize(UINT32 charId, UINT32 size, RASTERIZED_GLYPH& output) override;
+
+		/** @copydoc FontFace::hasKerning */
+		bool hasKerning() const override;
+
+		/** @copydoc FontFace::getKerning */
+		INT32 getKerning(UINT32 leftCharId, UINT32 rightCharId, UINT32 size) override;
+
+	private:
+		/** Sets the size of the characters to be rasterized, if different from the current size. */
+		void setSize(UINT32 size);
+
+		FT_Library mLibrary;
+		FT_Face mFace;
+		UINT32 mDPI;
+		FT_Int32 mLoadFlags;
+		UINT32 mSize;
+	};
+
+	/** Font rasterizer that creates font faces using the FreeType library. */
+	class FreeTypeFontRasterizer : public FontRasterizer
+	{
+	public:
+		/** @copydoc FontRasterizer::createFace */
+		SPtr<FontFace> createFace(const UINT8* data, UINT32 size, UINT32 dpi, FontRenderMode renderMode) override;
+
+		/** Returns FreeType glyph load flags corresponding to the provided render mode. */
+		static FT_Int32 getLoadFlags(FontRenderMode renderMode);
+
+		/**
+		 * Copies the bitmap of the glyph currently loaded in the provided face into a buffer with one byte per pixel.
+		 * Returns false if the bitmap is in an unsupported format.
+		 */
+		static bool copyBitmap(FT_Face face, UINT8* output, UINT32 outputPitch);
+	};
+
+	/** @} */
+}
\ No newline at end of file
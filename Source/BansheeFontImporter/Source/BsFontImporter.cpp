@@ -2,6 +2,9 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsFontImporter.h"
 #include "BsFontImportOptions.h"
+#include "BsFreeTypeFontRasterizer.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
 #include "BsPixelData.h"
 #include "BsTexture.h"
 #include "BsTextureAtlasLayout.h"
@@ -51,6 +54,24 @@ namespace bs
 	{
 		const FontImportOptions* fontImportOptions = static_cast<const FontImportOptions*>(importOptions.get());
 
+		// Dynamic fonts keep the source data and rasterize characters on demand at runtime
+		if (fontImportOptions->getDynamic())
+		{
+			SPtr<DataStream> fileData = FileSystem::openFile(filePath);
+			if (fileData == nullptr)
+				BS_EXCEPT(InternalErrorException, "Failed to load font file: " + filePath.toString() + ".");
+
+			SPtr<Font> newFont = Font::_createDynamicPtr(fileData, fontImportOptions->getDPI(), 
+				fontImportOptions->getRenderMode(), fontImportOptions->getSDF());
+
+			fileData->close();
+
+			WString fileName = filePath.getWFilename(false);
+			newFont->setName(fileName);
+
+			return newFont;
+		}
+
 		FT_Library library;
 
 		FT_Error error = FT_Init_FreeType(&library);
@@ -73,25 +94,7 @@ namespace bs
 		Vector<UINT32> fontSizes = fontImportOptions->getFontSizes();
 		UINT32 dpi = fontImportOptions->getDPI();
 
-		FT_Int32 loadFlags;
-		switch (fontImportOptions->getRenderMode())
-		{
-		case FontRenderMode::Smooth:
-			loadFlags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
-			break;
-		case FontRenderMode::Raster:
-			loadFlags = FT_LOAD_TARGET_MONO | FT_LOAD_NO_HINTING;
-			break;
-		case FontRenderMode::HintedSmooth:
-			loadFlags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_AUTOHINT;
-			break;
-		case FontRenderMode::HintedRaster:
-			loadFlags = FT_LOAD_TARGET_MONO | FT_LOAD_NO_AUTOHINT;
-			break;
-		default:
-			loadFlags = FT_LOAD_TARGET_NORMAL;
-			break;
-		}
+		FT_Int32 loadFlags = FreeTypeFontRasterizer::getLoadFlags(fontImportOptions->getRenderMode());
 
 		FT_Render_Mode renderMode = FT_LOAD_TARGET_MODE(loadFlags);
 
@@ -3,6 +3,8 @@
 #include "BsFontPrerequisites.h"
 #include "BsImporter.h"
 #include "BsFontImporter.h"
+#include "BsFreeTypeFontRasterizer.h"
+#include "BsFontManager.h"
 
 namespace bs
 {
@@ -19,6 +21,8 @@ namespace bs
 		FontImporter* importer = bs_new<FontImporter>();
 		Importer::instance()._registerAssetImporter(importer);
 
+		FontManager::instance()._setRasterizer(bs_shared_ptr_new<FreeTypeFontRasterizer>());
+
 		return nullptr;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,170 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsFreeTypeFontRasterizer.h"
+
+namespace bs
+{
+	FreeTypeFontFace::FreeTypeFontFace(FT_Library library, FT_Face face, UINT32 dpi, FT_Int32 loadFlags)
+		:mLibrary(library), mFace(face), mDPI(dpi), mLoadFlags(loadFlags), mSize(0)
+	{ }
+
+	FreeTypeFontFace::~FreeTypeFontFace()
+	{
+		FT_Done_Face(mFace);
+		FT_Done_FreeType(mLibrary);
+	}
+
+	void FreeTypeFontFace::getMetrics(UINT32 size, INT32& baselineOffset, UINT32& lineHeight, UINT32& spaceWidth)
+	{
+		setSize(size);
+
+		const FT_Size_Metrics& metrics = mFace->size->metrics;
+		baselineOffset = (INT32)(metrics.ascender >> 6);
+		lineHeight = (UINT32)((metrics.ascender - metrics.descender) >> 6);
+
+		spaceWidth = 0;
+		if (FT_Load_Char(mFace, 32, mLoadFlags) == 0)
+			spaceWidth = (UINT32)(mFace->glyph->advance.x >> 6);
+	}
+
+	bool FreeTypeFontFace::rasterize(UINT32 charId, UINT32 size, RASTERIZED_GLYPH& output)
+	{
+		setSize(size);
+
+		FT_UInt glyphIdx = 0;
+		if (charId != MISSING_GLYPH)
+		{
+			glyphIdx = FT_Get_Char_Index(mFace, (FT_ULong)charId);
+			if (glyphIdx == 0)
+				return false;
+		}
+
+		if (FT_Load_Glyph(mFace, glyphIdx, mLoadFlags))
+			return false;
+
+		if (FT_Render_Glyph(mFace->glyph, (FT_Render_Mode)FT_LOAD_TARGET_MODE(mLoadFlags)))
+			return false;
+
+		FT_GlyphSlot slot = mFace->glyph;
+
+		output.width = (UINT32)slot->bitmap.width;
+		output.height = (UINT32)slot->bitmap.rows;
+		output.xOffset = slot->bitmap_left;
+		output.yOffset = slot->bitmap_top;
+		output.xAdvance = (INT32)(slot->advance.x >> 6);
+		output.yAdvance = (INT32)(slot->advance.y >> 6);
+		output.pixels.resize(output.width * output.height);
+
+		if (output.pixels.empty())
+			return true;
+
+		if (slot->bitmap.buffer == nullptr)
+			return false;
+
+		return FreeTypeFontRasterizer::copyBitmap(mFace, output.pixels.data(), output.width);
+	}
+
+	bool FreeTypeFontFace::hasKerning() const
+	{
+		return FT_HAS_KERNING(mFace) != 0;
+	}
+
+	INT32 FreeTypeFontFace::getKerning(UINT32 leftCharId, UINT32 rightCharId, UINT32 size)
+	{
+		setSize(size);
+
+		FT_UInt leftIdx = FT_Get_Char_Index(mFace, (FT_ULong)leftCharId);
+		FT_UInt rightIdx = FT_Get_Char_Index(mFace, (FT_ULong)rightCharId);
+
+		FT_Vector kerning;
+		if (FT_Get_Kerning(mFace, leftIdx, rightIdx, FT_KERNING_DEFAULT, &kerning))
+			return 0;
+
+		return (INT32)(kerning.x >> 6); // Y kerning is ignored because it is so rare
+	}
+
+	void FreeTypeFontFace::setSize(UINT32 size)
+	{
+		if (mSize == size)
+			return;
+
+		FT_F26Dot6 ftSize = (FT_F26Dot6)(size * (1 << 6));
+		if (FT_Set_Char_Size(mFace, ftSize, 0, mDPI, mDPI))
+			LOGERR("Could not set character size: " + toString(size));
+
+		mSize = size;
+	}
+
+	SPtr<FontFace> FreeTypeFontRasterizer::createFace(const UINT8* data, UINT32 size, UINT32 dpi,
+		FontRenderMode renderMode)
+	{
+		FT_Library library;
+		if (FT_Init_FreeType(&library))
+		{
+			LOGERR("Error occurred during FreeType library initialization.");
+			return nullptr;
+		}
+
+		FT_Face face;
+		if (FT_New_Memory_Face(library, (const FT_Byte*)data, (FT_Long)size, 0, &face))
+		{
+			FT_Done_FreeType(library);
+			return nullptr;
+		}
+
+		return bs_shared_ptr_new<FreeTypeFontFace>(library, face, dpi, getLoadFlags(renderMode));
+	}
+
+	FT_Int32 FreeTypeFontRasterizer::getLoadFlags(FontRenderMode renderMode)
+	{
+		switch (renderMode)
+		{
+		case FontRenderMode::Smooth:
+			return FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
+		case FontRenderMode::Raster:
+			return FT_LOAD_TARGET_MONO | FT_LOAD_NO_HINTING;
+		case FontRenderMode::HintedSmooth:
+			return FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_AUTOHINT;
+		case FontRenderMode::HintedRaster:
+			return FT_LOAD_TARGET_MONO | FT_LOAD_NO_AUTOHINT;
+		default:
+			return FT_LOAD_TARGET_NORMAL;
+		}
+	}
+
+	bool FreeTypeFontRasterizer::copyBitmap(FT_Face face, UINT8* output, UINT32 outputPitch)
+	{
+		FT_GlyphSlot slot = face->glyph;
+
+		UINT8* sourceBuffer = slot->bitmap.buffer;
+		if (slot->bitmap.pixel_mode == ft_pixel_mode_grays)
+		{
+			for (INT32 bitmapRow = 0; bitmapRow < (INT32)slot->bitmap.rows; bitmapRow++)
+			{
+				memcpy(output, sourceBuffer, slot->bitmap.width);
+
+				output += outputPitch;
+				sourceBuffer += slot->bitmap.pitch;
+			}
+		}
+		else if (slot->bitmap.pixel_mode == ft_pixel_mode_mono)
+		{
+			// 8 pixels are packed into a byte, so do some unpacking
+			for (INT32 bitmapRow = 0; bitmapRow < (INT32)slot->bitmap.rows; bitmapRow++)
+			{
+				for (INT32 bitmapColumn = 0; bitmapColumn < (INT32)slot->bitmap.width; bitmapColumn++)
+				{
+					UINT8 srcValue = sourceBuffer[bitmapColumn >> 3];
+					output[bitmapColumn] = (srcValue & (128 >> (bitmapColumn & 7))) != 0 ? 255 : 0;
+				}
+
+				output += outputPitch;
+				sourceBuffer += slot->bitmap.pitch;
+			}
+		}
+		else
+			return false;
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include "FreeImage.h"
 #include "BsBitwise.h"
 #include "BsRenderer.h"
+#include "BsTaskScheduler.h"
 
 using namespace std::placeholders;
 
@@ -35,6 +36,33 @@ namespace bs
 		}
 	}
 
+	/**
+	 * Queues the provided worker on the task scheduler and adds its task to the provided list. If the task scheduler
+	 * isn't running the worker is executed immediately instead.
+	 */
+	void runImportTask(const String& name, const std::function<void()>& worker, Vector<SPtr<Task>>& tasks)
+	{
+		if (!TaskScheduler::isStarted())
+		{
+			worker();
+			return;
+		}
+
+		SPtr<Task> task = Task::create(name, worker);
+		TaskScheduler::instance().addTask(task);
+
+		tasks.push_back(task);
+	}
+
+	/** Blocks until all tasks in the provided list complete, and clears the list. */
+	void waitImportTasks(Vector<SPtr<Task>>& tasks)
+	{
+		for (auto& task : tasks)
+			task->wait();
+
+		tasks.clear();
+	}
+
 	FreeImgImporter::FreeImgImporter()
 		:SpecificImporter() 
 	{
@@ -193,29 +221,54 @@ namespace bs
 
 		SPtr<Texture> newTexture = Texture::_createPtr(texDesc);
 
+		if (textureImportOptions->getStreamable())
+			newTexture->setStreamable(true);
+
+		// Mip-maps of each face are generated in parallel, after which every mip level of every face is converted (and
+		// compressed, if needed) into the texture format in parallel. Data is written to the texture once all are done.
 		UINT32 numFaces = (UINT32)faceData.size();
-		for (UINT32 i = 0; i < numFaces; i++)
+		Vector<Vector<SPtr<PixelData>>> mipLevels(numFaces);
+		Vector<SPtr<Task>> tasks;
+
+		auto generateMipmaps = [&](UINT32 face)
 		{
-			Vector<SPtr<PixelData>> mipLevels;
 			if (numMips > 0)
 			{
 				MipMapGenOptions mipOptions;
 				mipOptions.isSRGB = sRGB;
 
-				mipLevels = PixelUtil::genMipmaps(*faceData[i], mipOptions);
+				mipLevels[face] = PixelUtil::genMipmaps(*faceData[face], mipOptions);
 			}
 			else
-				mipLevels.push_back(faceData[i]);
+				mipLevels[face].push_back(faceData[face]);
+		};
 
-			for (UINT32 mip = 0; mip < (UINT32)mipLevels.size(); ++mip)
+		for (UINT32 i = 0; i < numFaces; i++)
+			runImportTask("GenerateMipmaps", std::bind(generateMipmaps, i), tasks);
+
+		waitImportTasks(tasks);
+
+		Vector<Vector<SPtr<PixelData>>> outputLevels(numFaces);
+		for (UINT32 i = 0; i < numFaces; i++)
+		{
+			for (UINT32 mip = 0; mip < (UINT32)mipLevels[i].size(); ++mip)
 			{
+				SPtr<PixelData> src = mipLevels[i][mip];
 				SPtr<PixelData> dst = newTexture->getProperties().allocBuffer(0, mip);
+				outputLevels[i].push_back(dst);
 
-				PixelUtil::bulkPixelConversion(*mipLevels[mip], *dst);
-				newTexture->writeData(dst, i, mip);
+				runImportTask("ConvertMipmap", [src, dst]() { PixelUtil::bulkPixelConversion(*src, *dst); }, tasks);
 			}
 		}
 
+		waitImportTasks(tasks);
+
+		for (UINT32 i = 0; i < numFaces; i++)
+		{
+			for (UINT32 mip = 0; mip < (UINT32)outputLevels[i].size(); ++mip)
+				newTexture->writeData(outputLevels[i][mip], i, mip);
+		}
+
 		fileData->close();
 
 		WString fileName = filePath.getWFilename(false);
@@ -33,6 +33,7 @@ set(BS_BANSHEEGLRENDERAPI_INC_NOFILTER
 	"Include/BsGLCommandBuffer.h"
 	"Include/BsGLCommandBufferManager.h"
 	"Include/BsGLTextureView.h"
+	"Include/BsGLUniformBufferRing.h"
 )
 
 set(BS_BANSHEEGLRENDERAPI_SRC_WIN32
@@ -70,6 +71,7 @@ set(BS_BANSHEEGLRENDERAPI_SRC_NOFILTER
 	"Source/BsGLCommandBuffer.cpp"
 	"Source/BsGLCommandBufferManager.cpp"
 	"Source/BsGLTextureView.cpp"
+	"Source/BsGLUniformBufferRing.cpp"
 )
 
 set(BS_BANSHEEGLRENDERAPI_INC_GLSL
@@ -21,14 +21,29 @@ namespace bs { namespace ct
 		/** @copydoc GpuParamBlockBuffer::writeToGPU */
 		void writeToGPU(const UINT8* data, UINT32 queueIdx = 0) override;
 
-		/**	Returns internal OpenGL uniform buffer handle. */
-		GLuint getGLHandle() const { return mGLHandle; }
+		/** 
+		 * Makes sure the most recent contents of the buffer are available to the GPU. Must be called before binding the
+		 * buffer using the handle and offset returned by getGLHandle() and getGLOffset().
+		 */
+		void prepareForBind();
+
+		/**	
+		 * Returns internal OpenGL uniform buffer handle. For buffers sub-allocated from the GLUniformBufferRing this is
+		 * the handle of the ring buffer.
+		 */
+		GLuint getGLHandle() const;
+
+		/** Returns the offset of the buffer's contents in the OpenGL uniform buffer returned by getGLHandle(). */
+		UINT32 getGLOffset() const { return mRingOffset; }
 	protected:
 		/** @copydoc GpuParamBlockBuffer::initialize */
 		void initialize() override ;
 
 	private:
 		GLuint mGLHandle;
+		bool mUseRing;
+		UINT32 mRingOffset;
+		UINT32 mRingGeneration;
 	};
 
 	/** @} */
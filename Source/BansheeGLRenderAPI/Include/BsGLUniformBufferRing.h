@@ -0,0 +1,60 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsGLPrerequisites.h"
+#include "BsModule.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup GL
+	 *  @{
+	 */
+
+	/**
+	 * Large uniform buffer that contents of dynamic GPU parameter blocks are linearly sub-allocated from. Every write 
+	 * goes to a new range in the buffer, so writes never touch data that previously issued draws might still be reading,
+	 * and param blocks get bound as ranges of this buffer. When the buffer fills up its storage is orphaned and allocation
+	 * restarts from the beginning. Any ranges written before that are no longer valid for new draws, which is reported 
+	 * by the change in getGeneration().
+	 */
+	class GLUniformBufferRing : public Module<GLUniformBufferRing>
+	{
+	public:
+		/** Default size of the ring buffer, in bytes. */
+		static const UINT32 DEFAULT_SIZE = 4 * 1024 * 1024;
+
+		GLUniformBufferRing(UINT32 size = DEFAULT_SIZE);
+		~GLUniformBufferRing();
+
+		/** 
+		 * Allocates a new range in the buffer and writes the provided data to it.
+		 *
+		 * @param[in]	data	Data to write.
+		 * @param[in]	size	Size of the data in bytes. Must not be larger than the size of the ring buffer.
+		 * @return				Offset of the written data from the start of the buffer, in bytes.
+		 */
+		UINT32 write(const UINT8* data, UINT32 size);
+
+		/** Returns the internal OpenGL uniform buffer handle. */
+		GLuint getGLHandle() const { return mGLHandle; }
+
+		/** Returns the size of the ring buffer in bytes. */
+		UINT32 getSize() const { return mSize; }
+
+		/** 
+		 * Returns a counter that is incremented whenever the buffer storage is orphaned. Ranges written during an earlier
+		 * generation must be re-written before being bound again.
+		 */
+		UINT32 getGeneration() const { return mGeneration; }
+
+	private:
+		GLuint mGLHandle;
+		UINT32 mSize;
+		UINT32 mAlignment;
+		UINT32 mOffset;
+		UINT32 mGeneration;
+	};
+
+	/** @} */
+}}
@@ -1,13 +1,14 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsGLGpuParamBlockBuffer.h"
+#include "BsGLUniformBufferRing.h"
 #include "BsRenderStats.h"
 #include "BsException.h"
 
 namespace bs { namespace ct
 {
 	GLGpuParamBlockBuffer::GLGpuParamBlockBuffer(UINT32 size, GpuParamBlockUsage usage, GpuDeviceFlags deviceMask)
-		:GpuParamBlockBuffer(size, usage, deviceMask), mGLHandle(0)
+		:GpuParamBlockBuffer(size, usage, deviceMask), mGLHandle(0), mUseRing(false), mRingOffset(0), mRingGeneration(0)
 	{
 		assert((deviceMask == GDF_DEFAULT || deviceMask == GDF_PRIMARY) && "Multiple GPUs not supported natively on OpenGL.");
 	}
@@ -21,6 +22,18 @@ namespace bs { namespace ct
 
 	void GLGpuParamBlockBuffer::initialize()
 	{
+		// Dynamic buffers are usually re-written multiple times per frame, so instead of updating a buffer that might
+		// still be in use by the GPU, each write goes to a new range in the shared ring buffer
+		if(mUsage == GPBU_DYNAMIC && GLUniformBufferRing::isStarted() && 
+			mSize <= GLUniformBufferRing::instance().getSize())
+		{
+			mUseRing = true;
+
+			BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_GpuParamBuffer);
+			GpuParamBlockBuffer::initialize();
+			return;
+		}
+
 		glGenBuffers(1, &mGLHandle);
 		glBindBuffer(GL_UNIFORM_BUFFER, mGLHandle);
 		if(mUsage == GPBU_STATIC)
@@ -38,10 +51,38 @@ namespace bs { namespace ct
 
 	void GLGpuParamBlockBuffer::writeToGPU(const UINT8* data, UINT32 queueIdx)
 	{
+		if(mUseRing)
+		{
+			GLUniformBufferRing& ring = GLUniformBufferRing::instance();
+
+			mRingOffset = ring.write(data, mSize);
+			mRingGeneration = ring.getGeneration();
+
+			BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer);
+			return;
+		}
+
 		glBindBuffer(GL_UNIFORM_BUFFER, mGLHandle);
 		glBufferSubData(GL_UNIFORM_BUFFER, 0 , mSize, data);
 		glBindBuffer(GL_UNIFORM_BUFFER, 0);
 
 		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer);
 	}
+
+	void GLGpuParamBlockBuffer::prepareForBind()
+	{
+		flushToGPU();
+
+		// Ring storage was orphaned since the last write, re-write the contents in the new storage
+		if(mUseRing && mRingGeneration != GLUniformBufferRing::instance().getGeneration())
+			writeToGPU(mCachedData);
+	}
+
+	GLuint GLGpuParamBlockBuffer::getGLHandle() const
+	{
+		if(mUseRing)
+			return GLUniformBufferRing::instance().getGLHandle();
+
+		return mGLHandle;
+	}
 }}
\ No newline at end of file
@@ -19,6 +19,7 @@
 #include "BsRenderStateManager.h"
 #include "BsGpuParams.h"
 #include "BsGLGpuParamBlockBuffer.h"
+#include "BsGLUniformBufferRing.h"
 #include "BsCoreThread.h"
 #include "BsGLQueryManager.h"
 #include "BsDebug.h"
@@ -136,6 +137,7 @@ namespace bs { namespace ct
 
 		initFromCaps(mCurrentCapabilities);
 		GLVertexArrayObjectManager::startUp();
+		GLUniformBufferRing::startUp();
 		glFrontFace(GL_CW);
 
 		// Ensure cubemaps are filtered across seams
@@ -168,6 +170,8 @@ namespace bs { namespace ct
 			mGLSLProgramFactory = nullptr;
 		}
 
+		GLUniformBufferRing::shutDown();
+
 		// Deleting the hardware buffer manager.  Has to be done before the mGLSupport->stop().
 		HardwareBufferManager::shutDown();
 		bs::HardwareBufferManager::shutDown();
@@ -431,6 +435,35 @@ namespace bs { namespace ct
 				};
 
 				const UINT32 numStages = 6;
+
+				// Upload all param blocks before binding any of them. An upload can orphan the uniform buffer ring, which
+				// would invalidate ranges bound earlier in this call, in which case the uploads are repeated.
+				UINT32 ringGeneration = GLUniformBufferRing::instance().getGeneration();
+				for(UINT32 pass = 0; pass < 2; pass++)
+				{
+					for(UINT32 i = 0; i < numStages; i++)
+					{
+						SPtr<GpuParamDesc> paramDesc = gpuParams->getParamDesc((GpuProgramType)i);
+						if (paramDesc == nullptr)
+							continue;
+
+						for (auto& entry : paramDesc->paramBlocks)
+						{
+							SPtr<GpuParamBlockBuffer> buffer = gpuParams->getParamBlockBuffer(entry.second.set, 
+								entry.second.slot);
+
+							if (buffer != nullptr)
+								static_cast<GLGpuParamBlockBuffer*>(buffer.get())->prepareForBind();
+						}
+					}
+
+					UINT32 newRingGeneration = GLUniformBufferRing::instance().getGeneration();
+					if (newRingGeneration == ringGeneration)
+						break;
+
+					ringGeneration = newRingGeneration;
+				}
+
 				for(UINT32 i = 0; i < numStages; i++)
 				{
 					textureUnits.clear();
@@ -629,8 +662,6 @@ namespace bs { namespace ct
 						if (buffer == nullptr)
 							continue;
 
-						buffer->flushToGPU();
-
 						SPtr<GLSLGpuProgram> activeProgram = getActiveProgram(type);
 						GLuint glProgram = activeProgram->getGLHandle();
 
@@ -733,7 +764,8 @@ namespace bs { namespace ct
 
 							UINT32 unit = getUniformUnit(binding - 1);
 							glUniformBlockBinding(glProgram, binding - 1, unit);
-							glBindBufferBase(GL_UNIFORM_BUFFER, unit, glParamBlockBuffer->getGLHandle());
+							glBindBufferRange(GL_UNIFORM_BUFFER, unit, glParamBlockBuffer->getGLHandle(), 
+								glParamBlockBuffer->getGLOffset(), glParamBlockBuffer->getSize());
 						}
 					}
 				}
@@ -991,6 +1023,7 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumDrawCalls);
 		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
+		BS_ADD_RENDER_STAT(NumInstances, std::max(instanceCount, 1U));
 	}
 
 	void GLRenderAPI::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
@@ -1052,6 +1085,7 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumDrawCalls);
 		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
+		BS_ADD_RENDER_STAT(NumInstances, std::max(instanceCount, 1U));
 
 		BS_INC_RENDER_STAT(NumIndexBufferBinds);
 	}
@@ -242,16 +242,23 @@ namespace bs { namespace ct
 			return;
 		}
 
+		// Extents of the provided data determine where it is written to, while the upload expects them to describe the
+		// area of the source buffer to read from
+		PixelData srcData(src.getWidth(), src.getHeight(), src.getDepth(), src.getFormat());
+		srcData.setExternalBuffer(src.getData());
+		srcData.setRowPitch(src.getRowPitch());
+		srcData.setSlicePitch(src.getSlicePitch());
+
 		if (src.getFormat() != mInternalFormat)
 		{
-			PixelData temp(src.getExtents(), mInternalFormat);
+			PixelData temp(src.getWidth(), src.getHeight(), src.getDepth(), mInternalFormat);
 			temp.allocateInternalBuffer();
 
-			PixelUtil::bulkPixelConversion(src, temp);
-			getBuffer(face, mipLevel)->upload(temp, temp.getExtents());
+			PixelUtil::bulkPixelConversion(srcData, temp);
+			getBuffer(face, mipLevel)->upload(temp, src.getExtents());
 		}
 		else
-			getBuffer(face, mipLevel)->upload(src, src.getExtents());
+			getBuffer(face, mipLevel)->upload(srcData, src.getExtents());
 	}
 
 	void GLTexture::copyImpl(UINT32 srcFace, UINT32 srcMipLevel, UINT32 destFace, UINT32 destMipLevel,
@@ -0,0 +1,63 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsGLUniformBufferRing.h"
+#include "BsException.h"
+#include "BsMath.h"
+
+namespace bs { namespace ct
+{
+	GLUniformBufferRing::GLUniformBufferRing(UINT32 size)
+		:mGLHandle(0), mSize(size), mAlignment(1), mOffset(0), mGeneration(0)
+	{
+		GLint alignment = 0;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+
+		if (alignment > 0)
+			mAlignment = (UINT32)alignment;
+
+		glGenBuffers(1, &mGLHandle);
+		glBindBuffer(GL_UNIFORM_BUFFER, mGLHandle);
+		glBufferData(GL_UNIFORM_BUFFER, mSize, nullptr, GL_STREAM_DRAW);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+
+	GLUniformBufferRing::~GLUniformBufferRing()
+	{
+		glDeleteBuffers(1, &mGLHandle);
+	}
+
+	UINT32 GLUniformBufferRing::write(const UINT8* data, UINT32 size)
+	{
+		assert(size <= mSize);
+
+		glBindBuffer(GL_UNIFORM_BUFFER, mGLHandle);
+
+		UINT32 alignedSize = Math::divideAndRoundUp(size, mAlignment) * mAlignment;
+		if ((mOffset + alignedSize) > mSize)
+		{
+			// Orphan the current storage. The driver keeps it alive until the GPU is done with it.
+			glBufferData(GL_UNIFORM_BUFFER, mSize, nullptr, GL_STREAM_DRAW);
+
+			mOffset = 0;
+			mGeneration++;
+		}
+
+		// Ranges are never re-used within the same storage, so there's no need to synchronize with the GPU
+		void* dst = glMapBufferRange(GL_UNIFORM_BUFFER, mOffset, size, 
+			GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+
+		if (dst == nullptr)
+		{
+			BS_EXCEPT(InternalErrorException, "Cannot map OpenGL buffer.");
+		}
+
+		memcpy(dst, data, size);
+		glUnmapBuffer(GL_UNIFORM_BUFFER);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+		UINT32 offset = mOffset;
+		mOffset += alignedSize;
+
+		return offset;
+	}
+}}
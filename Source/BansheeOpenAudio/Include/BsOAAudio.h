@@ -15,6 +15,16 @@ namespace bs
 	/** Global manager for the audio implementation using OpenAL as the backend. */
 	class OAAudio : public Audio
 	{
+		/** Information used for determining which audio sources should be virtualized. */
+		struct SourceRank
+		{
+			OAAudioSource* source;
+			UINT32 stateOrder;
+			INT32 priority;
+			float audibility;
+			bool real;
+		};
+
 	public:
 		OAAudio();
 		virtual ~OAAudio();
@@ -132,6 +142,37 @@ namespace bs
 		/** Stops data streaming for the provided source. */
 		void stopStreaming(OAAudioSource* source);
 
+		/** 
+		 * Determines which audio sources should be backed by an OpenAL source, and which should be virtualized. Virtual
+		 * sources don't use any OpenAL resources and only keep track of their playback time, so they can resume from the
+		 * correct position once they become real again. Sources are ranked by their state, priority and audibility.
+		 */
+		void updateVirtualization();
+
+		/** 
+		 * Returns an estimate of how loud the provided source is heard by the closest listener, in [0, 1] range. Uses
+		 * the same distance model as OpenAL.
+		 */
+		float getAudibility(const OAAudioSource* source) const;
+
+		/** Maximum number of audio sources that can be backed by an OpenAL source at once. */
+		static const UINT32 MAX_REAL_SOURCES;
+
+		/** Playing sources whose audibility is below this value are virtualized, even if under the real source limit. */
+		static const float MIN_AUDIBLE_VOLUME;
+
+		/** 
+		 * Audibility a virtual playing source needs to reach before it is made real again. Higher than 
+		 * MIN_AUDIBLE_VOLUME so sources near the threshold don't keep switching between real and virtual. 
+		 */
+		static const float MIN_REAL_VOLUME;
+
+		/** 
+		 * Factor the audibility of real sources is multiplied with when ranking sources, so sources of similar 
+		 * audibility don't keep swapping places at the real source limit. 
+		 */
+		static const float REAL_SOURCE_RANK_BIAS;
+
 		float mVolume;
 		bool mIsPaused;
 
@@ -143,6 +184,8 @@ namespace bs
 		Vector<OAAudioListener*> mListeners;
 		Vector<ALCcontext*> mContexts;
 		UnorderedSet<OAAudioSource*> mSources;
+		UINT32 mNumRealSources;
+		Vector<SourceRank> mSourceRanks;
 
 		// Streaming thread
 		Vector<StreamingCommand> mStreamingCommandQueue;
@@ -84,6 +84,18 @@ namespace bs
 		/** Pauses or resumes audio playback due to the global pause setting. */
 		void setGlobalPause(bool pause);
 
+		/** 
+		 * Releases all OpenAL resources used by the source, while retaining its state and playback time. Virtual source
+		 * keeps advancing its playback time until it becomes real again.
+		 */
+		void makeVirtual();
+
+		/** Restores OpenAL resources for a previously virtualized source and resumes playback at its virtual time. */
+		void makeReal();
+
+		/** Advances the playback time of a virtual source, as if it was playing. */
+		void advanceVirtualTime(float timeDelta);
+
 		/** 
 		 * Returns true if the sound source is three dimensional (volume and pitch varies based on listener distance
 		 * and velocity). 
@@ -110,6 +122,8 @@ namespace bs
 		AudioSourceState mSavedState;
 		AudioSourceState mState;
 		bool mGloballyPaused;
+		bool mIsVirtual;
+		float mVirtualTime;
 
 		static const UINT32 StreamBufferCount = 3; // Maximum 32
 		UINT32 mStreamBuffers[StreamBufferCount];
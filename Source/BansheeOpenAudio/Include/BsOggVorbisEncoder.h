@@ -27,8 +27,11 @@ namespace bs
 		 * @param[in]	bitDepth		Determines the size of a single sample, in bits.
 		 * @param[in]	numChannels		Determines the number of audio channels. Channel data will be output interleaved
 		 *								in the output buffer.
+		 * @param[in]	serialNumber	Serial number of the written logical Ogg stream. Streams chained one after another
+		 *								must have different serial numbers.
 		 */
-		bool open(std::function<void(UINT8*, UINT32)> writeCallback, UINT32 sampleRate, UINT32 bitDepth, UINT32 numChannels);
+		bool open(std::function<void(UINT8*, UINT32)> writeCallback, UINT32 sampleRate, UINT32 bitDepth, UINT32 numChannels,
+			INT32 serialNumber = 0);
 
 		/** 
 		 * Writes a new set of samples and converts them to Ogg Vorbis. 
@@ -55,16 +58,30 @@ namespace bs
 		 * Helper method that allows you to quickly convert PCM to Ogg Vorbis data. 
 		 * 
 		 * @param[in]	samples		Buffer containing samples in PCM format. All samples should be in signed integer format.
+		 * @param[in]	info			Meta-data describing the provided samples.
+		 * @param[out]	size			Number of bytes written to the output buffer.
+		 * @param[in]	serialNumber	Serial number of the written logical Ogg stream. See open().
+		 * @return						Buffer containing the encoded samples, allocated using the general allocator.
+		 */
+		static UINT8* PCMToOggVorbis(UINT8* samples, const AudioDataInfo& info, UINT32& size, INT32 serialNumber = 0);
+
+		/** 
+		 * Same as PCMToOggVorbis(), except that long inputs are split into segments of SEGMENT_LENGTH seconds that are
+		 * encoded in parallel on worker threads. Encoded segments are stitched together into a single chained Ogg stream,
+		 * which requires the decoder to support chained streams (Vorbisfile does). 
+		 *
+		 * @param[in]	samples		Buffer containing samples in PCM format. All samples should be in signed integer format.
 		 * @param[in]	info		Meta-data describing the provided samples.
 		 * @param[out]	size		Number of bytes written to the output buffer.
 		 * @return					Buffer containing the encoded samples, allocated using the general allocator.
 		 */
-		static UINT8* PCMToOggVorbis(UINT8* samples, const AudioDataInfo& info, UINT32& size);
+		static UINT8* PCMToOggVorbisParallel(UINT8* samples, const AudioDataInfo& info, UINT32& size);
 	private:
 		/** Writes Vorbis blocks into Ogg packets. */
 		void writeBlocks();
 
 		static const UINT32 BUFFER_SIZE = 4096;
+		static const UINT32 SEGMENT_LENGTH = 30; // In seconds
 
 		std::function<void(UINT8*, UINT32)> mWriteCallback;
 		UINT8 mBuffer[BUFFER_SIZE];
@@ -7,12 +7,18 @@
 #include "BsMath.h"
 #include "BsTaskScheduler.h"
 #include "BsAudioUtility.h"
+#include "BsTime.h"
 #include "AL\al.h"
 
 namespace bs
 {
+	const UINT32 OAAudio::MAX_REAL_SOURCES = 64;
+	const float OAAudio::MIN_AUDIBLE_VOLUME = 0.001f;
+	const float OAAudio::MIN_REAL_VOLUME = 0.002f;
+	const float OAAudio::REAL_SOURCE_RANK_BIAS = 1.25f;
+
 	OAAudio::OAAudio()
-		:mVolume(1.0f), mIsPaused(false)
+		:mVolume(1.0f), mIsPaused(false), mNumRealSources(0)
 	{
 		bool enumeratedDevices;
 		if(_isExtensionSupported("ALC_ENUMERATE_ALL_EXT"))
@@ -102,6 +108,8 @@ namespace bs
 
 	void OAAudio::_update()
 	{
+		updateVirtualization();
+
 		auto worker = [this]() { updateStreaming(); };
 
 		// If previous task still hasn't completed, just skip streaming this frame, queuing more tasks won't help
@@ -226,7 +234,10 @@ namespace bs
 	void OAAudio::rebuildContexts()
 	{
 		for (auto& source : mSources)
-			source->clear();
+		{
+			if (!source->mIsVirtual)
+				source->clear();
+		}
 
 		clearContexts();
 
@@ -250,7 +261,10 @@ namespace bs
 			listener->rebuild();
 
 		for (auto& source : mSources)
-			source->rebuild();
+		{
+			if (!source->mIsVirtual)
+				source->rebuild();
+		}
 	}
 
 	void OAAudio::clearContexts()
@@ -302,6 +316,103 @@ namespace bs
 		}
 	}
 
+	void OAAudio::updateVirtualization()
+	{
+		float timeDelta = gTime().getFrameDelta();
+
+		Vector<SourceRank>& ranks = mSourceRanks;
+		ranks.clear();
+
+		for (auto& source : mSources)
+		{
+			if (source->mIsVirtual)
+				source->advanceVirtualTime(timeDelta);
+
+			SourceRank rank;
+			rank.source = source;
+			rank.stateOrder = (UINT32)source->getState(); // Playing, then paused, then stopped
+			rank.priority = source->mPriority;
+			rank.audibility = getAudibility(source);
+
+			ranks.push_back(rank);
+		}
+
+		std::sort(ranks.begin(), ranks.end(), 
+			[](const SourceRank& a, const SourceRank& b)
+		{
+			if (a.stateOrder != b.stateOrder)
+				return a.stateOrder < b.stateOrder;
+
+			if (a.priority != b.priority)
+				return a.priority > b.priority;
+
+			float audibilityA = a.source->mIsVirtual ? a.audibility : a.audibility * REAL_SOURCE_RANK_BIAS;
+			float audibilityB = b.source->mIsVirtual ? b.audibility : b.audibility * REAL_SOURCE_RANK_BIAS;
+
+			return audibilityA > audibilityB;
+		});
+
+		UINT32 numRanks = (UINT32)ranks.size();
+		for (UINT32 i = 0; i < numRanks; i++)
+		{
+			SourceRank& rank = ranks[i];
+			if (i >= MAX_REAL_SOURCES)
+			{
+				rank.real = false;
+				continue;
+			}
+
+			bool isPlaying = rank.stateOrder == (UINT32)AudioSourceState::Playing;
+
+			// Use separate thresholds for becoming real and virtual, so sources near the threshold don't keep switching
+			float minVolume = rank.source->mIsVirtual ? MIN_REAL_VOLUME : MIN_AUDIBLE_VOLUME;
+			rank.real = !isPlaying || rank.audibility >= minVolume;
+		}
+
+		// Release OpenAL sources first, so there are always enough of them available for the sources we're making real
+		for (UINT32 i = 0; i < numRanks; i++)
+		{
+			if (!ranks[i].real)
+				ranks[i].source->makeVirtual();
+		}
+
+		for (UINT32 i = 0; i < numRanks; i++)
+		{
+			if (ranks[i].real)
+				ranks[i].source->makeReal();
+		}
+	}
+
+	float OAAudio::getAudibility(const OAAudioSource* source) const
+	{
+		float volume = source->getVolume();
+		if (!source->is3D())
+			return volume;
+
+		float minDistanceToListener;
+		if (mListeners.size() > 0)
+		{
+			minDistanceToListener = std::numeric_limits<float>::max();
+			for (auto& listener : mListeners)
+			{
+				float distance = source->getPosition().distance(listener->getPosition());
+				minDistanceToListener = std::min(minDistanceToListener, distance);
+			}
+		}
+		else // Default OpenAL listener sits at the origin
+			minDistanceToListener = source->getPosition().length();
+
+		// Inverse distance clamped model (OpenAL default)
+		float refDistance = source->getMinDistance();
+		float distance = std::max(minDistanceToListener, refDistance);
+
+		float denom = refDistance + source->getAttenuation() * (distance - refDistance);
+		if (denom <= 0.0f)
+			return volume;
+
+		return volume * (refDistance / denom);
+	}
+
 	ALenum OAAudio::_getOpenALBufferFormat(UINT32 numChannels, UINT32 bitDepth)
 	{
 		switch (bitDepth)
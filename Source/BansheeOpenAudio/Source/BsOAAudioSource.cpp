@@ -10,15 +10,29 @@ namespace bs
 	OAAudioSource::OAAudioSource()
 		: mSavedTime(0.0f), mState(AudioSourceState::Stopped), mSavedState(AudioSourceState::Stopped)
 		, mGloballyPaused(false), mStreamBuffers(), mBusyBuffers(), mStreamProcessedPosition(0), mStreamQueuedPosition(0)
-		, mIsStreaming(false)
+		, mIsStreaming(false), mIsVirtual(false), mVirtualTime(0.0f)
 	{
 		gOAAudio()._registerSource(this);
-		rebuild();
+
+		// If we're out of OpenAL sources start as virtual, the audio manager will make the source real once it ranks
+		// high enough
+		if (gOAAudio().mNumRealSources < OAAudio::MAX_REAL_SOURCES)
+		{
+			gOAAudio().mNumRealSources++;
+			rebuild();
+		}
+		else
+			mIsVirtual = true;
 	}
 
 	OAAudioSource::~OAAudioSource()
 	{
-		clear();
+		if (!mIsVirtual)
+		{
+			clear();
+			gOAAudio().mNumRealSources--;
+		}
+
 		gOAAudio()._unregisterSource(this);
 	}
 
@@ -36,6 +50,9 @@ namespace bs
 	{
 		AudioSource::setPosition(position);
 
+		if (mIsVirtual)
+			return;
+
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
 		for (UINT32 i = 0; i < numContexts; i++)
@@ -54,6 +71,9 @@ namespace bs
 	{
 		AudioSource::setVelocity(velocity);
 
+		if (mIsVirtual)
+			return;
+
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
 		for (UINT32 i = 0; i < numContexts; i++)
@@ -72,6 +92,9 @@ namespace bs
 	{
 		AudioSource::setVolume(volume);
 
+		if (mIsVirtual)
+			return;
+
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
 		for (UINT32 i = 0; i < numContexts; i++)
@@ -87,6 +110,9 @@ namespace bs
 	{
 		AudioSource::setPitch(pitch);
 
+		if (mIsVirtual)
+			return;
+
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
 		for (UINT32 i = 0; i < numContexts; i++)
@@ -102,6 +128,9 @@ namespace bs
 	{
 		AudioSource::setIsLooping(loop);
 
+		if (mIsVirtual)
+			return;
+
 		// When streaming we handle looping manually
 		if (requiresStreaming())
 			loop = false;
@@ -121,13 +150,17 @@ namespace bs
 	{
 		AudioSource::setPriority(priority);
 
-		// Do nothing, OpenAL doesn't support priorities (perhaps emulate the behaviour by manually disabling sources?)
+		// Nothing to apply, OpenAL doesn't support priorities. Instead OAAudio uses the priority when deciding which
+		// sources to virtualize.
 	}
 
 	void OAAudioSource::setMinDistance(float distance)
 	{
 		AudioSource::setMinDistance(distance);
 
+		if (mIsVirtual)
+			return;
+
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
 		for (UINT32 i = 0; i < numContexts; i++)
@@ -143,6 +176,9 @@ namespace bs
 	{
 		AudioSource::setAttenuation(attenuation);
 
+		if (mIsVirtual)
+			return;
+
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
 		for (UINT32 i = 0; i < numContexts; i++)
@@ -158,7 +194,7 @@ namespace bs
 	{
 		mState = AudioSourceState::Playing;
 
-		if (mGloballyPaused)
+		if (mGloballyPaused || mIsVirtual)
 			return;
 
 		if(requiresStreaming())
@@ -194,6 +230,9 @@ namespace bs
 	{
 		mState = AudioSourceState::Paused;
 
+		if (mIsVirtual)
+			return;
+
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
 		for (UINT32 i = 0; i < numContexts; i++)
@@ -209,6 +248,12 @@ namespace bs
 	{
 		mState = AudioSourceState::Stopped;
 
+		if (mIsVirtual)
+		{
+			mVirtualTime = 0.0f;
+			return;
+		}
+
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
 		for (UINT32 i = 0; i < numContexts; i++)
@@ -238,6 +283,9 @@ namespace bs
 
 		mGloballyPaused = pause;
 
+		if (mIsVirtual)
+			return;
+
 		if (getState() == AudioSourceState::Playing)
 		{
 			if (pause)
@@ -264,6 +312,12 @@ namespace bs
 		if (!mAudioClip.isLoaded())
 			return;
 
+		if (mIsVirtual)
+		{
+			mVirtualTime = time;
+			return;
+		}
+
 		AudioSourceState state = getState();
 		stop();
 
@@ -305,6 +359,9 @@ namespace bs
 
 	float OAAudioSource::getTime() const
 	{
+		if (mIsVirtual)
+			return mVirtualTime;
+
 		Lock(mMutex);
 
 		auto& contexts = gOAAudio()._getContexts();
@@ -378,6 +435,7 @@ namespace bs
 			if (contexts.size() > 1)
 				alcMakeContextCurrent(contexts[i]);
 
+			alSourcef(mSourceIDs[i], AL_GAIN, mVolume);
 			alSourcef(mSourceIDs[i], AL_PITCH, mPitch);
 			alSourcef(mSourceIDs[i], AL_REFERENCE_DISTANCE, mMinDistance);
 			alSourcef(mSourceIDs[i], AL_ROLLOFF_FACTOR, mAttenuation);
@@ -466,6 +524,10 @@ namespace bs
 	{
 		Lock(mMutex);
 
+		// Streaming might have been stopped (e.g. source got virtualized) after the streaming thread picked up the source
+		if (!mIsStreaming)
+			return;
+
 		AudioDataInfo info;
 		info.bitDepth = mAudioClip->getBitDepth();
 		info.numChannels = mAudioClip->getNumChannels();
@@ -593,6 +655,9 @@ namespace bs
 
 	void OAAudioSource::applyClip()
 	{
+		if (mIsVirtual)
+			return;
+
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
 		for (UINT32 i = 0; i < numContexts; i++)
@@ -640,6 +705,55 @@ namespace bs
 			pause();
 	}
 
+	void OAAudioSource::makeVirtual()
+	{
+		if (mIsVirtual)
+			return;
+
+		clear();
+
+		mState = mSavedState;
+		mVirtualTime = mSavedTime;
+		mIsVirtual = true;
+
+		gOAAudio().mNumRealSources--;
+	}
+
+	void OAAudioSource::makeReal()
+	{
+		if (!mIsVirtual)
+			return;
+
+		mIsVirtual = false;
+		gOAAudio().mNumRealSources++;
+
+		mSavedState = mState;
+		mSavedTime = mVirtualTime;
+		mState = AudioSourceState::Stopped;
+
+		rebuild();
+	}
+
+	void OAAudioSource::advanceVirtualTime(float timeDelta)
+	{
+		if (mState != AudioSourceState::Playing || mGloballyPaused || !mAudioClip.isLoaded())
+			return;
+
+		float length = mAudioClip->getLength();
+		mVirtualTime += timeDelta * mPitch;
+
+		if (mVirtualTime >= length)
+		{
+			if (mLoop && length > 0.0f)
+				mVirtualTime = fmod(mVirtualTime, length);
+			else
+			{
+				mState = AudioSourceState::Stopped;
+				mVirtualTime = 0.0f;
+			}
+		}
+	}
+
 	bool OAAudioSource::is3D() const
 	{
 		if (!mAudioClip.isLoaded())
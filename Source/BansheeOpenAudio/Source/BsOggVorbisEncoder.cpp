@@ -1,6 +1,7 @@
 #include "BsOggVorbisEncoder.h"
 #include "BsDataStream.h"
 #include "BsAudioUtility.h"
+#include "BsTaskScheduler.h"
 
 namespace bs
 {
@@ -27,14 +28,14 @@ namespace bs
 	}
 
 	bool OggVorbisEncoder::open(std::function<void(UINT8*, UINT32)> writeCallback, UINT32 sampleRate, UINT32 bitDepth, 
-		UINT32 numChannels)
+		UINT32 numChannels, INT32 serialNumber)
 	{
 		mNumChannels = numChannels;
 		mBitDepth = bitDepth;
 		mWriteCallback = writeCallback;
 		mClosed = false;
 
-		ogg_stream_init(&mOggState, std::rand());
+		ogg_stream_init(&mOggState, serialNumber);
 		vorbis_info_init(&mVorbisInfo);
 
 		// Automatic bitrate management with quality 0.4 (~128 kbps for 44 KHz stereo sound)
@@ -83,70 +84,31 @@ namespace bs
 	{
 		static const UINT32 WRITE_LENGTH = 1024;
 
+		Vector<float> floatSamples(WRITE_LENGTH * mNumChannels);
+
 		UINT32 numFrames = numSamples / mNumChannels;
 		while (numFrames > 0)
 		{
 			UINT32 numFramesToWrite = std::min(numFrames, WRITE_LENGTH);
 			float** buffer = vorbis_analysis_buffer(&mVorbisState, numFramesToWrite);
 
-			if (mBitDepth == 8)
-			{
-				for (UINT32 i = 0; i < numFramesToWrite; i++)
-				{
-					for (UINT32 j = 0; j < mNumChannels; j++)
-					{
-						INT8 sample = *(INT8*)samples;
-						float encodedSample = sample / 127.0f;
-						buffer[j][i] = encodedSample;
-
-						samples++;
-					}
-				}
-			}
-			else if (mBitDepth == 16)
-			{
-				for (UINT32 i = 0; i < numFramesToWrite; i++)
-				{
-					for (UINT32 j = 0; j < mNumChannels; j++)
-					{
-						INT16 sample = *(INT16*)samples;
-						float encodedSample = sample / 32767.0f;
-						buffer[j][i] = encodedSample;
-
-						samples += 2;
-					}
-				}
-			}
-			else if (mBitDepth == 24)
-			{
-				for (UINT32 i = 0; i < numFramesToWrite; i++)
-				{
-					for (UINT32 j = 0; j < mNumChannels; j++)
-					{
-						INT32 sample = AudioUtility::convert24To32Bits(samples);
-						float encodedSample = sample / 2147483647.0f;
-						buffer[j][i] = encodedSample;
-
-						samples += 3;
-					}
-				}
-			}
-			else if (mBitDepth == 32)
+			// Convert to floating point in bulk, then de-interleave into per-channel buffers as required by Vorbis
+			UINT32 numSamplesToWrite = numFramesToWrite * mNumChannels;
+			AudioUtility::convertToFloat(samples, mBitDepth, floatSamples.data(), numSamplesToWrite);
+
+			for (UINT32 j = 0; j < mNumChannels; j++)
 			{
+				const float* src = floatSamples.data() + j;
+				float* dst = buffer[j];
+
 				for (UINT32 i = 0; i < numFramesToWrite; i++)
 				{
-					for (UINT32 j = 0; j < mNumChannels; j++)
-					{
-						INT32 sample = *(INT32*)samples;
-						float encodedSample = sample / 2147483647.0f;
-						buffer[j][i] = encodedSample;
-
-						samples += 4;
-					}
+					dst[i] = *src;
+					src += mNumChannels;
 				}
 			}
-			else
-				assert(false);
+
+			samples += numSamplesToWrite * (mBitDepth / 8);
 
 			// Signal how many frames were written
 			vorbis_analysis_wrote(&mVorbisState, numFramesToWrite);
@@ -207,7 +169,7 @@ namespace bs
 		mClosed = true;
 	}
 
-	UINT8* OggVorbisEncoder::PCMToOggVorbis(UINT8* samples, const AudioDataInfo& info, UINT32& size)
+	UINT8* OggVorbisEncoder::PCMToOggVorbis(UINT8* samples, const AudioDataInfo& info, UINT32& size, INT32 serialNumber)
 	{
 		struct EncodedBlock
 		{
@@ -231,7 +193,7 @@ namespace bs
 		bs_frame_mark();
 
 		OggVorbisEncoder writer;
-		writer.open(writeCallback, info.sampleRate, info.bitDepth, info.numChannels);
+		writer.open(writeCallback, info.sampleRate, info.bitDepth, info.numChannels, serialNumber);
 
 		writer.write(samples, info.numSamples);
 		writer.close();
@@ -252,5 +214,67 @@ namespace bs
 		return outSampleBuffer;
 	}
 
+	UINT8* OggVorbisEncoder::PCMToOggVorbisParallel(UINT8* samples, const AudioDataInfo& info, UINT32& size)
+	{
+		UINT32 samplesPerSegment = SEGMENT_LENGTH * info.sampleRate * info.numChannels;
+		UINT32 numSegments = (info.numSamples + samplesPerSegment - 1) / samplesPerSegment;
+
+		// Not worth splitting up, and avoids creating a chained stream for short clips
+		if (numSegments <= 1)
+			return PCMToOggVorbis(samples, info, size);
+
+		struct EncodedSegment
+		{
+			UINT8* data;
+			UINT32 size;
+		};
+
+		Vector<EncodedSegment> segments(numSegments);
+		Vector<SPtr<Task>> tasks(numSegments);
+
+		UINT32 bytesPerSample = info.bitDepth / 8;
+		for (UINT32 i = 0; i < numSegments; i++)
+		{
+			UINT32 segmentStart = i * samplesPerSegment;
+
+			AudioDataInfo segmentInfo = info;
+			segmentInfo.numSamples = std::min(samplesPerSegment, info.numSamples - segmentStart);
+
+			UINT8* segmentSamples = samples + segmentStart * bytesPerSample;
+			EncodedSegment& segment = segments[i];
+
+			// Links of a chained stream are told apart by their serial numbers, so each segment needs a unique one
+			INT32 serialNumber = (INT32)i;
+			auto worker = [segmentSamples, segmentInfo, serialNumber, &segment]()
+			{
+				segment.data = PCMToOggVorbis(segmentSamples, segmentInfo, segment.size, serialNumber);
+			};
+
+			tasks[i] = Task::create("OggVorbisEncode", worker);
+			TaskScheduler::instance().addTask(tasks[i]);
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+
+		// Each segment is a complete logical stream, so they can simply be concatenated into a chained Ogg stream
+		UINT32 totalEncodedSize = 0;
+		for (auto& segment : segments)
+			totalEncodedSize += segment.size;
+
+		UINT8* outSampleBuffer = (UINT8*)bs_alloc(totalEncodedSize);
+		UINT32 offset = 0;
+		for (auto& segment : segments)
+		{
+			memcpy(outSampleBuffer + offset, segment.data, segment.size);
+			offset += segment.size;
+
+			bs_free(segment.data);
+		}
+
+		size = totalEncodedSize;
+		return outSampleBuffer;
+	}
+
 #undef WRITE_TO_BUFFER
 }
\ No newline at end of file
@@ -84,7 +84,7 @@ typedef struct YYLTYPE {
 %token TOKEN_OPTIONS TOKEN_TECHNIQUE TOKEN_MIXIN
 
 	/* Options keywords */
-%token TOKEN_SEPARABLE TOKEN_SORT TOKEN_PRIORITY TOKEN_TRANSPARENT
+%token TOKEN_SEPARABLE TOKEN_SORT TOKEN_PRIORITY TOKEN_TRANSPARENT TOKEN_INSTANCING
 	
 	/* Technique keywords */
 %token TOKEN_RENDERER TOKEN_PASS TOKEN_TAGS
@@ -194,6 +194,7 @@ options_option
 	| TOKEN_SORT '=' TOKEN_CULLANDQUEUEVALUE ';'	{ $$.type = OT_Sort; $$.value.intValue = $3; }
 	| TOKEN_PRIORITY '=' TOKEN_INTEGER ';'			{ $$.type = OT_Priority; $$.value.intValue = $3; }
 	| TOKEN_TRANSPARENT '=' TOKEN_BOOLEAN ';'		{ $$.type = OT_Transparent; $$.value.intValue = $3; }
+	| TOKEN_INSTANCING '=' TOKEN_BOOLEAN ';'		{ $$.type = OT_Instancing; $$.value.intValue = $3; }
 	;
 
 	/* Technique */
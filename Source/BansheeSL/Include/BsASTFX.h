@@ -32,6 +32,7 @@ enum tagOptionType
 	OT_Priority,
 	OT_Sort,
 	OT_Transparent,
+	OT_Instancing,
 	OT_Technique,
 	OT_Mixin,
 	OT_Raster,
@@ -12,6 +12,7 @@ OptionInfo OPTION_LOOKUP[] =
 	{ OT_Priority, ODT_Int },
 	{ OT_Sort, ODT_Int },
 	{ OT_Transparent, ODT_Bool },
+	{ OT_Instancing, ODT_Bool },
 	{ OT_Technique, ODT_Complex }, 
 	{ OT_Mixin, ODT_String },
 	{ OT_Raster, ODT_Complex },
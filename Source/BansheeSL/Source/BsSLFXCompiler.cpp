@@ -1448,6 +1448,10 @@ namespace bs
 			case OT_Transparent:
 				shaderDesc.flags |= (UINT32)ShaderFlags::Transparent;
 				break;
+			case OT_Instancing:
+				if (option->value.intValue == 0)
+					shaderDesc.flags |= (UINT32)ShaderFlags::DisableInstancing;
+				break;
 			default:
 				break;
 			}
@@ -90,14 +90,17 @@ namespace bs
 	/** A simpler way of accessing the Debug module. */
 	BS_UTILITY_EXPORT Debug& gDebug();
 
-/** Shortcut for logging a message in the debug channel. */
-#define LOGDBG(x) bs::gDebug().logDebug((x) + String("\n\t\t in ") + __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n");
+/** 
+ * Shortcut for logging a message in the debug channel. The message is only formatted if the channel is enabled, see
+ * Log::setChannelEnabled().
+ */
+#define LOGDBG(x) do { if(bs::gDebug().getLog().isChannelEnabled((bs::UINT32)bs::DebugChannel::Debug)) bs::gDebug().logDebug((x) + String("\n\t\t in ") + __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n"); } while(false);
 
 /** Shortcut for logging a message in the warning channel. */
-#define LOGWRN(x) bs::gDebug().logWarning((x) + String("\n\t\t in ") + __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n");
+#define LOGWRN(x) do { if(bs::gDebug().getLog().isChannelEnabled((bs::UINT32)bs::DebugChannel::Warning)) bs::gDebug().logWarning((x) + String("\n\t\t in ") + __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n"); } while(false);
 
 /** Shortcut for logging a message in the error channel. */
-#define LOGERR(x) bs::gDebug().logError((x) + String("\n\t\t in ") + __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n");
+#define LOGERR(x) do { if(bs::gDebug().getLog().isChannelEnabled((bs::UINT32)bs::DebugChannel::Error)) bs::gDebug().logError((x) + String("\n\t\t in ") + __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n"); } while(false);
 
 /** Shortcut for logging a verbose message in the debug channel. Verbose messages can be ignored unlike other log messages. */
 #define LOGDBG_VERBOSE(x)
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "BsPrerequisitesUtil.h"
+#include <atomic>
 
 namespace bs
 {
@@ -31,6 +32,9 @@ namespace bs
 	/**
 	 * Used for logging messages. Can categorize messages according to channels, save the log to a file
 	 * and send out callbacks when a new message is added.
+	 *
+	 * Only a limited number of most recent entries is kept in memory (see setMaxEntries()). Messages can optionally be
+	 * streamed to a set of rotating files on disk by a background thread (see setOutputFile()).
 	 * 			
 	 * @note	Thread safe.
 	 */
@@ -48,6 +52,41 @@ namespace bs
 		 */
 		void logMsg(const String& message, UINT32 channel);
 
+		/** 
+		 * Checks if messages in the specified channel are being recorded. Callers should check this before formatting
+		 * expensive messages. Channels 32 and above cannot be disabled.
+		 */
+		bool isChannelEnabled(UINT32 channel) const
+		{
+			if (channel >= 32)
+				return true;
+
+			return (mChannelMask.load(std::memory_order_relaxed) & (1U << channel)) != 0;
+		}
+
+		/** Enables or disables recording of messages in the specified channel. All channels are enabled by default. */
+		void setChannelEnabled(UINT32 channel, bool enabled);
+
+		/** 
+		 * Sets the maximum number of entries (both read and unread) to keep in memory. When the limit is exceeded the
+		 * oldest entries are discarded. Zero means no limit.
+		 */
+		void setMaxEntries(UINT32 maxEntries);
+
+		/** @copydoc setMaxEntries */
+		UINT32 getMaxEntries() const { return mMaxEntries; }
+
+		/**
+		 * Starts streaming all newly logged messages to the specified file. Writing is done on a separate thread so it
+		 * never blocks the caller. When the file grows larger than @p maxFileSize it is rotated: existing files are
+		 * renamed by appending an increasing index to their name (e.g. log.1.txt), and a new file is started.
+		 *
+		 * @param[in]	path			Absolute path to the log file. Provide an empty path to stop writing to a file.
+		 * @param[in]	maxFileSize		Size in bytes at which to rotate the file.
+		 * @param[in]	maxFiles		Maximum number of files to keep, including the one currently being written to.
+		 */
+		void setOutputFile(const Path& path, UINT64 maxFileSize = 8 * 1024 * 1024, UINT32 maxFiles = 4);
+
 		/** Removes all log entries. */
 		void clear();
 
@@ -85,10 +124,31 @@ namespace bs
 		/** Returns all log entries, including those marked as unread. */
 		Vector<LogEntry> getAllEntries() const;
 
-		Vector<LogEntry> mEntries;
-		Queue<LogEntry> mUnreadEntries;
+		/** Removes the oldest entries until the entry count is within the set limit. Caller must hold the mutex. */
+		void enforceMaxEntries();
+
+		/** Stops the file writer thread, if running, after it writes out all the queued entries. */
+		void stopFileWriter();
+
+		/** Entry point for the thread that writes the log entries to the output file. */
+		void fileWriterWorker();
+
+		Deque<LogEntry> mEntries;
+		Deque<LogEntry> mUnreadEntries;
 		UINT64 mHash;
-		mutable RecursiveMutex mMutex;
+		UINT32 mMaxEntries;
+		std::atomic<UINT32> mChannelMask;
+		mutable Mutex mMutex;
+
+		// File output
+		Path mOutputPath;
+		UINT64 mMaxFileSize = 0;
+		UINT32 mMaxFiles = 0;
+		Vector<LogEntry> mPendingFileEntries;
+		Thread* mFileWriterThread = nullptr;
+		std::atomic<bool> mWriteToFile; // Allows the entry copy to be made before locking
+		Signal mFileWriterSignal;
+		bool mStopFileWriter = false;
 	};
 
 	/** @} */
@@ -106,8 +106,12 @@ namespace bs
 		/**	Removes a worker thread (as soon as its current task is finished). */
 		void removeWorker();
 
-		/** Returns the maximum available worker threads (maximum number of tasks that can be executed simultaneously). */
-		UINT32 getNumWorkers() const { return mMaxActiveTasks; }
+		/** 
+		 * Returns the maximum available worker threads (maximum number of tasks that can be executed simultaneously).
+		 * The value changes as threads waiting on tasks add and remove workers, so it shouldn't be used for deciding how
+		 * to split up work.
+		 */
+		UINT32 getNumWorkers() const;
 	protected:
 		friend class Task;
 
@@ -130,7 +134,7 @@ namespace bs
 		UINT32 mNextTaskId;
 		bool mShutdown;
 
-		Mutex mReadyMutex;
+		mutable Mutex mReadyMutex;
 		Mutex mCompleteMutex;
 		Signal mTaskReadyCond;
 		Signal mTaskCompleteCond;
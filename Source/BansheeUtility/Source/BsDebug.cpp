@@ -30,24 +30,36 @@ namespace bs
 {
 	void Debug::logDebug(const String& msg)
 	{
+		if (!mLog.isChannelEnabled((UINT32)DebugChannel::Debug))
+			return;
+
 		mLog.logMsg(msg, (UINT32)DebugChannel::Debug);
 		logToIDEConsole(msg);
 	}
 
 	void Debug::logWarning(const String& msg)
 	{
+		if (!mLog.isChannelEnabled((UINT32)DebugChannel::Warning))
+			return;
+
 		mLog.logMsg(msg, (UINT32)DebugChannel::Warning);
 		logToIDEConsole(msg);
 	}
 
 	void Debug::logError(const String& msg)
 	{
+		if (!mLog.isChannelEnabled((UINT32)DebugChannel::Error))
+			return;
+
 		mLog.logMsg(msg, (UINT32)DebugChannel::Error);
 		logToIDEConsole(msg);
 	}
 
 	void Debug::log(const String& msg, UINT32 channel)
 	{
+		if (!mLog.isChannelEnabled(channel))
+			return;
+
 		mLog.logMsg(msg, channel);
 		logToIDEConsole(msg);
 	}
@@ -2,82 +2,255 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsLog.h"
 #include "BsException.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
 
 namespace bs
 {
+	/** Default maximum number of entries kept in memory. */
+	static const UINT32 DEFAULT_MAX_ENTRIES = 10000;
+
 	LogEntry::LogEntry(const String& msg, UINT32 channel)
 		:mMsg(msg), mChannel(channel)
 	{ }
 
 	Log::Log()
-		:mHash(0)
+		:mHash(0), mMaxEntries(DEFAULT_MAX_ENTRIES), mChannelMask(0xFFFFFFFF), mWriteToFile(false)
 	{
 	}
 
 	Log::~Log()
 	{
+		stopFileWriter();
 		clear();
 	}
 
 	void Log::logMsg(const String& message, UINT32 channel)
 	{
-		RecursiveLock lock(mMutex);
+		if (!isChannelEnabled(channel))
+			return;
+
+		// Construct the entries (including the copy for the file writer) outside of the lock, so the lock is only held 
+		// while they are moved into the queues
+		LogEntry entry(message, channel);
+
+		LogEntry fileEntry;
+		bool writeToFile = mWriteToFile.load(std::memory_order_relaxed);
+		if (writeToFile)
+			fileEntry = entry;
+
+		Lock lock(mMutex);
+
+		if (writeToFile && mFileWriterThread != nullptr)
+		{
+			mPendingFileEntries.push_back(std::move(fileEntry));
+			mFileWriterSignal.notify_one();
+		}
 
-		mUnreadEntries.push(LogEntry(message, channel));
+		mUnreadEntries.push_back(std::move(entry));
+		enforceMaxEntries();
 	}
 
-	void Log::clear()
+	void Log::setChannelEnabled(UINT32 channel, bool enabled)
 	{
-		RecursiveLock lock(mMutex);
+		if (channel >= 32)
+			return;
 
-		mEntries.clear();
+		if (enabled)
+			mChannelMask.fetch_or(1U << channel);
+		else
+			mChannelMask.fetch_and(~(1U << channel));
+	}
 
-		while (!mUnreadEntries.empty())
-			mUnreadEntries.pop();
+	void Log::setMaxEntries(UINT32 maxEntries)
+	{
+		Lock lock(mMutex);
 
-		mHash++;
+		mMaxEntries = maxEntries;
+		enforceMaxEntries();
 	}
 
-	void Log::clear(UINT32 channel)
+	void Log::enforceMaxEntries()
 	{
-		RecursiveLock lock(mMutex);
+		if (mMaxEntries == 0)
+			return;
+
+		size_t numEntries = mEntries.size() + mUnreadEntries.size();
+		if (numEntries <= mMaxEntries)
+			return;
+
+		size_t numToRemove = numEntries - mMaxEntries;
 
-		Vector<LogEntry> newEntries;
-		for(auto& entry : mEntries)
+		// Discard read entries first, so that nothing is lost before the callbacks get a chance to see it
+		size_t numRead = std::min(numToRemove, mEntries.size());
+		if (numRead > 0)
 		{
-			if (entry.getChannel() == channel)
-				continue;
+			mEntries.erase(mEntries.begin(), mEntries.begin() + numRead);
+			mHash++;
+		}
+
+		size_t numUnread = numToRemove - numRead;
+		if (numUnread > 0)
+			mUnreadEntries.erase(mUnreadEntries.begin(), mUnreadEntries.begin() + numUnread);
+	}
+
+	void Log::setOutputFile(const Path& path, UINT64 maxFileSize, UINT32 maxFiles)
+	{
+		stopFileWriter();
+
+		if (path.isEmpty())
+			return;
+
+		Lock lock(mMutex);
+
+		mOutputPath = path;
+		mMaxFileSize = maxFileSize;
+		mMaxFiles = std::max(maxFiles, 1U);
+		mStopFileWriter = false;
+
+		mFileWriterThread = bs_new<Thread>(std::bind(&Log::fileWriterWorker, this));
+		mWriteToFile = true;
+	}
+
+	void Log::stopFileWriter()
+	{
+		Thread* thread;
+		{
+			Lock lock(mMutex);
+
+			thread = mFileWriterThread;
+			if (thread == nullptr)
+				return;
 
-			newEntries.push_back(entry);
+			mWriteToFile = false;
+			mStopFileWriter = true;
+			mFileWriterSignal.notify_one();
 		}
 
-		mEntries = newEntries;
+		thread->join();
+		bs_delete(thread);
+
+		Lock lock(mMutex);
+		mFileWriterThread = nullptr;
+		mPendingFileEntries.clear();
+	}
+
+	void Log::fileWriterWorker()
+	{
+		Path outputPath;
+		UINT64 maxFileSize;
+		UINT32 maxFiles;
+		{
+			Lock lock(mMutex);
+
+			outputPath = mOutputPath;
+			maxFileSize = mMaxFileSize;
+			maxFiles = mMaxFiles;
+		}
+
+		auto getRotatedPath = [&outputPath](UINT32 idx)
+		{
+			if (idx == 0)
+				return outputPath;
+
+			Path path = outputPath;
+			path.setBasename(outputPath.getFilename(false) + "." + toString(idx));
 
-		Queue<LogEntry> newUnreadEntries;
-		while (!mUnreadEntries.empty())
+			return path;
+		};
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(outputPath);
+		UINT64 fileSize = 0;
+
+		Vector<LogEntry> entries;
+		String text;
+		while (true)
 		{
-			LogEntry entry = mUnreadEntries.front();
-			mUnreadEntries.pop();
+			{
+				Lock lock(mMutex);
+
+				while (!mStopFileWriter && mPendingFileEntries.empty())
+					mFileWriterSignal.wait(lock);
+
+				if (mPendingFileEntries.empty())
+					break;
+
+				std::swap(entries, mPendingFileEntries);
+			}
+
+			// Formatting is done here so it doesn't slow down the threads doing the logging
+			text.clear();
+			for (auto& entry : entries)
+			{
+				text += "[" + toString(entry.getChannel()) + "] ";
+				text += entry.getMessage();
+				text += "\n";
+			}
+
+			entries.clear();
 
-			if (entry.getChannel() == channel)
+			if (stream == nullptr)
 				continue;
 
-			newUnreadEntries.push(entry);
+			stream->write(text.data(), text.size());
+			fileSize += text.size();
+
+			if (fileSize >= maxFileSize)
+			{
+				stream->close();
+
+				// Shift the existing files by one, discarding the oldest
+				for (INT32 i = (INT32)maxFiles - 1; i > 0; i--)
+				{
+					Path srcPath = getRotatedPath((UINT32)i - 1);
+					if (FileSystem::isFile(srcPath))
+						FileSystem::move(srcPath, getRotatedPath((UINT32)i));
+				}
+
+				if (maxFiles == 1)
+					FileSystem::remove(outputPath);
+
+				stream = FileSystem::createAndOpenFile(outputPath);
+				fileSize = 0;
+			}
 		}
 
-		mUnreadEntries = newUnreadEntries;
+		if (stream != nullptr)
+			stream->close();
+	}
+
+	void Log::clear()
+	{
+		Lock lock(mMutex);
+
+		mEntries.clear();
+		mUnreadEntries.clear();
+
+		mHash++;
+	}
+
+	void Log::clear(UINT32 channel)
+	{
+		Lock lock(mMutex);
+
+		auto isInChannel = [channel](const LogEntry& entry) { return entry.getChannel() == channel; };
+
+		mEntries.erase(std::remove_if(mEntries.begin(), mEntries.end(), isInChannel), mEntries.end());
+		mUnreadEntries.erase(std::remove_if(mUnreadEntries.begin(), mUnreadEntries.end(), isInChannel),
+			mUnreadEntries.end());
+
 		mHash++;
 	}
 
 	bool Log::getUnreadEntry(LogEntry& entry)
 	{
-		RecursiveLock lock(mMutex);
+		Lock lock(mMutex);
 
 		if (mUnreadEntries.empty())
 			return false;
 
 		entry = mUnreadEntries.front();
-		mUnreadEntries.pop();
+		mUnreadEntries.pop_front();
 		mEntries.push_back(entry);
 		mHash++;
 
@@ -86,6 +259,8 @@ namespace bs
 
 	bool Log::getLastEntry(LogEntry& entry)
 	{
+		Lock lock(mMutex);
+
 		if (mEntries.size() == 0)
 			return false;
 
@@ -95,27 +270,20 @@ namespace bs
 
 	Vector<LogEntry> Log::getEntries() const
 	{
-		RecursiveLock lock(mMutex);
+		Lock lock(mMutex);
 
-		return mEntries;
+		return Vector<LogEntry>(mEntries.begin(), mEntries.end());
 	}
 
 	Vector<LogEntry> Log::getAllEntries() const
 	{
-		Vector<LogEntry> entries;
-		{
-			RecursiveLock lock(mMutex);
+		Lock lock(mMutex);
 
-			for (auto& entry : mEntries)
-				entries.push_back(entry);
+		Vector<LogEntry> entries;
+		entries.reserve(mEntries.size() + mUnreadEntries.size());
+		entries.insert(entries.end(), mEntries.begin(), mEntries.end());
+		entries.insert(entries.end(), mUnreadEntries.begin(), mUnreadEntries.end());
 
-			Queue<LogEntry> unreadEntries = mUnreadEntries;
-			while (!unreadEntries.empty())
-			{
-				entries.push_back(unreadEntries.front());
-				unreadEntries.pop();
-			}
-		}
 		return entries;
 	}
 }
\ No newline at end of file
@@ -109,6 +109,13 @@ namespace bs
 			mMaxActiveTasks--;
 	}
 
+	UINT32 TaskScheduler::getNumWorkers() const
+	{
+		Lock lock(mReadyMutex);
+
+		return mMaxActiveTasks;
+	}
+
 	void TaskScheduler::runMain()
 	{
 		while(true)
@@ -65,9 +65,9 @@ namespace bs { namespace ct
 
 		/** 
 		 * Queues a command on the provided command buffer. The command copies the contents of the current buffer to
-		 * the destination image subresource. 
+		 * the specified area of the destination image subresource. 
 		 */
-		void copy(VulkanCmdBuffer* cb, VulkanImage* destination, const VkExtent3D& extent,
+		void copy(VulkanCmdBuffer* cb, VulkanImage* destination, const VkOffset3D& offset, const VkExtent3D& extent,
 			const VkImageSubresourceLayers& range, VkImageLayout layout);
 
 		/** 
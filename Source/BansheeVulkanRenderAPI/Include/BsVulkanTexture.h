@@ -255,11 +255,13 @@ namespace bs { namespace ct
 		UINT32 mMappedRowPitch;
 		UINT32 mMappedSlicePitch;
 		GpuLockOptions mMappedLockOptions;
+		PixelVolume mWriteRegion;
 
 		VkImageCreateInfo mImageCI;
 		bool mDirectlyMappable : 1;
 		bool mSupportsGPUWrites : 1;
 		bool mIsMapped : 1;
+		bool mHasWriteRegion : 1;
 	};
 
 	/** @} */
@@ -60,16 +60,14 @@ namespace bs { namespace ct
 		vkCmdCopyBuffer(cb->getHandle(), mBuffer, destination->getHandle(), 1, &region);
 	}
 
-	void VulkanBuffer::copy(VulkanCmdBuffer* cb, VulkanImage* destination, const VkExtent3D& extent, 
-		const VkImageSubresourceLayers& range, VkImageLayout layout)
+	void VulkanBuffer::copy(VulkanCmdBuffer* cb, VulkanImage* destination, const VkOffset3D& offset, 
+		const VkExtent3D& extent, const VkImageSubresourceLayers& range, VkImageLayout layout)
 	{
 		VkBufferImageCopy region;
 		region.bufferRowLength = mRowPitch;
 		region.bufferImageHeight = mSliceHeight;
 		region.bufferOffset = 0;
-		region.imageOffset.x = 0;
-		region.imageOffset.y = 0;
-		region.imageOffset.z = 0;
+		region.imageOffset = offset;
 		region.imageExtent = extent;
 		region.imageSubresource = range;
 
@@ -431,6 +431,7 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumDrawCalls);
 		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
+		BS_ADD_RENDER_STAT(NumInstances, std::max(instanceCount, 1U));
 	}
 
 	void VulkanRenderAPI::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
@@ -446,6 +447,7 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumDrawCalls);
 		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
+		BS_ADD_RENDER_STAT(NumInstances, std::max(instanceCount, 1U));
 	}
 
 	void VulkanRenderAPI::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
@@ -566,7 +566,7 @@ namespace bs { namespace ct
 		: Texture(desc, initialData, deviceMask), mImages(), mDeviceMask(deviceMask), mStagingBuffer(nullptr)
 		, mMappedDeviceIdx(-1), mMappedGlobalQueueIdx(-1), mMappedMip(0), mMappedFace(0), mMappedRowPitch(false)
 		, mMappedSlicePitch(false), mMappedLockOptions(GBL_WRITE_ONLY), mInternalFormats()
-		, mDirectlyMappable(false), mSupportsGPUWrites(false), mIsMapped(false)
+		, mDirectlyMappable(false), mSupportsGPUWrites(false), mIsMapped(false), mHasWriteRegion(false)
 	{
 		
 	}
@@ -1144,6 +1144,13 @@ namespace bs { namespace ct
 		// contents.
 		bool needRead = options != GBL_WRITE_ONLY_DISCARD_RANGE && options != GBL_WRITE_ONLY_DISCARD;
 
+		// When writing to a part of the mip level, the staging buffer only needs to hold that part
+		if (mHasWriteRegion)
+		{
+			lockedArea = PixelData(mWriteRegion.getWidth(), mWriteRegion.getHeight(), mWriteRegion.getDepth(), 
+				mInternalFormats[deviceIdx]);
+		}
+
 		// Allocate a staging buffer
 		mStagingBuffer = createStaging(device, lockedArea, needRead);
 
@@ -1304,7 +1311,7 @@ namespace bs { namespace ct
 						VulkanImage* newImage = createImage(device, mInternalFormats[mMappedDeviceIdx]);
 
 						// Avoid copying original contents if the image only has one sub-resource, which we'll overwrite anyway
-						if (props.getNumMipmaps() > 0 || props.getNumFaces() > 1)
+						if (props.getNumMipmaps() > 0 || props.getNumFaces() > 1 || mHasWriteRegion)
 						{
 							VkImageLayout oldImgLayout = image->getOptimalLayout();
 
@@ -1331,9 +1338,23 @@ namespace bs { namespace ct
 				rangeLayers.layerCount = range.layerCount;
 				rangeLayers.mipLevel = range.baseMipLevel;
 
+				VkOffset3D offset = { 0, 0, 0 };
 				VkExtent3D extent;
-				PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), mMappedMip,
-											  extent.width, extent.height, extent.depth);
+				if (mHasWriteRegion)
+				{
+					offset.x = (INT32)mWriteRegion.left;
+					offset.y = (INT32)mWriteRegion.top;
+					offset.z = (INT32)mWriteRegion.front;
+
+					extent.width = mWriteRegion.getWidth();
+					extent.height = mWriteRegion.getHeight();
+					extent.depth = mWriteRegion.getDepth();
+				}
+				else
+				{
+					PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), mMappedMip,
+												  extent.width, extent.height, extent.depth);
+				}
 
 				VkImageLayout transferLayout;
 				if (mDirectlyMappable)
@@ -1347,7 +1368,7 @@ namespace bs { namespace ct
 									  curLayout, transferLayout, range);
 
 				// Queue copy command
-				mStagingBuffer->copy(transferCB->getCB(), image, extent, rangeLayers, transferLayout);
+				mStagingBuffer->copy(transferCB->getCB(), image, offset, extent, rangeLayers, transferLayout);
 
 				// Transfer back to original  (or optimal if initial layout was undefined/preinitialized)
 				VkImageLayout dstLayout = image->getOptimalLayout();
@@ -1404,6 +1425,22 @@ namespace bs { namespace ct
 			return;
 		}
 
+		UINT32 mipWidth, mipHeight, mipDepth;
+		PixelUtil::getSizeForMipLevel(mProperties.getWidth(), mProperties.getHeight(), mProperties.getDepth(),
+			mipLevel, mipWidth, mipHeight, mipDepth);
+
+		bool isPartial = src.getWidth() != mipWidth || src.getHeight() != mipHeight || src.getDepth() != mipDepth;
+
+		PixelData srcData(src.getWidth(), src.getHeight(), src.getDepth(), src.getFormat());
+		srcData.setExternalBuffer(src.getData());
+		srcData.setRowPitch(src.getRowPitch());
+		srcData.setSlicePitch(src.getSlicePitch());
+
+		// When writing to a part of the mip level only that part gets transferred through the staging buffer, and is
+		// fully overwritten
+		mHasWriteRegion = isPartial;
+		mWriteRegion = src.getExtents();
+
 		// Write to every device
 		for (UINT32 i = 0; i < BS_MAX_DEVICES; i++)
 		{
@@ -1412,10 +1449,18 @@ namespace bs { namespace ct
 
 			PixelData myData = lock(discardWholeBuffer ? GBL_WRITE_ONLY_DISCARD : GBL_WRITE_ONLY_DISCARD_RANGE, 
 				mipLevel, face, i, queueIdx);
-			PixelUtil::bulkPixelConversion(src, myData);
+
+			// Directly mapped images always map the entire mip level
+			bool isEntireMip = myData.getWidth() == mipWidth && myData.getHeight() == mipHeight && 
+				myData.getDepth() == mipDepth;
+
+			PixelData dstData = isEntireMip ? myData.getSubVolume(src.getExtents()) : myData;
+			PixelUtil::bulkPixelConversion(srcData, dstData);
 			unlock();
 		}
 
+		mHasWriteRegion = false;
+
 		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_Texture);
 	}
 }}
\ No newline at end of file
@@ -21,6 +21,8 @@ namespace BansheeEditor
         private GUIEnumField renderModeField;
         private GUIToggleField boldField;
         private GUIToggleField italicField;
+        private GUIToggleField dynamicField;
+        private GUIToggleField sdfField;
         private GUIIntField dpiField;
         private GUIButton reimportButton;
 
@@ -74,6 +76,8 @@ namespace BansheeEditor
             renderModeField.Value = (ulong)newImportOptions.RenderMode;
             boldField.Value = newImportOptions.Bold;
             italicField.Value = newImportOptions.Italic;
+            dynamicField.Value = newImportOptions.Dynamic;
+            sdfField.Value = newImportOptions.SDF;
             dpiField.Value = newImportOptions.DPI;
             importOptions = newImportOptions;
 
@@ -108,6 +112,12 @@ namespace BansheeEditor
             italicField = new GUIToggleField(new LocEdString("Italic"));
             italicField.OnChanged += x => importOptions.Italic = x;
 
+            dynamicField = new GUIToggleField(new LocEdString("Dynamic"));
+            dynamicField.OnChanged += x => importOptions.Dynamic = x;
+
+            sdfField = new GUIToggleField(new LocEdString("Distance field"));
+            sdfField.OnChanged += x => importOptions.SDF = x;
+
             dpiField = new GUIIntField(new LocEdString("DPI"));
             dpiField.OnChanged += x => importOptions.DPI = x;
 
@@ -117,6 +127,8 @@ namespace BansheeEditor
             Layout.AddElement(renderModeField);
             Layout.AddElement(boldField);
             Layout.AddElement(italicField);
+            Layout.AddElement(dynamicField);
+            Layout.AddElement(sdfField);
             Layout.AddElement(dpiField);
             Layout.AddSpace(10);
 
@@ -480,6 +480,26 @@ namespace BansheeEditor
             set { Internal_SetItalic(mCachedPtr, value); }
         }
 
+        /// <summary>
+        /// Determines should the font be imported as a dynamic font. Dynamic fonts rasterize characters on demand as
+        /// they are used, and support any font size. Font sizes and character ranges are ignored for dynamic fonts.
+        /// </summary>
+        public bool Dynamic
+        {
+            get { return Internal_GetDynamic(mCachedPtr); }
+            set { Internal_SetDynamic(mCachedPtr, value); }
+        }
+
+        /// <summary>
+        /// Determines should the characters of a dynamic font be rendered as signed distance fields, allowing a single
+        /// rasterized character to be used for all font sizes.
+        /// </summary>
+        public bool SDF
+        {
+            get { return Internal_GetSDF(mCachedPtr); }
+            set { Internal_SetSDF(mCachedPtr, value); }
+        }
+
         /// <summary>
         /// Determines character ranges to import from the font. Ranges are defined as unicode numbers.
         /// </summary>
@@ -522,6 +542,18 @@ namespace BansheeEditor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_SetItalic(IntPtr thisPtr, bool value);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_GetDynamic(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetDynamic(IntPtr thisPtr, bool value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_GetSDF(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetSDF(IntPtr thisPtr, bool value);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern CharRange[] Internal_GetCharRanges(IntPtr thisPtr);
 
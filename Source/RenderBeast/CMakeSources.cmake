@@ -17,6 +17,7 @@ set(BS_RENDERBEAST_INC_NOFILTER
 	"Include/BsRendererScene.h"
 	"Include/BsStandardDeferredLighting.h"
 	"Include/BsLightProbes.h"
+	"Include/BsPreSkinning.h"
 )
 
 set(BS_RENDERBEAST_SRC_NOFILTER
@@ -37,6 +38,7 @@ set(BS_RENDERBEAST_SRC_NOFILTER
 	"Source/BsRendererScene.cpp"
 	"Source/BsStandardDeferredLighting.cpp"
 	"Source/BsLightProbes.cpp"
+	"Source/BsPreSkinning.cpp"
 )
 
 source_group("Header Files" FILES ${BS_RENDERBEAST_INC_NOFILTER})
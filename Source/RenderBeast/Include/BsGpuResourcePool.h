@@ -14,8 +14,100 @@ namespace bs { namespace ct
 	 */
 
 	class GpuResourcePool;
-	struct POOLED_RENDER_TEXTURE_DESC;
-	struct POOLED_STORAGE_BUFFER_DESC;
+
+	/** Structure used for creating a new pooled render texture. */
+	struct POOLED_RENDER_TEXTURE_DESC
+	{
+	public:
+		POOLED_RENDER_TEXTURE_DESC() {}
+
+		/**
+		 * Creates a descriptor for a two dimensional render texture.
+		 *
+		 * @param[in]	format		Pixel format used by the texture surface.
+		 * @param[in]	width		Width of the render texture, in pixels.
+		 * @param[in]	height		Height of the render texture, in pixels.
+		 * @param[in]	usage		Usage flags that control in which way is the texture going to be used.
+		 * @param[in]	samples		If higher than 1, texture containing multiple samples per pixel is created.
+		 * @param[in]	hwGamma		Should the written pixels be gamma corrected.
+		 * @param[in]	arraySize	Number of textures in a texture array. Specify 1 for no array.
+		 * @param[in]	mipCount	Number of mip levels, excluding the root mip level.
+		 * @return					Descriptor that is accepted by RenderTexturePool.
+		 */
+		static POOLED_RENDER_TEXTURE_DESC create2D(PixelFormat format, UINT32 width, UINT32 height, 
+			INT32 usage = TU_STATIC, UINT32 samples = 0, bool hwGamma = false, UINT32 arraySize = 1, UINT32 mipCount = 0);
+
+		/**
+		 * Creates a descriptor for a three dimensional render texture.
+		 *
+		 * @param[in]	format		Pixel format used by the texture surface.
+		 * @param[in]	width		Width of the render texture, in pixels.
+		 * @param[in]	height		Height of the render texture, in pixels.
+		 * @param[in]	depth		Depth of the render texture, in pixels.
+		 * @param[in]	usage		Usage flags that control in which way is the texture going to be used.
+		 * @return					Descriptor that is accepted by RenderTexturePool.
+		 */
+		static POOLED_RENDER_TEXTURE_DESC create3D(PixelFormat format, UINT32 width, UINT32 height, UINT32 depth,
+			INT32 usage = TU_STATIC);
+
+		/**
+		 * Creates a descriptor for a cube render texture.
+		 *
+		 * @param[in]	format		Pixel format used by the texture surface.
+		 * @param[in]	width		Width of the render texture, in pixels.
+		 * @param[in]	height		Height of the render texture, in pixels.
+		 * @param[in]	usage		Usage flags that control in which way is the texture going to be used.
+		 * @param[in]	arraySize	Number of textures in a texture array. Specify 1 for no array.
+		 * @return					Descriptor that is accepted by RenderTexturePool.
+		 */
+		static POOLED_RENDER_TEXTURE_DESC createCube(PixelFormat format, UINT32 width, UINT32 height,
+			INT32 usage = TU_STATIC, UINT32 arraySize = 1);
+
+	private:
+		friend class GpuResourcePool;
+
+		UINT32 width;
+		UINT32 height;
+		UINT32 depth;
+		UINT32 numSamples;
+		PixelFormat format;
+		TextureUsage flag;
+		TextureType type;
+		bool hwGamma;
+		UINT32 arraySize;
+		UINT32 numMipLevels;
+	};
+
+	/** Structure used for describing a pooled storage buffer. */
+	struct POOLED_STORAGE_BUFFER_DESC
+	{
+	public:
+		POOLED_STORAGE_BUFFER_DESC() {}
+
+		/**
+		 * Creates a descriptor for a storage buffer containing primitive data types.
+		 *
+		 * @param[in]	format		Format of individual buffer entries.
+		 * @param[in]	numElements	Number of elements in the buffer.
+		 */
+		static POOLED_STORAGE_BUFFER_DESC createStandard(GpuBufferFormat format, UINT32 numElements);
+
+		/**
+		 * Creates a descriptor for a storage buffer containing structures.
+		 *
+		 * @param[in]	elementSize		Size of a single structure in the buffer.
+		 * @param[in]	numElements		Number of elements in the buffer.
+		 */
+		static POOLED_STORAGE_BUFFER_DESC createStructured(UINT32 elementSize, UINT32 numElements);
+
+	private:
+		friend class GpuResourcePool;
+
+		GpuBufferType type;
+		GpuBufferFormat format;
+		UINT32 numElements;
+		UINT32 elementSize;
+	};
 
 	/**	Contains data about a single render texture in the GPU resource pool. */
 	struct PooledRenderTexture
@@ -31,6 +123,10 @@ namespace bs { namespace ct
 
 		GpuResourcePool* mPool;
 		bool mIsFree;
+
+		POOLED_RENDER_TEXTURE_DESC mDesc;
+		UINT64 mMemorySize = 0;
+		UINT64 mLastUsedFrame = 0;
 	};
 
 	/**	Contains data about a single storage buffer in the GPU resource pool. */
@@ -46,11 +142,33 @@ namespace bs { namespace ct
 
 		GpuResourcePool* mPool;
 		bool mIsFree;
+
+		POOLED_STORAGE_BUFFER_DESC mDesc;
+		UINT64 mMemorySize = 0;
+		UINT64 mLastUsedFrame = 0;
+	};
+
+	/** Contains statistics about the resources allocated by the GpuResourcePool. */
+	struct GpuResourcePoolStats
+	{
+		UINT32 numTextures = 0; /**< Number of textures allocated by the pool, both used and free. */
+		UINT32 numBuffers = 0; /**< Number of buffers allocated by the pool, both used and free. */
+		UINT64 memory = 0; /**< Estimated amount of GPU memory used by all allocated resources, in bytes. */
+		UINT64 peakMemory = 0; /**< Largest value of #memory since the pool was created, in bytes. */
+		UINT64 numRequests = 0; /**< Total number of resources requested from the pool. */
+		UINT64 numHits = 0; /**< Number of requests that were satisfied by re-using a free resource. */
+
+		/** Returns the percentage of requests, in range [0, 1], that were satisfied by re-using a free resource. */
+		float getHitRate() const { return numRequests > 0 ? numHits / (float)numRequests : 0.0f; }
 	};
 
 	/** 
 	 * Contains a pool of textures and buffers meant to accommodate reuse of such resources for the main purpose of using
 	 * them as write targets on the GPU.
+	 *
+	 * Released resources are kept alive by the pool for a few frames, even if no other references to them remain. This 
+	 * allows transient resources whose lifetimes within a frame don't overlap to share the same GPU memory, as long as
+	 * they are released as soon as they are no longer needed.
 	 */
 	class GpuResourcePool : public Module<GpuResourcePool>
 	{
@@ -93,10 +211,41 @@ namespace bs { namespace ct
 		 */
 		void release(const SPtr<PooledStorageBuffer>& buffer);
 
+		/** 
+		 * Advances the pool to the next frame, and destroys free resources that haven't been re-used for 
+		 * MAX_UNUSED_FRAMES frames. Should be called once per frame.
+		 */
+		void update();
+
+		/** Returns statistics about the resources allocated by the pool. */
+		const GpuResourcePoolStats& getStats() const { return mStats; }
+
 	private:
 		friend struct PooledRenderTexture;
 		friend struct PooledStorageBuffer;
 
+		/** Hash and equality functions used for bucketing free resources by their descriptors. */
+		class DescHashFunction
+		{
+		public:
+			size_t operator()(const POOLED_RENDER_TEXTURE_DESC& desc) const;
+			size_t operator()(const POOLED_STORAGE_BUFFER_DESC& desc) const;
+		};
+
+		/** @copydoc DescHashFunction */
+		class DescEqualFunction
+		{
+		public:
+			bool operator()(const POOLED_RENDER_TEXTURE_DESC& lhs, const POOLED_RENDER_TEXTURE_DESC& rhs) const;
+			bool operator()(const POOLED_STORAGE_BUFFER_DESC& lhs, const POOLED_STORAGE_BUFFER_DESC& rhs) const;
+		};
+
+		/** Calculates the approximate amount of GPU memory required by a texture with the provided descriptor. */
+		static UINT64 calcMemorySize(const POOLED_RENDER_TEXTURE_DESC& desc);
+
+		/** Calculates the approximate amount of GPU memory required by a buffer with the provided descriptor. */
+		static UINT64 calcMemorySize(const POOLED_STORAGE_BUFFER_DESC& desc);
+
 		/**	Registers a newly created render texture in the pool. */
 		void _registerTexture(const SPtr<PooledRenderTexture>& texture);
 
@@ -109,118 +258,19 @@ namespace bs { namespace ct
 		/**	Unregisters a created storage buffer in the pool. */
 		void _unregisterBuffer(PooledStorageBuffer* buffer);
 
-		/**
-		 * Checks does the provided texture match the parameters.
-		 * 
-		 * @param[in]	desc	Descriptor structure that describes what kind of texture to match.
-		 * @return				True if the texture matches the descriptor, false otherwise.
-		 */
-		static bool matches(const SPtr<Texture>& texture, const POOLED_RENDER_TEXTURE_DESC& desc);
+		/** Determines how many frames will a free resource stay allocated before it is destroyed. */
+		static const UINT32 MAX_UNUSED_FRAMES;
 
-		/**
-		 * Checks does the provided buffer match the parameters.
-		 * 
-		 * @param[in]	desc	Descriptor structure that describes what kind of buffer to match.
-		 * @return				True if the buffer matches the descriptor, false otherwise.
-		 */
-		static bool matches(const SPtr<GpuBuffer>& buffer, const POOLED_STORAGE_BUFFER_DESC& desc);
-
-		Map<PooledRenderTexture*, std::weak_ptr<PooledRenderTexture>> mTextures;
-		Map<PooledStorageBuffer*, std::weak_ptr<PooledStorageBuffer>> mBuffers;
-	};
+		UnorderedMap<PooledRenderTexture*, std::weak_ptr<PooledRenderTexture>> mTextures;
+		UnorderedMap<PooledStorageBuffer*, std::weak_ptr<PooledStorageBuffer>> mBuffers;
 
-	/** Structure used for creating a new pooled render texture. */
-	struct POOLED_RENDER_TEXTURE_DESC
-	{
-	public:
-		POOLED_RENDER_TEXTURE_DESC() {}
+		UnorderedMap<POOLED_RENDER_TEXTURE_DESC, Vector<SPtr<PooledRenderTexture>>, DescHashFunction, 
+			DescEqualFunction> mFreeTextures;
+		UnorderedMap<POOLED_STORAGE_BUFFER_DESC, Vector<SPtr<PooledStorageBuffer>>, DescHashFunction, 
+			DescEqualFunction> mFreeBuffers;
 
-		/**
-		 * Creates a descriptor for a two dimensional render texture.
-		 *
-		 * @param[in]	format		Pixel format used by the texture surface.
-		 * @param[in]	width		Width of the render texture, in pixels.
-		 * @param[in]	height		Height of the render texture, in pixels.
-		 * @param[in]	usage		Usage flags that control in which way is the texture going to be used.
-		 * @param[in]	samples		If higher than 1, texture containing multiple samples per pixel is created.
-		 * @param[in]	hwGamma		Should the written pixels be gamma corrected.
-		 * @param[in]	arraySize	Number of textures in a texture array. Specify 1 for no array.
-		 * @param[in]	mipCount	Number of mip levels, excluding the root mip level.
-		 * @return					Descriptor that is accepted by RenderTexturePool.
-		 */
-		static POOLED_RENDER_TEXTURE_DESC create2D(PixelFormat format, UINT32 width, UINT32 height, 
-			INT32 usage = TU_STATIC, UINT32 samples = 0, bool hwGamma = false, UINT32 arraySize = 1, UINT32 mipCount = 0);
-
-		/**
-		 * Creates a descriptor for a three dimensional render texture.
-		 *
-		 * @param[in]	format		Pixel format used by the texture surface.
-		 * @param[in]	width		Width of the render texture, in pixels.
-		 * @param[in]	height		Height of the render texture, in pixels.
-		 * @param[in]	depth		Depth of the render texture, in pixels.
-		 * @param[in]	usage		Usage flags that control in which way is the texture going to be used.
-		 * @return					Descriptor that is accepted by RenderTexturePool.
-		 */
-		static POOLED_RENDER_TEXTURE_DESC create3D(PixelFormat format, UINT32 width, UINT32 height, UINT32 depth,
-			INT32 usage = TU_STATIC);
-
-		/**
-		 * Creates a descriptor for a cube render texture.
-		 *
-		 * @param[in]	format		Pixel format used by the texture surface.
-		 * @param[in]	width		Width of the render texture, in pixels.
-		 * @param[in]	height		Height of the render texture, in pixels.
-		 * @param[in]	usage		Usage flags that control in which way is the texture going to be used.
-		 * @param[in]	arraySize	Number of textures in a texture array. Specify 1 for no array.
-		 * @return					Descriptor that is accepted by RenderTexturePool.
-		 */
-		static POOLED_RENDER_TEXTURE_DESC createCube(PixelFormat format, UINT32 width, UINT32 height,
-			INT32 usage = TU_STATIC, UINT32 arraySize = 1);
-
-	private:
-		friend class GpuResourcePool;
-
-		UINT32 width;
-		UINT32 height;
-		UINT32 depth;
-		UINT32 numSamples;
-		PixelFormat format;
-		TextureUsage flag;
-		TextureType type;
-		bool hwGamma;
-		UINT32 arraySize;
-		UINT32 numMipLevels;
-	};
-
-	/** Structure used for describing a pooled storage buffer. */
-	struct POOLED_STORAGE_BUFFER_DESC
-	{
-	public:
-		POOLED_STORAGE_BUFFER_DESC() {}
-
-		/**
-		 * Creates a descriptor for a storage buffer containing primitive data types.
-		 *
-		 * @param[in]	format		Format of individual buffer entries.
-		 * @param[in]	numElements	Number of elements in the buffer.
-		 */
-		static POOLED_STORAGE_BUFFER_DESC createStandard(GpuBufferFormat format, UINT32 numElements);
-
-		/**
-		 * Creates a descriptor for a storage buffer containing structures.
-		 *
-		 * @param[in]	elementSize		Size of a single structure in the buffer.
-		 * @param[in]	numElements		Number of elements in the buffer.
-		 */
-		static POOLED_STORAGE_BUFFER_DESC createStructured(UINT32 elementSize, UINT32 numElements);
-
-	private:
-		friend class GpuResourcePool;
-
-		GpuBufferType type;
-		GpuBufferFormat format;
-		UINT32 numElements;
-		UINT32 elementSize;
+		UINT64 mFrameIdx = 0;
+		GpuResourcePoolStats mStats;
 	};
 
 	/** @} */
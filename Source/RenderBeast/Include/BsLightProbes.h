@@ -6,12 +6,14 @@
 #include "BsTriangulation.h"
 #include "BsMatrix4.h"
 #include "BsMatrixNxM.h"
+#include "BsAABox.h"
 
 namespace bs { namespace ct
 {
 	struct FrameInfo;
 	class LightProbeVolume;
 	struct VisibleLightProbeData;
+	struct SceneInfo;
 
 	/** @addtogroup RenderBeast
 	 *  @{
@@ -73,6 +75,25 @@ namespace bs { namespace ct
 		/** Generates GPU buffers that contain a list of probe tetrahedrons visible from the provided view. */
 		void updateVisibleProbes(const RendererView& view, VisibleLightProbeData& output);
 
+		/**
+		 * Finds the tetrahedron containing the provided world position. The search walks through neighboring tetrahedra
+		 * starting from @p hint, so providing the tetrahedron found for the same object during the previous frame makes 
+		 * the search nearly constant time for slowly moving objects. Without a hint the search starts from a coarse grid
+		 * built over the tetrahedralized volume.
+		 *
+		 * @param[in]	position	World position to look up.
+		 * @param[in]	hint		Index of the tetrahedron to start the search from, or -1 if unknown.
+		 * @return					Index of the tetrahedron containing the point, or -1 if the point is outside of the
+		 *							tetrahedralized volume.
+		 */
+		INT32 findTetrahedron(const Vector3& position, INT32 hint = -1) const;
+
+		/** 
+		 * Updates RendererObject::lightProbeTetrahedron for all renderables in the scene, using the tetrahedron found
+		 * during the previous call as the starting point of the search. Must be called after updateProbes().
+		 */
+		void updateRenderableTetrahedra(const SceneInfo& sceneInfo);
+
 	private:
 		/**
 		 * Perform tetrahedrization of the provided point list, and outputs a list of tetrahedrons and outer faces of the
@@ -83,6 +104,12 @@ namespace bs { namespace ct
 		void generateTetrahedronData(const Vector<Vector3>& positions, Vector<TetrahedronData>& output, 
 			bool includeOuterFaces = false);
 
+		/** 
+		 * Builds a uniform grid over the current tetrahedralization, with each cell referencing one of the tetrahedra 
+		 * overlapping it. Used as a starting point for findTetrahedron() when no hint is available.
+		 */
+		void buildTetrahedronGrid();
+
 		/** Resizes the GPU buffers used for holding tetrahedron data, to the specified size (in number of tetraheda). */
 		void resizeTetrahedronBuffers(VisibleLightProbeData& data, UINT32 count);
 
@@ -100,6 +127,11 @@ namespace bs { namespace ct
 
 		Vector<AABox> mTetrahedronBounds;
 		Vector<TetrahedronData> mTetrahedronInfos;
+		Vector<Vector3> mTetrahedronPositions;
+
+		AABox mTetrahedronGridBounds;
+		UINT32 mTetrahedronGridSize[3];
+		Vector<INT32> mTetrahedronGrid;
 
 		SPtr<GpuBuffer> mProbeCoefficientsGPU;
 
@@ -9,6 +9,7 @@
 #include "BsRendererMaterial.h"
 #include "BsParamBlocks.h"
 #include "BsRendererObject.h"
+#include "BsRenderQueue.h"
 
 namespace bs 
 { 
@@ -26,6 +27,61 @@ namespace bs
 
 	extern PerFrameParamDef gPerFrameParamDef;
 
+	/** A single draw call that renders one or multiple instances of a renderable element. */
+	struct RenderBatch
+	{
+		/** Element whose mesh, material and parameters are used for rendering all the instances in the batch. */
+		BeastRenderableElement* element;
+
+		/** Index of the material pass to render the batch with. */
+		UINT32 passIdx;
+
+		/** True if the material pass needs to be bound before rendering, false if it is already bound. */
+		bool applyPass;
+
+		/** Number of instances to render. */
+		UINT32 numInstances;
+
+		/** 
+		 * Buffer containing per-instance data for all the instances in the batch. Null if the batch contains a single
+		 * instance, in which case the renderable's own per-instance buffer is used.
+		 */
+		SPtr<GpuBuffer> instanceBuffer;
+	};
+
+	/** Identifies renderable elements that can be rendered together using a single instanced draw call. */
+	struct InstanceBatchKey
+	{
+		InstanceBatchKey(const BeastRenderableElement& element, UINT32 passIdx)
+			: mesh(element.mesh.get()), indexOffset(element.subMesh.indexOffset), indexCount(element.subMesh.indexCount)
+			, material(element.material.get()), techniqueIdx(element.techniqueIdx), passIdx(passIdx)
+		{ }
+
+		bool operator== (const InstanceBatchKey& rhs) const
+		{
+			return mesh == rhs.mesh && indexOffset == rhs.indexOffset && indexCount == rhs.indexCount && 
+				material == rhs.material && techniqueIdx == rhs.techniqueIdx && passIdx == rhs.passIdx;
+		}
+
+		bool operator!= (const InstanceBatchKey& rhs) const
+		{
+			return !(*this == rhs);
+		}
+
+		class HashFunction
+		{
+		public:
+			size_t operator()(const InstanceBatchKey& key) const;
+		};
+
+		Mesh* mesh;
+		UINT32 indexOffset;
+		UINT32 indexCount;
+		Material* material;
+		UINT32 techniqueIdx;
+		UINT32 passIdx;
+	};
+
 	/** Manages initialization and rendering of individual renderable object, represented as RenderableElement%s. */
 	class ObjectRenderer
 	{
@@ -38,8 +94,38 @@ namespace bs
 		/** Updates global per frame parameter buffers with new values. To be called at the start of every frame. */
 		void setParamFrameParams(float time);
 
+		/**
+		 * Groups sorted render queue elements sharing the same mesh, sub-mesh, material and pass into batches that can be
+		 * rendered using a single instanced draw call, and uploads the per-instance data for each batch. Elements that
+		 * don't support instancing are output as batches with a single instance.
+		 *
+		 * @param[in]	elements		Sorted render queue elements to group.
+		 * @param[in]	renderables		All renderable objects in the scene, indexed by renderable ID.
+		 * @param[in]	preserveOrder	If true only consecutive elements will be grouped together, preserving the exact
+		 *								order in which they were sorted (required for transparent objects). If false all
+		 *								matching elements will be grouped together, and each batch will be rendered at the
+		 *								position of its first element.
+		 * @param[out]	output			Batches to render, in the order they should be rendered in.
+		 */
+		void batchElements(const Vector<RenderQueueElement>& elements, const Vector<RendererObject*>& renderables, 
+			bool preserveOrder, Vector<RenderBatch>& output);
+
+		/** Maximum number of instances that may be rendered with a single instanced draw call. */
+		static const UINT32 MAX_INSTANCES_PER_BATCH;
+
 	protected:
+		/** Returns a buffer for holding per-instance data, large enough to hold the provided number of instances. */
+		SPtr<GpuBuffer> getInstanceBuffer(UINT32 numInstances);
+
 		SPtr<GpuParamBlockBuffer> mPerFrameParamBuffer;
+
+		Vector<SPtr<GpuBuffer>> mInstanceBuffers;
+		UINT32 mNextInstanceBuffer = 0;
+
+		Vector<UINT32> mElementBatches;
+		Vector<UINT32> mBatchOffsets;
+		Vector<PerInstanceData> mInstanceData;
+		UnorderedMap<InstanceBatchKey, UINT32, InstanceBatchKey::HashFunction> mOpenBatches;
 	};
 
 	/** Basic shader that is used when no other is available. */
@@ -0,0 +1,119 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "BsModule.h"
+#include "BsMatrix4.h"
+
+namespace bs 
+{ 
+	struct RendererAnimationData;
+
+	namespace ct
+	{
+		struct RendererObject;
+
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	/**
+	 * Applies skeletal and morph shape animation to renderable vertices once per frame, before any rendering takes place.
+	 * The animated vertices are stored in a per-object vertex buffer which is then used by all passes rendering the
+	 * object (shadows, base pass, reflection probes), instead of each of them animating the vertices in the vertex
+	 * program.
+	 *
+	 * Vertices are only re-evaluated when the object's pose or morph shape weights change, and evaluation of multiple
+	 * objects is spread over worker threads. Only meshes created with MU_CPUCACHED usage are supported, as the source
+	 * vertices would otherwise need to be read back from the GPU.
+	 */
+	class PreSkinning : public Module<PreSkinning>
+	{
+		/** CPU copy of a mesh's vertices, along with information about the layout of the animated vertex elements. */
+		struct SourceMesh
+		{
+			SPtr<Mesh> mesh;
+			SPtr<MeshData> meshData;
+			const UINT8* vertices = nullptr;
+
+			UINT32 numVertices = 0;
+			UINT32 stride = 0;
+
+			UINT32 positionOffset = 0;
+			UINT32 normalOffset = (UINT32)-1;
+			UINT32 tangentOffset = (UINT32)-1;
+			UINT32 blendIndicesOffset = (UINT32)-1;
+			UINT32 blendWeightsOffset = (UINT32)-1;
+		};
+
+		/** Information about a single animated renderable. */
+		struct AnimatedObject
+		{
+			SPtr<SourceMesh> source;
+			SPtr<VertexBuffer> vertexBuffer;
+
+			/** Locked contents of the vertex buffer, the animated vertices are written to during update(). */
+			UINT8* mappedVertices = nullptr;
+
+			/** Bone transforms the vertices were last evaluated with. */
+			Vector<Matrix4> pose;
+
+			/** Morph shape vertices the vertices were last evaluated with, along with their version. */
+			SPtr<MeshData> morphShapes;
+			UINT32 morphShapeVersion = 0;
+
+			bool skinned = false;
+			bool morph = false;
+			bool dirty = false;
+		};
+
+	public:
+		PreSkinning();
+		~PreSkinning();
+
+		/**
+		 * Registers a new animated object and returns a vertex buffer that will contain its animated vertices. The
+		 * buffer has the same layout as the first stream of the object's mesh and should be used in place of it when
+		 * rendering.
+		 *
+		 * @param[in]	object		Object to register. Must reference a renderable with skeletal and/or morph shape
+		 *							animation.
+		 * @return					Buffer that will contain the animated vertices, or null if the object's mesh vertices
+		 *							are in a format that's not supported. In such case the object should instead be
+		 *							animated in the vertex program.
+		 */
+		SPtr<VertexBuffer> registerObject(const RendererObject* object);
+
+		/** Unregisters an object previously registered with registerObject(). */
+		void unregisterObject(const RendererObject* object);
+
+		/**
+		 * Evaluates the vertices of all registered objects whose animation changed since the last call and uploads them
+		 * to their vertex buffers. Should be called once per frame, before anything is rendered.
+		 *
+		 * @param[in]	animData	Animation data (skeleton poses and morph shapes) calculated for the current frame.
+		 */
+		void update(const RendererAnimationData& animData);
+
+	private:
+		/** 
+		 * Retrieves the CPU cached vertices of the provided mesh and validates they are in the format supported by 
+		 * pre-skinning. 
+		 */
+		static SPtr<SourceMesh> createSourceMesh(const SPtr<Mesh>& mesh);
+
+		/** 
+		 * Evaluates the animated vertices of the provided object, using its current pose and morph shapes, and writes 
+		 * them to its locked vertex buffer. 
+		 */
+		static void evaluate(AnimatedObject& object);
+
+		UnorderedMap<const RendererObject*, AnimatedObject> mObjects;
+		UnorderedMap<const Mesh*, SPtr<SourceMesh>> mSourceMeshes;
+
+		Vector<AnimatedObject*> mDirtyObjects;
+	};
+
+	/** @} */
+}}
@@ -12,6 +12,7 @@
 #include "BsRendererView.h"
 #include "BsRendererObject.h"
 #include "BsRendererScene.h"
+#include "BsTextureStreamingManager.h"
 
 namespace bs 
 { 
@@ -163,6 +164,14 @@ namespace bs
 		 */
 		void renderViews(const RendererViewGroup& viewGroup, const FrameInfo& frameInfo);
 
+		/**
+		 * Reports the on-screen size of streamed textures used by the objects visible in the provided view group to the
+		 * texture streaming manager. Must be called after visibility for the group has been determined.
+		 *
+		 * @note	Core thread only.
+		 */
+		void notifyStreamedTextureUsage(const RendererViewGroup& viewGroup);
+
 		/**
 		 * Renders all objects visible by the provided view.
 		 *			
@@ -177,16 +186,31 @@ namespace bs
 		 */
 		void renderOverlay(RendererView* viewInfo);
 
+		/** 
+		 * Renders all elements in the provided render queue. Elements sharing the same mesh, sub-mesh, material and pass
+		 * are rendered together using instanced draw calls, where supported.
+		 *
+		 * @param[in]	elements		Sorted render queue elements to render.
+		 * @param[in]	preserveOrder	If true the elements will be rendered in the exact order they were sorted in. If 
+		 *								false elements may be re-ordered in order to better group them into instanced draw
+		 *								calls.
+		 * @param[in]	viewProj		View projection matrix of the camera the elements are being rendered with.
+		 */
+		void renderElements(const Vector<RenderQueueElement>& elements, bool preserveOrder, const Matrix4& viewProj);
+
 		/** 
 		 * Renders a single element of a renderable object. 
 		 *
-		 * @param[in]	element		Element to render.
-		 * @param[in]	passIdx		Index of the material pass to render the element with.
-		 * @param[in]	bindPass	If true the material pass will be bound for rendering, if false it is assumed it is
-		 *							already bound.
-		 * @param[in]	viewProj	View projection matrix of the camera the element is being rendered with.
+		 * @param[in]	element			Element to render.
+		 * @param[in]	passIdx			Index of the material pass to render the element with.
+		 * @param[in]	bindPass		If true the material pass will be bound for rendering, if false it is assumed it is
+		 *								already bound.
+		 * @param[in]	viewProj		View projection matrix of the camera the element is being rendered with.
+		 * @param[in]	numInstances	Number of instances of the element to render. Per-instance data must be bound
+		 *								by the caller if rendering more than one instance.
 		 */
-		void renderElement(const BeastRenderableElement& element, UINT32 passIdx, bool bindPass, const Matrix4& viewProj);
+		void renderElement(const BeastRenderableElement& element, UINT32 passIdx, bool bindPass, const Matrix4& viewProj,
+			UINT32 numInstances = 1);
 
 		/**	Creates data used by the renderer on the core thread. */
 		void initializeCore();
@@ -215,6 +239,7 @@ namespace bs
 		// Materials & GPU data
 		//// Base pass
 		ObjectRenderer* mObjectRenderer = nullptr;
+		Vector<RenderBatch> mRenderBatches;
 
 		//// Lighting
 		TiledDeferredLightingMaterials* mTiledDeferredLightingMats = nullptr;
@@ -237,6 +262,9 @@ namespace bs
 
 		// Helpers to avoid memory allocations
 		RendererViewGroup mMainViewGroup;
+		Vector<float> mStreamedTextureSizes;
+		Vector<UINT32> mUsedStreamedTextures;
+		Vector<StreamedTextureUsage> mStreamedTextureUsage;
 
 		// Sim thread only fields
 		SPtr<RenderBeastOptions> mOptions;
@@ -51,6 +51,16 @@ namespace bs { namespace ct
 		 * quality shadows. Valid range is [1, 4].
 		 */
 		UINT32 shadowFilteringQuality = 4;
+
+		/**
+		 * If enabled, skeletal and morph shape animation is applied to renderable vertices once per frame on the CPU,
+		 * instead of in the vertex program of every pass the renderable is drawn with. This avoids re-evaluating the
+		 * animation for shadow and reflection passes and allows animated renderables to be rendered with shaders that
+		 * don't support animation. Only meshes created with MU_CPUCACHED usage (e.g. imported with the CPU cached option)
+		 * are supported, renderables using other meshes, or meshes in an unsupported format, are always animated in the
+		 * vertex program.
+		 */
+		bool preSkinning = false;
 	};
 
 	/** @} */
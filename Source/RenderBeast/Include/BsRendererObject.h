@@ -31,6 +31,20 @@ namespace bs { namespace ct
 
 	extern PerCallParamDef gPerCallParamDef;
 
+	/** 
+	 * Per-object data of a single instance rendered through an instanced draw call. Must match the layout of the 
+	 * PerInstanceData structure in the PerObjectData.bslinc shader include.
+	 */
+	struct PerInstanceData
+	{
+		Matrix4 worldTransform;
+		Matrix4 invWorldTransform;
+		Matrix4 worldNoScaleTransform;
+		Matrix4 invWorldNoScaleTransform;
+		float worldDeterminantSign;
+		float padding[3];
+	};
+
 	struct MaterialSamplerOverrides;
 
 	/**
@@ -59,6 +73,9 @@ namespace bs { namespace ct
 		/** Type of animation applied to this element, if any. */
 		RenderableAnimType animType;
 
+		/** Level of detail of the mesh the element's sub-mesh belongs to. */
+		UINT32 lod;
+
 		/** Index of the technique in the material to render the element with. */
 		UINT32 techniqueIdx;
 
@@ -100,6 +117,33 @@ namespace bs { namespace ct
 
 		/** Version of the morph shape vertices in the buffer. */
 		mutable UINT32 morphShapeVersion;
+
+		/** 
+		 * Vertex buffer containing the element's vertices with animation already applied, if the animation is evaluated
+		 * by PreSkinning. If set, the buffer should be rendered instead of the mesh's own vertices.
+		 */
+		SPtr<VertexBuffer> skinnedVertexBuffer;
+
+		/** 
+		 * Parameter to which to bind a buffer containing per-instance object data. Only valid if the element's shader
+		 * supports instanced rendering.
+		 */
+		GpuParamBuffer perInstanceDataParam;
+
+		/** 
+		 * True if the element can be rendered together with other elements sharing the same mesh, sub-mesh and material,
+		 * using a single instanced draw call.
+		 */
+		bool allowInstancing;
+
+		/** 
+		 * Draws the element's mesh, using the appropriate vertex buffers depending on the type of animation applied to
+		 * the element. Expects the element's pass and its parameters to be already bound.
+		 *
+		 * @param[in]	numInstances	Number of times to draw the mesh using instanced rendering. Ignored for elements
+		 *								using morph shapes.
+		 */
+		void draw(UINT32 numInstances = 1) const;
 	};
 
 	 /** Contains information about a Renderable, used by the Renderer. */
@@ -107,7 +151,10 @@ namespace bs { namespace ct
 	{
 		RendererObject();
 
-		/** Updates the per-object GPU buffer according to the currently set properties. */
+		/** 
+		 * Updates the per-object GPU buffer according to the currently set properties. Also updates the per-instance
+		 * data and its GPU buffer, if one exists. 
+		 */
 		void updatePerObjectBuffer();
 
 		/** 
@@ -123,6 +170,36 @@ namespace bs { namespace ct
 
 		SPtr<GpuParamBlockBuffer> perObjectParamBuffer;
 		SPtr<GpuParamBlockBuffer> perCallParamBuffer;
+
+		/** Per-object data in the format used by instanced rendering. */
+		PerInstanceData instanceData;
+
+		/** 
+		 * Buffer containing only this object's per-instance data. Used when an element supporting instancing is rendered
+		 * on its own. Only created if any of the object's elements support instancing.
+		 */
+		SPtr<GpuBuffer> perInstanceBuffer;
+
+		/** True if the object's animation is evaluated by PreSkinning, instead of in the vertex program. */
+		bool preSkinned = false;
+
+		/** 
+		 * Screen sizes below which the object's mesh switches to a lower level of detail, one entry for each level after
+		 * the first. See MeshProperties::getLODScreenSize.
+		 */
+		Vector<float> lodScreenSizes;
+
+		/** 
+		 * Level of detail to render shadows with. Determined during visibility calculations as the most detailed level
+		 * any of the views are rendering the object with.
+		 */
+		UINT32 shadowLOD = 0;
+
+		/** 
+		 * Index of the light probe tetrahedron containing the object's origin, or -1 if the object is outside of all
+		 * light probe volumes. Also used as the starting point when searching for the tetrahedron in the next frame.
+		 */
+		INT32 lightProbeTetrahedron = -1;
 	};
 
 	/** @} */
@@ -275,6 +275,18 @@ namespace bs { namespace ct
 		/** Returns the visibility mask calculated with the last call to determineVisible(). */
 		const VisibilityInfo& getVisibilityMasks() const { return mVisibility; }
 
+		/** 
+		 * Returns the level of detail selected for each renderable object with the last call to determineVisible(). 
+		 * Indexed by renderable ID.
+		 */
+		const Vector<UINT32>& getRenderableLODs() const { return mRenderableLODs; }
+
+		/**
+		 * Returns the ratio of each renderable object's bounding sphere diameter to the view height, as calculated with the
+		 * last call to determineVisible(). Indexed by renderable ID.
+		 */
+		const Vector<float>& getRenderableScreenSizes() const { return mRenderableScreenSizes; }
+
 		/** 
 		 * Returns a structure containing information about post-processing effects. This structure will be modified and
 		 * maintained by the post-processing system.
@@ -329,6 +341,8 @@ namespace bs { namespace ct
 
 		SPtr<GpuParamBlockBuffer> mParamBuffer;
 		VisibilityInfo mVisibility;
+		Vector<UINT32> mRenderableLODs;
+		Vector<float> mRenderableScreenSizes;
 	};
 
 	/** Contains one or multiple RendererView%s that are in some way related. */
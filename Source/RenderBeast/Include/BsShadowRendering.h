@@ -17,6 +17,7 @@ namespace bs { namespace ct
 	struct FrameInfo;
 	class RendererLight;
 	class RendererScene;
+	struct RendererObject;
 	struct ShadowInfo;
 
 	/** @addtogroup RenderBeast
@@ -93,6 +94,27 @@ namespace bs { namespace ct
 			const SPtr<GpuParamBlockBuffer>& shadowCubeMasks);
 	};
 
+	/** 
+	 * Material used for copying the contents of a depth-only shadow map into the currently bound depth target, 
+	 * overwriting any existing depth. 
+	 */
+	class ShadowDepthCopyMat : public RendererMaterial<ShadowDepthCopyMat>
+	{
+		RMAT_DEF("ShadowDepthCopy.bsl");
+
+	public:
+		ShadowDepthCopyMat();
+
+		/** 
+		 * Copies the depth of the provided texture into the currently bound viewport. The viewport is expected to be
+		 * the same size as the source texture. 
+		 */
+		void execute(const SPtr<Texture>& source);
+
+	private:
+		GpuParamTexture mSourceParam;
+	};
+
 	BS_PARAM_BLOCK_BEGIN(ShadowProjectVertParamsDef)
 		BS_PARAM_BLOCK_ENTRY(Vector4, gPositionAndScale)
 	BS_PARAM_BLOCK_END
@@ -451,8 +473,29 @@ namespace bs { namespace ct
 			UINT32 startIdx;
 			UINT32 numShadows;
 		};
+
+		/** 
+		 * Shadow map of a stationary light containing only the shadow casters that cannot move. Persists between frames
+		 * and is only re-rendered when the light or one of the casters within its bounds changes.
+		 */
+		struct StaticShadowMap
+		{
+			SPtr<PooledRenderTexture> texture;
+			UINT32 size = 0;
+			bool isDirty = true;
+			UINT32 lastUsedCounter = 0;
+		};
+
+		/** Determines which shadow casters to render into a shadow map. */
+		enum class CasterFilter
+		{
+			All, /**< Render all shadow casters. */
+			Static, /**< Render only casters that cannot move. */
+			Dynamic /**< Render only casters that can move. */
+		};
 	public:
 		ShadowRendering(UINT32 shadowMapSize);
+		~ShadowRendering();
 
 		/** For each visible shadow casting light, renders a shadow map from its point of view. */
 		void renderShadowMaps(RendererScene& scene, const RendererViewGroup& viewGroup, const FrameInfo& frameInfo);
@@ -466,6 +509,21 @@ namespace bs { namespace ct
 
 		/** Changes the default shadow map size. Will cause all shadow maps to be rebuilt. */
 		void setShadowMapSize(UINT32 size);
+
+		/** Notifies the system that properties of a light changed, requiring its static shadow map to be re-rendered. */
+		void notifyLightUpdated(const Light* light);
+
+		/** Notifies the system that a light was removed from the scene, releasing its static shadow map. */
+		void notifyLightRemoved(const Light* light);
+
+		/** 
+		 * Notifies the system that a shadow caster that cannot move was added, removed or modified. Static shadow maps
+		 * of all lights whose bounds intersect the caster will be re-rendered.
+		 *
+		 * @param[in]	bounds	Bounds of the modified caster. When a caster moves this should be called with both its
+		 *						old and new bounds.
+		 */
+		void notifyStaticCasterChanged(const Sphere& bounds);
 	private:
 		/** Renders cascaded shadow maps for the provided directional light viewed from the provided view. */
 		void renderCascadedShadowMaps(UINT32 viewIdx, UINT32 lightIdx, RendererScene& scene, const FrameInfo& frameInfo);
@@ -493,6 +551,26 @@ namespace bs { namespace ct
 		void calcShadowMapProperties(const RendererLight& light, RendererScene& scene, UINT32 border, UINT32& size, 
 			SmallVector<float, 4>& fadePercents, float& maxFadePercent) const;
 
+		/** 
+		 * Returns the static shadow map for the provided light. The map is (re)created if it doesn't exist, or if its size
+		 * doesn't match the requested size, in which case it is marked as dirty.
+		 *
+		 * @param[in]	light		Light to retrieve the static shadow map for. Must be a spot or a radial light.
+		 * @param[in]	size		Size of the shadow map (or a single cubemap face), in pixels.
+		 * @return					Static shadow map of the light. Stays valid until the next call to this method.
+		 */
+		StaticShadowMap& getStaticShadowMap(const Light& light, UINT32 size);
+
+		/** Checks if the provided renderable should be rendered with the provided caster filter. */
+		static bool isCasterIncluded(const RendererObject& renderable, CasterFilter filter);
+
+		/** 
+		 * Returns the level of detail to render the provided renderable with, when rendering casters using the provided
+		 * filter. Static shadow maps are cached across frames, so they always use the most detailed level instead of the
+		 * view dependent RendererObject::shadowLOD.
+		 */
+		static UINT32 getCasterLOD(const RendererObject& renderable, CasterFilter filter);
+
 		/**
 		 * Draws a mesh representing near and far planes at the provided coordinates. The mesh is constructed using
 		 * normalized device coordinates and requires no perspective transform. Near plane will be drawn using front facing
@@ -585,6 +663,7 @@ namespace bs { namespace ct
 		ShadowDepthNormalMat mDepthNormalMat;
 		ShadowDepthCubeMat mDepthCubeMat;
 		ShadowDepthDirectionalMat mDepthDirectionalMat;
+		ShadowDepthCopyMat mDepthCopyMat;
 
 		ShadowProjectStencilMaterials mProjectStencilMaterials;
 		ShadowProjectMaterials mProjectMaterials;
@@ -598,12 +677,21 @@ namespace bs { namespace ct
 
 		Vector<ShadowInfo> mShadowInfos;
 
+		UnorderedMap<const Light*, StaticShadowMap> mStaticShadowMaps;
+
 		Vector<LightShadows> mSpotLightShadows;
 		Vector<LightShadows> mRadialLightShadows;
 		Vector<UINT32> mDirectionalLightShadows;
 
 		SPtr<VertexDeclaration> mPositionOnlyVD;
 
+		// Parameter buffers re-used by all shadow maps
+		SPtr<GpuParamBlockBuffer> mShadowParamsBuffer;
+		SPtr<GpuParamBlockBuffer> mShadowCubeMatricesBuffer;
+		SPtr<GpuParamBlockBuffer> mShadowCubeMasksBuffer;
+		SPtr<GpuParamBlockBuffer> mShadowProjectParamsBuffer;
+		SPtr<GpuParamBlockBuffer> mShadowProjectOmniParamsBuffer;
+
 		// Mesh information used for drawing near & far planes
 		SPtr<IndexBuffer> mPlaneIB;
 		SPtr<VertexBuffer> mPlaneVB;
@@ -5,6 +5,7 @@
 #include "BsTexture.h"
 #include "BsGpuBuffer.h"
 #include "BsTextureManager.h"
+#include "BsPixelUtil.h"
 
 namespace bs { namespace ct
 {
@@ -28,6 +29,8 @@ namespace bs { namespace ct
 			mPool->_unregisterBuffer(this);
 	}
 
+	const UINT32 GpuResourcePool::MAX_UNUSED_FRAMES = 30;
+
 	GpuResourcePool::~GpuResourcePool()
 	{
 		for (auto& texture : mTextures)
@@ -39,24 +42,23 @@ namespace bs { namespace ct
 
 	SPtr<PooledRenderTexture> GpuResourcePool::get(const POOLED_RENDER_TEXTURE_DESC& desc)
 	{
-		for (auto& texturePair : mTextures)
-		{
-			SPtr<PooledRenderTexture> textureData = texturePair.second.lock();
+		mStats.numRequests++;
 
-			if (!textureData->mIsFree)
-				continue;
+		auto iterFind = mFreeTextures.find(desc);
+		if (iterFind != mFreeTextures.end() && !iterFind->second.empty())
+		{
+			SPtr<PooledRenderTexture> textureData = iterFind->second.back();
+			iterFind->second.pop_back();
 
-			if (textureData->texture == nullptr)
-				continue;
+			textureData->mIsFree = false;
+			mStats.numHits++;
 
-			if (matches(textureData->texture, desc))
-			{
-				textureData->mIsFree = false;
-				return textureData;
-			}
+			return textureData;
 		}
 
 		SPtr<PooledRenderTexture> newTextureData = bs_shared_ptr_new<PooledRenderTexture>(this);
+		newTextureData->mDesc = desc;
+		newTextureData->mMemorySize = calcMemorySize(desc);
 		_registerTexture(newTextureData);
 
 		TEXTURE_DESC texDesc;
@@ -103,24 +105,23 @@ namespace bs { namespace ct
 
 	SPtr<PooledStorageBuffer> GpuResourcePool::get(const POOLED_STORAGE_BUFFER_DESC& desc)
 	{
-		for (auto& bufferPair : mBuffers)
-		{
-			SPtr<PooledStorageBuffer> bufferData = bufferPair.second.lock();
+		mStats.numRequests++;
 
-			if (!bufferData->mIsFree)
-				continue;
+		auto iterFind = mFreeBuffers.find(desc);
+		if (iterFind != mFreeBuffers.end() && !iterFind->second.empty())
+		{
+			SPtr<PooledStorageBuffer> bufferData = iterFind->second.back();
+			iterFind->second.pop_back();
 
-			if (bufferData->buffer == nullptr)
-				continue;
+			bufferData->mIsFree = false;
+			mStats.numHits++;
 
-			if (matches(bufferData->buffer, desc))
-			{
-				bufferData->mIsFree = false;
-				return bufferData;
-			}
+			return bufferData;
 		}
 
 		SPtr<PooledStorageBuffer> newBufferData = bs_shared_ptr_new<PooledStorageBuffer>(this);
+		newBufferData->mDesc = desc;
+		newBufferData->mMemorySize = calcMemorySize(desc);
 		_registerBuffer(newBufferData);
 
 		GPU_BUFFER_DESC bufferDesc;
@@ -137,74 +138,183 @@ namespace bs { namespace ct
 
 	void GpuResourcePool::release(const SPtr<PooledRenderTexture>& texture)
 	{
-		auto iterFind = mTextures.find(texture.get());
-		iterFind->second.lock()->mIsFree = true;
+		if (texture->mIsFree)
+			return;
+
+		texture->mIsFree = true;
+		texture->mLastUsedFrame = mFrameIdx;
+
+		mFreeTextures[texture->mDesc].push_back(texture);
 	}
 
 	void GpuResourcePool::release(const SPtr<PooledStorageBuffer>& buffer)
 	{
-		auto iterFind = mBuffers.find(buffer.get());
-		iterFind->second.lock()->mIsFree = true;
+		if (buffer->mIsFree)
+			return;
+
+		buffer->mIsFree = true;
+		buffer->mLastUsedFrame = mFrameIdx;
+
+		mFreeBuffers[buffer->mDesc].push_back(buffer);
+	}
+
+	void GpuResourcePool::update()
+	{
+		mFrameIdx++;
+
+		// Resources are released in order, so the oldest ones are always at the start of each bucket
+		auto isExpired = [&](UINT64 lastUsedFrame) { return (mFrameIdx - lastUsedFrame) > MAX_UNUSED_FRAMES; };
+
+		for (auto& entry : mFreeTextures)
+		{
+			auto& textures = entry.second;
+
+			auto iterFirstActive = std::find_if(textures.begin(), textures.end(), 
+				[&](const SPtr<PooledRenderTexture>& texture) { return !isExpired(texture->mLastUsedFrame); });
+
+			textures.erase(textures.begin(), iterFirstActive);
+		}
+
+		for (auto& entry : mFreeBuffers)
+		{
+			auto& buffers = entry.second;
+
+			auto iterFirstActive = std::find_if(buffers.begin(), buffers.end(),
+				[&](const SPtr<PooledStorageBuffer>& buffer) { return !isExpired(buffer->mLastUsedFrame); });
+
+			buffers.erase(buffers.begin(), iterFirstActive);
+		}
+	}
+
+	size_t GpuResourcePool::DescHashFunction::operator()(const POOLED_RENDER_TEXTURE_DESC& desc) const
+	{
+		size_t hash = 0;
+		hash_combine(hash, desc.type);
+		hash_combine(hash, desc.format);
+		hash_combine(hash, desc.width);
+		hash_combine(hash, desc.height);
+		hash_combine(hash, desc.flag);
+		hash_combine(hash, desc.arraySize);
+		hash_combine(hash, desc.numMipLevels);
+
+		return hash;
 	}
 
-	bool GpuResourcePool::matches(const SPtr<Texture>& texture, const POOLED_RENDER_TEXTURE_DESC& desc)
+	size_t GpuResourcePool::DescHashFunction::operator()(const POOLED_STORAGE_BUFFER_DESC& desc) const
 	{
-		const TextureProperties& texProps = texture->getProperties();
+		size_t hash = 0;
+		hash_combine(hash, desc.type);
+		hash_combine(hash, desc.numElements);
+
+		if (desc.type == GBT_STANDARD)
+			hash_combine(hash, desc.format);
+		else // Structured
+			hash_combine(hash, desc.elementSize);
+
+		return hash;
+	}
 
-		bool match = texProps.getTextureType() == desc.type 
-			&& texProps.getFormat() == desc.format 
-			&& texProps.getWidth() == desc.width 
-			&& texProps.getHeight() == desc.height
-			&& (texProps.getUsage() & desc.flag) == desc.flag
+	bool GpuResourcePool::DescEqualFunction::operator()(const POOLED_RENDER_TEXTURE_DESC& lhs, 
+		const POOLED_RENDER_TEXTURE_DESC& rhs) const
+	{
+		bool match = lhs.type == rhs.type
+			&& lhs.format == rhs.format
+			&& lhs.width == rhs.width
+			&& lhs.height == rhs.height
+			&& lhs.flag == rhs.flag
 			&& (
-				(desc.type == TEX_TYPE_2D 
-					&& texProps.isHardwareGammaEnabled() == desc.hwGamma 
-					&& texProps.getNumSamples() == desc.numSamples)
-				|| (desc.type == TEX_TYPE_3D 
-					&& texProps.getDepth() == desc.depth)
-				|| (desc.type == TEX_TYPE_CUBE_MAP)
+				(lhs.type == TEX_TYPE_2D
+					&& lhs.hwGamma == rhs.hwGamma
+					&& lhs.numSamples == rhs.numSamples)
+				|| (lhs.type == TEX_TYPE_3D
+					&& lhs.depth == rhs.depth)
+				|| (lhs.type == TEX_TYPE_CUBE_MAP)
 				)
-			&& texProps.getNumArraySlices() == desc.arraySize
-			&& texProps.getNumMipmaps() == desc.numMipLevels
+			&& lhs.arraySize == rhs.arraySize
+			&& lhs.numMipLevels == rhs.numMipLevels
 			;
 
 		return match;
 	}
 
-	bool GpuResourcePool::matches(const SPtr<GpuBuffer>& buffer, const POOLED_STORAGE_BUFFER_DESC& desc)
+	bool GpuResourcePool::DescEqualFunction::operator()(const POOLED_STORAGE_BUFFER_DESC& lhs, 
+		const POOLED_STORAGE_BUFFER_DESC& rhs) const
 	{
-		const GpuBufferProperties& props = buffer->getProperties();
-
-		bool match = props.getType() == desc.type && props.getElementCount() == desc.numElements;
+		bool match = lhs.type == rhs.type && lhs.numElements == rhs.numElements;
 		if(match)
 		{
-			if (desc.type == GBT_STANDARD)
-				match = props.getFormat() == desc.format;
+			if (lhs.type == GBT_STANDARD)
+				match = lhs.format == rhs.format;
 			else // Structured
-				match = props.getElementSize() == desc.elementSize;
+				match = lhs.elementSize == rhs.elementSize;
 		}
 
 		return match;
 	}
 
+	UINT64 GpuResourcePool::calcMemorySize(const POOLED_RENDER_TEXTURE_DESC& desc)
+	{
+		UINT32 width = desc.width;
+		UINT32 height = desc.height;
+		UINT32 depth = desc.depth;
+
+		UINT64 size = 0;
+		for (UINT32 i = 0; i <= desc.numMipLevels; i++)
+		{
+			size += PixelUtil::getMemorySize(width, height, depth, desc.format);
+
+			width = std::max(1U, width / 2);
+			height = std::max(1U, height / 2);
+			depth = std::max(1U, depth / 2);
+		}
+
+		UINT32 numFaces = desc.type == TEX_TYPE_CUBE_MAP ? 6 : 1;
+		if (desc.type != TEX_TYPE_3D)
+			numFaces *= desc.arraySize;
+
+		return size * numFaces * std::max(desc.numSamples, 1U);
+	}
+
+	UINT64 GpuResourcePool::calcMemorySize(const POOLED_STORAGE_BUFFER_DESC& desc)
+	{
+		if (desc.type == GBT_STANDARD)
+			return (UINT64)desc.numElements * bs::GpuBuffer::getFormatSize(desc.format);
+		else // Structured
+			return (UINT64)desc.numElements * desc.elementSize;
+	}
+
 	void GpuResourcePool::_registerTexture(const SPtr<PooledRenderTexture>& texture)
 	{
 		mTextures.insert(std::make_pair(texture.get(), texture));
+
+		mStats.numTextures++;
+		mStats.memory += texture->mMemorySize;
+		mStats.peakMemory = std::max(mStats.peakMemory, mStats.memory);
 	}
 
 	void GpuResourcePool::_unregisterTexture(PooledRenderTexture* texture)
 	{
 		mTextures.erase(texture);
+
+		mStats.numTextures--;
+		mStats.memory -= texture->mMemorySize;
 	}
 
 	void GpuResourcePool::_registerBuffer(const SPtr<PooledStorageBuffer>& buffer)
 	{
 		mBuffers.insert(std::make_pair(buffer.get(), buffer));
+
+		mStats.numBuffers++;
+		mStats.memory += buffer->mMemorySize;
+		mStats.peakMemory = std::max(mStats.peakMemory, mStats.memory);
 	}
 
 	void GpuResourcePool::_unregisterBuffer(PooledStorageBuffer* buffer)
 	{
 		mBuffers.erase(buffer);
+
+		mStats.numBuffers--;
+		mStats.memory -= buffer->mMemorySize;
 	}
 
 	POOLED_RENDER_TEXTURE_DESC POOLED_RENDER_TEXTURE_DESC::create2D(PixelFormat format, UINT32 width, UINT32 height,
@@ -7,11 +7,13 @@
 #include "BsIBLUtility.h"
 #include "BsRendererManager.h"
 #include "BsRenderBeast.h"
+#include "BsRendererScene.h"
+#include "BsRendererObject.h"
 
 namespace bs { namespace ct 
 {
 	LightProbes::LightProbes()
-		:mTetrahedronVolumeDirty(false), mNumAllocatedEntries(0), mNumUsedEntries(0)
+		:mTetrahedronVolumeDirty(false), mNumAllocatedEntries(0), mNumUsedEntries(0), mTetrahedronGridSize()
 	{
 		resizeCoefficientBuffer(512);
 	}
@@ -82,23 +84,28 @@ namespace bs { namespace ct
 				}
 			}
 
-			mTetrahedronInfos.clear();
-			mTetrahedronBounds.clear();
+			// Volumes are also marked dirty when probes only need to be re-rendered, in which case the probe positions 
+			// remain the same and there's no need to re-run the (expensive) tetrahedralization
+			if (mTempTetrahedronPositions != mTetrahedronPositions)
+			{
+				std::swap(mTempTetrahedronPositions, mTetrahedronPositions);
 
-			generateTetrahedronData(mTempTetrahedronPositions, mTetrahedronInfos, false);
+				mTetrahedronInfos.clear();
+				mTetrahedronBounds.clear();
 
-			// Generate bounds
-			for(auto& entry : mTetrahedronInfos)
-			{
-				// Skipping outer faces
-				if (entry.volume.neighbors[3] < 0)
-					continue;
+				generateTetrahedronData(mTetrahedronPositions, mTetrahedronInfos, false);
+
+				// Generate bounds
+				for (auto& entry : mTetrahedronInfos)
+				{
+					AABox aabox = AABox(Vector3::INF, -Vector3::INF);
+					for (int i = 0; i < 4; ++i)
+						aabox.merge(mTetrahedronPositions[entry.volume.vertices[i]]);
 
-				AABox aabox = AABox(Vector3::INF, -Vector3::INF);
-				for (int i = 0; i < 4; ++i)
-					aabox.merge(mTempTetrahedronPositions[entry.volume.neighbors[i]]);
+					mTetrahedronBounds.push_back(aabox);
+				}
 
-				mTetrahedronBounds.push_back(aabox);
+				buildTetrahedronGrid();
 			}
 
 			mTempTetrahedronPositions.clear();
@@ -155,7 +162,7 @@ namespace bs { namespace ct
 					numProbeUpdates++;
 				}
 
-				if (maxProbes != 0 && numProbeUpdates >= numProbeUpdates)
+				if (maxProbes != 0 && numProbeUpdates >= maxProbes)
 					break;
 			}
 
@@ -284,6 +291,148 @@ namespace bs { namespace ct
 		mTempTetrahedronVisibility.clear();
 	}
 
+	void LightProbes::buildTetrahedronGrid()
+	{
+		// Maximum number of grid cells along a single axis
+		static const UINT32 MAX_GRID_SIZE = 32;
+
+		mTetrahedronGrid.clear();
+		mTetrahedronGridBounds = AABox(Vector3::INF, -Vector3::INF);
+
+		if (mTetrahedronInfos.empty())
+		{
+			memset(mTetrahedronGridSize, 0, sizeof(mTetrahedronGridSize));
+			return;
+		}
+
+		for (auto& position : mTetrahedronPositions)
+			mTetrahedronGridBounds.merge(position);
+
+		// Aim for roughly one tetrahedron per cell
+		UINT32 numTets = (UINT32)mTetrahedronInfos.size();
+		UINT32 cellsPerAxis = (UINT32)Math::ceilToInt(std::cbrt((float)numTets));
+		cellsPerAxis = Math::clamp(cellsPerAxis, 1U, MAX_GRID_SIZE);
+
+		for (UINT32 i = 0; i < 3; i++)
+			mTetrahedronGridSize[i] = cellsPerAxis;
+
+		mTetrahedronGrid.resize(cellsPerAxis * cellsPerAxis * cellsPerAxis, -1);
+
+		Vector3 gridMin = mTetrahedronGridBounds.getMin();
+		Vector3 gridSize = mTetrahedronGridBounds.getSize();
+		Vector3 cellSize = gridSize / (float)cellsPerAxis;
+
+		auto toCell = [&](float value, UINT32 axis)
+		{
+			if (cellSize[axis] <= 0.0f)
+				return 0;
+
+			INT32 cell = Math::floorToInt((value - gridMin[axis]) / cellSize[axis]);
+			return Math::clamp(cell, 0, (INT32)cellsPerAxis - 1);
+		};
+
+		// Assign each tetrahedron to all the empty cells its bounds overlap
+		for (UINT32 i = 0; i < numTets; i++)
+		{
+			const AABox& bounds = mTetrahedronBounds[i];
+
+			INT32 minCell[3];
+			INT32 maxCell[3];
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				minCell[j] = toCell(bounds.getMin()[j], j);
+				maxCell[j] = toCell(bounds.getMax()[j], j);
+			}
+
+			for (INT32 z = minCell[2]; z <= maxCell[2]; z++)
+			{
+				for (INT32 y = minCell[1]; y <= maxCell[1]; y++)
+				{
+					for (INT32 x = minCell[0]; x <= maxCell[0]; x++)
+					{
+						INT32& cell = mTetrahedronGrid[(z * cellsPerAxis + y) * cellsPerAxis + x];
+						if (cell == -1)
+							cell = (INT32)i;
+					}
+				}
+			}
+		}
+	}
+
+	INT32 LightProbes::findTetrahedron(const Vector3& position, INT32 hint) const
+	{
+		// Tolerance for points lying on a face shared between two tetrahedra
+		static const float EPSILON = 0.0001f;
+
+		UINT32 numTets = (UINT32)mTetrahedronInfos.size();
+		if (numTets == 0)
+			return -1;
+
+		INT32 current = hint;
+		if (current < 0 || current >= (INT32)numTets)
+		{
+			Vector3 gridMin = mTetrahedronGridBounds.getMin();
+			Vector3 gridSize = mTetrahedronGridBounds.getSize();
+
+			UINT32 cellIdx[3];
+			for (UINT32 i = 0; i < 3; i++)
+			{
+				float t = gridSize[i] > 0.0f ? (position[i] - gridMin[i]) / gridSize[i] : 0.0f;
+				INT32 cell = Math::floorToInt(t * mTetrahedronGridSize[i]);
+
+				cellIdx[i] = (UINT32)Math::clamp(cell, 0, (INT32)mTetrahedronGridSize[i] - 1);
+			}
+
+			current = mTetrahedronGrid[(cellIdx[2] * mTetrahedronGridSize[1] + cellIdx[1]) * mTetrahedronGridSize[0] + 
+				cellIdx[0]];
+
+			if (current == -1)
+				current = 0;
+		}
+
+		// Walk towards the point by always crossing the face opposite to the vertex with the most negative barycentric
+		// coordinate. The walk is guaranteed to terminate on a Delaunay tetrahedralization, but cap the number of steps
+		// to be safe against degenerate tetrahedra.
+		for (UINT32 i = 0; i < numTets; i++)
+		{
+			const TetrahedronData& entry = mTetrahedronInfos[current];
+			Vector3 bary = entry.transform.multiplyAffine(position);
+
+			float coords[4] = { bary.x, bary.y, bary.z, 1.0f - bary.x - bary.y - bary.z };
+
+			UINT32 minIdx = 0;
+			for (UINT32 j = 1; j < 4; j++)
+			{
+				if (coords[j] < coords[minIdx])
+					minIdx = j;
+			}
+
+			if (coords[minIdx] >= -EPSILON)
+				return current;
+
+			// Crossing an outer face means the point is outside of the volume
+			INT32 next = entry.volume.neighbors[minIdx];
+			if (next < 0 || next >= (INT32)numTets)
+				return -1;
+
+			current = next;
+		}
+
+		return -1;
+	}
+
+	void LightProbes::updateRenderableTetrahedra(const SceneInfo& sceneInfo)
+	{
+		UINT32 numRenderables = (UINT32)sceneInfo.renderables.size();
+		for (UINT32 i = 0; i < numRenderables; i++)
+		{
+			RendererObject* rendererObject = sceneInfo.renderables[i];
+			const Vector3& position = sceneInfo.renderableCullInfos[i].bounds.getSphere().getCenter();
+
+			rendererObject->lightProbeTetrahedron = findTetrahedron(position, rendererObject->lightProbeTetrahedron);
+		}
+	}
+
 	/** Hash value generator for std::pair<INT32, INT32>. */
 	struct pair_hash
 	{
@@ -309,7 +458,7 @@ namespace bs { namespace ct
 			if (includeOuterFaces)
 				numOutputTets += (UINT32)volume.outerFaces.size();
 
-			output.reserve(includeOuterFaces);
+			output.reserve(numOutputTets);
 
 			// Insert innert tetrahedrons, generate matrices
 			for(UINT32 i = 0; i < (UINT32)volume.tetrahedra.size(); ++i)
@@ -11,11 +11,27 @@
 #include "BsGpuParamsSet.h"
 #include "BsMorphShapes.h"
 #include "BsAnimationManager.h"
+#include "BsBitwise.h"
 
 namespace bs { namespace ct
 {
 	PerFrameParamDef gPerFrameParamDef;
 
+	size_t InstanceBatchKey::HashFunction::operator()(const InstanceBatchKey& key) const
+	{
+		size_t hash = 0;
+		hash_combine(hash, key.mesh);
+		hash_combine(hash, key.indexOffset);
+		hash_combine(hash, key.indexCount);
+		hash_combine(hash, key.material);
+		hash_combine(hash, key.techniqueIdx);
+		hash_combine(hash, key.passIdx);
+
+		return hash;
+	}
+
+	const UINT32 ObjectRenderer::MAX_INSTANCES_PER_BATCH = 1024;
+
 	ObjectRenderer::ObjectRenderer()
 	{
 		mPerFrameParamBuffer = gPerFrameParamDef.createBuffer();
@@ -23,6 +39,8 @@ namespace bs { namespace ct
 
 	void ObjectRenderer::initElement(RendererObject& owner, BeastRenderableElement& element)
 	{
+		element.allowInstancing = false;
+
 		SPtr<Shader> shader = element.material->getShader();
 		if (shader == nullptr)
 		{
@@ -67,11 +85,183 @@ namespace bs { namespace ct
 
 		if (gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "boneMatrices"))
 			gpuParams->setBuffer(GPT_VERTEX_PROGRAM, "boneMatrices", element.boneMatrixBuffer);
+
+		if (gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "gPerInstanceData"))
+		{
+			gpuParams->getBufferParam(GPT_VERTEX_PROGRAM, "gPerInstanceData", element.perInstanceDataParam);
+
+			// Shader reads per-object data from the instance buffer, so one must be bound even when rendering on its own
+			if (owner.perInstanceBuffer == nullptr)
+			{
+				owner.perInstanceBuffer = getInstanceBuffer(1);
+				owner.perInstanceBuffer->writeData(0, sizeof(PerInstanceData), &owner.instanceData, BWT_DISCARD);
+			}
+
+			element.perInstanceDataParam.set(owner.perInstanceBuffer);
+
+			// Passes of non-separable shaders must be rendered one after another for each object, which batching would
+			// break
+			UINT32 numPasses = element.material->getNumPasses(element.techniqueIdx);
+			bool instancingDisabled = (shader->getFlags() & (UINT32)ShaderFlags::DisableInstancing) != 0;
+
+			// Animated elements have their own per-object vertex data (bones, morph shapes or pre-skinned vertices), 
+			// so they can't share a draw call
+			element.allowInstancing = !instancingDisabled && element.animType == RenderableAnimType::None &&
+				(numPasses == 1 || shader->getAllowSeparablePasses());
+		}
 	}
 
 	void ObjectRenderer::setParamFrameParams(float time)
 	{
 		gPerFrameParamDef.gTime.set(mPerFrameParamBuffer, time);
+
+		mNextInstanceBuffer = 0;
+	}
+
+	void ObjectRenderer::batchElements(const Vector<RenderQueueElement>& elements, 
+		const Vector<RendererObject*>& renderables, bool preserveOrder, Vector<RenderBatch>& output)
+	{
+		output.clear();
+		mElementBatches.resize(elements.size());
+
+		// Assign each element to a batch. When order doesn't need to be preserved all matching elements are added to the
+		// same batch, otherwise only consecutive ones are.
+		for (UINT32 i = 0; i < (UINT32)elements.size(); i++)
+		{
+			const RenderQueueElement& queueElement = elements[i];
+			BeastRenderableElement* element = static_cast<BeastRenderableElement*>(queueElement.renderElem);
+
+			UINT32 batchIdx = (UINT32)-1;
+			if (element->allowInstancing)
+			{
+				InstanceBatchKey key(*element, queueElement.passIdx);
+				if (preserveOrder)
+				{
+					if (!output.empty())
+					{
+						const RenderBatch& prevBatch = output.back();
+						if (prevBatch.element->allowInstancing && prevBatch.numInstances < MAX_INSTANCES_PER_BATCH &&
+							InstanceBatchKey(*prevBatch.element, prevBatch.passIdx) == key)
+						{
+							batchIdx = (UINT32)output.size() - 1;
+						}
+					}
+				}
+				else
+				{
+					auto iterFind = mOpenBatches.find(key);
+					if (iterFind != mOpenBatches.end() && output[iterFind->second].numInstances < MAX_INSTANCES_PER_BATCH)
+						batchIdx = iterFind->second;
+					else
+						mOpenBatches[key] = (UINT32)output.size();
+				}
+			}
+
+			if (batchIdx == (UINT32)-1)
+			{
+				batchIdx = (UINT32)output.size();
+
+				RenderBatch batch;
+				batch.element = element;
+				batch.passIdx = queueElement.passIdx;
+				batch.applyPass = queueElement.applyPass;
+				batch.numInstances = 0;
+
+				output.push_back(batch);
+			}
+
+			output[batchIdx].numInstances++;
+			mElementBatches[i] = batchIdx;
+		}
+
+		mOpenBatches.clear();
+
+		// Batches no longer follow the sorted element order, so determine when passes need to be bound
+		if (!preserveOrder)
+		{
+			const Shader* prevShader = nullptr;
+			UINT32 prevTechniqueIdx = (UINT32)-1;
+			UINT32 prevPassIdx = (UINT32)-1;
+			for (auto& batch : output)
+			{
+				const Shader* shader = batch.element->material->getShader().get();
+				batch.applyPass = shader != prevShader || batch.element->techniqueIdx != prevTechniqueIdx || 
+					batch.passIdx != prevPassIdx;
+
+				prevShader = shader;
+				prevTechniqueIdx = batch.element->techniqueIdx;
+				prevPassIdx = batch.passIdx;
+			}
+		}
+
+		// Gather per-instance data for every batch with multiple instances, and upload it to the GPU
+		mBatchOffsets.resize(output.size());
+
+		UINT32 numInstances = 0;
+		for (UINT32 i = 0; i < (UINT32)output.size(); i++)
+		{
+			mBatchOffsets[i] = numInstances;
+
+			if (output[i].numInstances > 1)
+				numInstances += output[i].numInstances;
+		}
+
+		if (numInstances == 0)
+			return;
+
+		mInstanceData.resize(numInstances);
+		for (UINT32 i = 0; i < (UINT32)elements.size(); i++)
+		{
+			UINT32 batchIdx = mElementBatches[i];
+			if (output[batchIdx].numInstances == 1)
+				continue;
+
+			const BeastRenderableElement* element = static_cast<BeastRenderableElement*>(elements[i].renderElem);
+			mInstanceData[mBatchOffsets[batchIdx]++] = renderables[element->renderableId]->instanceData;
+		}
+
+		for (UINT32 i = 0; i < (UINT32)output.size(); i++)
+		{
+			RenderBatch& batch = output[i];
+			if (batch.numInstances == 1)
+				continue;
+
+			// Offsets were advanced past the end of each batch while gathering the data
+			UINT32 offset = mBatchOffsets[i] - batch.numInstances;
+
+			batch.instanceBuffer = getInstanceBuffer(batch.numInstances);
+			batch.instanceBuffer->writeData(0, batch.numInstances * sizeof(PerInstanceData), &mInstanceData[offset], 
+				BWT_DISCARD);
+		}
+	}
+
+	SPtr<GpuBuffer> ObjectRenderer::getInstanceBuffer(UINT32 numInstances)
+	{
+		GPU_BUFFER_DESC bufferDesc;
+		bufferDesc.type = GBT_STRUCTURED;
+		bufferDesc.elementSize = sizeof(PerInstanceData);
+		bufferDesc.format = BF_UNKNOWN;
+
+		// Single instance buffers are owned by individual renderables, so don't pool them
+		if (numInstances == 1)
+		{
+			bufferDesc.elementCount = 1;
+			return GpuBuffer::create(bufferDesc);
+		}
+
+		// Buffers are re-used every frame. Each batch gets its own buffer so data of previous batches remains valid 
+		// until they are rendered.
+		if (mNextInstanceBuffer >= (UINT32)mInstanceBuffers.size())
+			mInstanceBuffers.push_back(nullptr);
+
+		SPtr<GpuBuffer>& buffer = mInstanceBuffers[mNextInstanceBuffer++];
+		if (buffer == nullptr || buffer->getProperties().getElementCount() < numInstances)
+		{
+			bufferDesc.elementCount = Bitwise::nextPow2(numInstances);
+			buffer = GpuBuffer::create(bufferDesc);
+		}
+
+		return buffer;
 	}
 
 	void DefaultMaterial::_initDefines(ShaderDefines& defines)
@@ -0,0 +1,602 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsPreSkinning.h"
+#include "BsRendererObject.h"
+#include "BsMesh.h"
+#include "BsMeshData.h"
+#include "BsVertexBuffer.h"
+#include "BsVertexDataDesc.h"
+#include "BsAnimationManager.h"
+#include "BsTaskScheduler.h"
+#include "BsPixelUtil.h"
+
+#if BS_SIMD_SSE2
+#include <emmintrin.h>
+#include <immintrin.h>
+
+// AVX2 code is compiled regardless of the target architecture, and only executed if the CPU supports it
+#if BS_COMPILER == BS_COMPILER_MSVC
+	#define BS_AVX2_FUNCTION
+#else
+	#define BS_AVX2_FUNCTION __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace bs { namespace ct
+{
+	/** Minimum number of vertices evaluated by a single worker task. */
+	static const UINT32 MIN_VERTICES_PER_TASK = 4096;
+
+	/** Number of vertices decoded and skinned at once. */
+	static const UINT32 VERTICES_PER_BLOCK = 64;
+
+	/** 
+	 * Animated elements of a block of vertices, decoded into four component vectors so they can be transformed with
+	 * SIMD instructions. 
+	 */
+	struct SkinningBlock
+	{
+		float positions[VERTICES_PER_BLOCK][4]; /**< Positions with the fourth component set to one. */
+		float normals[VERTICES_PER_BLOCK][4]; /**< Normals with the fourth component set to zero. */
+		float tangents[VERTICES_PER_BLOCK][4]; /**< Tangents with the fourth component set to zero. */
+
+		/** Bone indices, guaranteed to be in the valid range. */
+		UINT8 blendIndices[VERTICES_PER_BLOCK][4];
+
+		/** Bone weights, zero for any bones that shouldn't affect the vertex. */
+		float blendWeights[VERTICES_PER_BLOCK][4];
+
+		UINT32 numVertices;
+		bool hasNormal;
+		bool hasTangent;
+	};
+
+	/** Decodes a normal stored in the 8-bit packed format. */
+	static Vector3 unpackNormal(const UINT8* packed)
+	{
+		return Vector3(
+			packed[0] / 255.0f * 2.0f - 1.0f,
+			packed[1] / 255.0f * 2.0f - 1.0f,
+			packed[2] / 255.0f * 2.0f - 1.0f);
+	}
+
+	/** Encodes a normal into the 8-bit packed format. The fourth component is left untouched. */
+	static void packNormal(const Vector3& normal, UINT8* packed)
+	{
+		packed[0] = (UINT8)Math::clamp((int)(normal.x * 127.5f + 127.5f), 0, 255);
+		packed[1] = (UINT8)Math::clamp((int)(normal.y * 127.5f + 127.5f), 0, 255);
+		packed[2] = (UINT8)Math::clamp((int)(normal.z * 127.5f + 127.5f), 0, 255);
+	}
+
+	/** Transforms the animated elements of a single vertex in the block by its blended bone transform. */
+	static void skinVertex(SkinningBlock& block, UINT32 idx, const Matrix4* bones)
+	{
+		Matrix4 blendMatrix = Matrix4::ZERO;
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			const Matrix4& bone = bones[block.blendIndices[idx][i]];
+			float weight = block.blendWeights[idx][i];
+
+			blendMatrix[0] += bone[0] * weight;
+			blendMatrix[1] += bone[1] * weight;
+			blendMatrix[2] += bone[2] * weight;
+		}
+
+		float* position = block.positions[idx];
+		Vector3 skinnedPosition = blendMatrix.multiplyAffine(Vector3(position[0], position[1], position[2]));
+		memcpy(position, &skinnedPosition, sizeof(skinnedPosition));
+
+		if (block.hasNormal)
+		{
+			float* normal = block.normals[idx];
+			Vector3 skinnedNormal = blendMatrix.multiplyDirection(Vector3(normal[0], normal[1], normal[2]));
+			memcpy(normal, &skinnedNormal, sizeof(skinnedNormal));
+		}
+
+		if (block.hasTangent)
+		{
+			float* tangent = block.tangents[idx];
+			Vector3 skinnedTangent = blendMatrix.multiplyDirection(Vector3(tangent[0], tangent[1], tangent[2]));
+			memcpy(tangent, &skinnedTangent, sizeof(skinnedTangent));
+		}
+	}
+
+#if BS_SIMD_SSE2
+	/** 
+	 * Multiplies a four component vector with the matrix consisting of the three provided rows. The fourth component of
+	 * the result is zero.
+	 */
+	inline __m128 transformSSE2(const __m128 (&rows)[3], __m128 vector)
+	{
+		__m128 x = _mm_mul_ps(rows[0], vector);
+		__m128 y = _mm_mul_ps(rows[1], vector);
+		__m128 z = _mm_mul_ps(rows[2], vector);
+		__m128 w = _mm_setzero_ps();
+
+		// Sum the products of each row by summing the columns of the transposed matrix
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+		return _mm_add_ps(_mm_add_ps(x, y), _mm_add_ps(z, w));
+	}
+
+	/** SSE2 version of skinVertex(). */
+	inline void skinVertexSSE2(SkinningBlock& block, UINT32 idx, const Matrix4* bones)
+	{
+		__m128 rows[3] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			const float* bone = &bones[block.blendIndices[idx][i]][0].x;
+			__m128 weight = _mm_set1_ps(block.blendWeights[idx][i]);
+
+			rows[0] = _mm_add_ps(rows[0], _mm_mul_ps(_mm_loadu_ps(bone + 0), weight));
+			rows[1] = _mm_add_ps(rows[1], _mm_mul_ps(_mm_loadu_ps(bone + 4), weight));
+			rows[2] = _mm_add_ps(rows[2], _mm_mul_ps(_mm_loadu_ps(bone + 8), weight));
+		}
+
+		_mm_storeu_ps(block.positions[idx], transformSSE2(rows, _mm_loadu_ps(block.positions[idx])));
+
+		if (block.hasNormal)
+			_mm_storeu_ps(block.normals[idx], transformSSE2(rows, _mm_loadu_ps(block.normals[idx])));
+
+		if (block.hasTangent)
+			_mm_storeu_ps(block.tangents[idx], transformSSE2(rows, _mm_loadu_ps(block.tangents[idx])));
+	}
+
+	/** 
+	 * Multiplies two four component vectors, one in each 128-bit lane, with the matrix consisting of the three provided
+	 * rows of the same lane. The fourth component of each result is zero.
+	 */
+	BS_AVX2_FUNCTION inline __m256 transformAVX2(const __m256 (&rows)[3], __m256 vector)
+	{
+		__m256 x = _mm256_mul_ps(rows[0], vector);
+		__m256 y = _mm256_mul_ps(rows[1], vector);
+		__m256 z = _mm256_mul_ps(rows[2], vector);
+		__m256 w = _mm256_setzero_ps();
+
+		// Same as transformSSE2(), the unpack and shuffle instructions operate on each lane separately
+		__m256 xy0 = _mm256_unpacklo_ps(x, y);
+		__m256 zw0 = _mm256_unpacklo_ps(z, w);
+		__m256 xy1 = _mm256_unpackhi_ps(x, y);
+		__m256 zw1 = _mm256_unpackhi_ps(z, w);
+
+		__m256 sum0 = _mm256_add_ps(_mm256_shuffle_ps(xy0, zw0, _MM_SHUFFLE(1, 0, 1, 0)),
+			_mm256_shuffle_ps(xy0, zw0, _MM_SHUFFLE(3, 2, 3, 2)));
+		__m256 sum1 = _mm256_add_ps(_mm256_shuffle_ps(xy1, zw1, _MM_SHUFFLE(1, 0, 1, 0)),
+			_mm256_shuffle_ps(xy1, zw1, _MM_SHUFFLE(3, 2, 3, 2)));
+
+		return _mm256_add_ps(sum0, sum1);
+	}
+
+	/** 
+	 * Version of skinVertex() that skins the vertices of the block two at a time, one in each 128-bit lane. Returns the
+	 * number of vertices processed, leaving the rest to the caller.
+	 */
+	BS_AVX2_FUNCTION UINT32 skinVerticesAVX2(SkinningBlock& block, const Matrix4* bones)
+	{
+		UINT32 idx = 0;
+		for (; (idx + 2) <= block.numVertices; idx += 2)
+		{
+			__m256 rows[3] = { _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps() };
+			for (UINT32 i = 0; i < 4; i++)
+			{
+				const float* boneA = &bones[block.blendIndices[idx][i]][0].x;
+				const float* boneB = &bones[block.blendIndices[idx + 1][i]][0].x;
+
+				__m256 weight = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(block.blendWeights[idx][i])),
+					_mm_set1_ps(block.blendWeights[idx + 1][i]), 1);
+
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					__m256 row = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(boneA + j * 4)),
+						_mm_loadu_ps(boneB + j * 4), 1);
+
+					rows[j] = _mm256_add_ps(rows[j], _mm256_mul_ps(row, weight));
+				}
+			}
+
+			// Elements of two consecutive vertices are laid out contiguously in the block
+			_mm256_storeu_ps(block.positions[idx], transformAVX2(rows, _mm256_loadu_ps(block.positions[idx])));
+
+			if (block.hasNormal)
+				_mm256_storeu_ps(block.normals[idx], transformAVX2(rows, _mm256_loadu_ps(block.normals[idx])));
+
+			if (block.hasTangent)
+				_mm256_storeu_ps(block.tangents[idx], transformAVX2(rows, _mm256_loadu_ps(block.tangents[idx])));
+		}
+
+		return idx;
+	}
+#endif
+
+	PreSkinning::PreSkinning()
+	{ }
+
+	PreSkinning::~PreSkinning()
+	{ }
+
+	SPtr<VertexBuffer> PreSkinning::registerObject(const RendererObject* object)
+	{
+		Renderable* renderable = object->renderable;
+
+		SPtr<Mesh> mesh = renderable->getMesh();
+		if (mesh == nullptr)
+			return nullptr;
+
+		RenderableAnimType animType = renderable->getAnimType();
+		if (animType == RenderableAnimType::None)
+			return nullptr;
+
+		SPtr<SourceMesh> source;
+		auto iterFind = mSourceMeshes.find(mesh.get());
+		if (iterFind != mSourceMeshes.end())
+			source = iterFind->second;
+		else
+		{
+			source = createSourceMesh(mesh);
+			if (source == nullptr)
+				return nullptr;
+
+			mSourceMeshes[mesh.get()] = source;
+		}
+
+		bool skinned = animType == RenderableAnimType::Skinned || animType == RenderableAnimType::SkinnedMorph;
+		bool morph = animType == RenderableAnimType::Morph || animType == RenderableAnimType::SkinnedMorph;
+
+		if (skinned && source->blendIndicesOffset == (UINT32)-1)
+		{
+			if (source.use_count() == 2)
+				mSourceMeshes.erase(mesh.get());
+
+			return nullptr;
+		}
+
+		AnimatedObject& animObject = mObjects[object];
+		animObject.source = source;
+		animObject.skinned = skinned;
+		animObject.morph = morph;
+
+		VERTEX_BUFFER_DESC desc;
+		desc.vertexSize = source->stride;
+		desc.numVerts = source->numVertices;
+		desc.usage = GBU_DYNAMIC;
+
+		// Start off with the un-animated vertices, until the animation is evaluated
+		UINT32 bufferSize = source->numVertices * source->stride;
+
+		animObject.vertexBuffer = VertexBuffer::create(desc);
+		animObject.vertexBuffer->writeData(0, bufferSize, source->vertices, BWT_DISCARD);
+
+		return animObject.vertexBuffer;
+	}
+
+	void PreSkinning::unregisterObject(const RendererObject* object)
+	{
+		auto iterFind = mObjects.find(object);
+		if (iterFind == mObjects.end())
+			return;
+
+		SPtr<SourceMesh> source = iterFind->second.source;
+		mObjects.erase(iterFind);
+
+		// Release the mesh vertices if no other object references them
+		if (source.use_count() == 2)
+			mSourceMeshes.erase(source->mesh.get());
+	}
+
+	void PreSkinning::update(const RendererAnimationData& animData)
+	{
+		mDirtyObjects.clear();
+
+		UINT32 numDirtyVertices = 0;
+		for (auto& entry : mObjects)
+		{
+			const RendererObject* object = entry.first;
+			AnimatedObject& animObject = entry.second;
+
+			auto iterFind = animData.infos.find(object->renderable->getAnimationId());
+			if (iterFind == animData.infos.end())
+				continue;
+
+			const RendererAnimationData::AnimInfo& animInfo = iterFind->second;
+			animObject.dirty = false;
+
+			if (animObject.skinned)
+			{
+				const RendererAnimationData::PoseInfo& poseInfo = animInfo.poseInfo;
+				const Matrix4* pose = &animData.transforms[poseInfo.startIdx];
+
+				// Most animations keep playing every frame, but idle or paused objects don't need to be re-evaluated
+				if (animObject.pose.size() != poseInfo.numBones ||
+					memcmp(animObject.pose.data(), pose, poseInfo.numBones * sizeof(Matrix4)) != 0)
+				{
+					animObject.pose.assign(pose, pose + poseInfo.numBones);
+					animObject.dirty = true;
+				}
+			}
+
+			if (animObject.morph)
+			{
+				const RendererAnimationData::MorphShapeInfo& morphShapeInfo = animInfo.morphShapeInfo;
+				if (animObject.morphShapes == nullptr || animObject.morphShapeVersion != morphShapeInfo.version)
+				{
+					animObject.morphShapes = morphShapeInfo.meshData;
+					animObject.morphShapeVersion = morphShapeInfo.version;
+					animObject.dirty = true;
+				}
+			}
+
+			if (animObject.dirty)
+			{
+				mDirtyObjects.push_back(&animObject);
+				numDirtyVertices += animObject.source->numVertices;
+			}
+		}
+
+		UINT32 numDirtyObjects = (UINT32)mDirtyObjects.size();
+		if (numDirtyObjects == 0)
+			return;
+
+		// Split the objects into groups of roughly the same number of vertices, one group per task
+		UINT32 numTasks = std::max(1U, std::min(numDirtyVertices / MIN_VERTICES_PER_TASK, numDirtyObjects));
+		UINT32 verticesPerTask = Math::divideAndRoundUp(numDirtyVertices, numTasks);
+
+		Vector<UINT32> groupStarts;
+		groupStarts.push_back(0);
+
+		UINT32 numGroupVertices = 0;
+		for (UINT32 i = 0; i < numDirtyObjects; i++)
+		{
+			if (numGroupVertices >= verticesPerTask)
+			{
+				groupStarts.push_back(i);
+				numGroupVertices = 0;
+			}
+
+			numGroupVertices += mDirtyObjects[i]->source->numVertices;
+		}
+
+		groupStarts.push_back(numDirtyObjects);
+
+		// Vertices are evaluated directly into the locked buffers, instead of being evaluated into a separate CPU buffer
+		// and then copied. Buffers are locked and unlocked on this thread, workers only write to the locked memory.
+		for (auto& animObject : mDirtyObjects)
+			animObject->mappedVertices = (UINT8*)animObject->vertexBuffer->lock(GBL_WRITE_ONLY_DISCARD);
+
+		auto evaluateGroup = [&](UINT32 groupIdx)
+		{
+			for (UINT32 i = groupStarts[groupIdx]; i < groupStarts[groupIdx + 1]; i++)
+				evaluate(*mDirtyObjects[i]);
+		};
+
+		// Evaluate the first group on this thread, while the workers handle the rest
+		UINT32 numGroups = (UINT32)groupStarts.size() - 1;
+
+		Vector<SPtr<Task>> tasks;
+		for (UINT32 i = 1; i < numGroups; i++)
+		{
+			SPtr<Task> task = Task::create("PreSkinning", std::bind(evaluateGroup, i));
+			TaskScheduler::instance().addTask(task);
+
+			tasks.push_back(task);
+		}
+
+		evaluateGroup(0);
+
+		for (auto& task : tasks)
+			task->wait();
+
+		for (auto& animObject : mDirtyObjects)
+		{
+			animObject->vertexBuffer->unlock();
+			animObject->mappedVertices = nullptr;
+		}
+	}
+
+	SPtr<PreSkinning::SourceMesh> PreSkinning::createSourceMesh(const SPtr<Mesh>& mesh)
+	{
+		// Meshes often updated from the CPU would require the vertices to be read back every time they change
+		if ((mesh->getUsage() & MU_DYNAMIC) != 0)
+			return nullptr;
+
+		// Reading the vertices back from the GPU would stall the core thread, so a CPU copy must be available
+		SPtr<MeshData> meshData = mesh->getCachedData();
+		if (meshData == nullptr)
+			return nullptr;
+
+		SPtr<VertexDataDesc> vertexDesc = mesh->getVertexDesc();
+
+		// Only a single vertex stream, with vertex elements in the format produced by the mesh importer is supported
+		UINT32 numElements = vertexDesc->getNumElements();
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			if (vertexDesc->getElement(i).getStreamIdx() != 0)
+				return nullptr;
+		}
+
+		auto hasElement = [&](VertexElementSemantic semantic, VertexElementType type)
+		{
+			const VertexElement* element = vertexDesc->getElement(semantic);
+			return element != nullptr && element->getType() == type;
+		};
+
+		if (!hasElement(VES_POSITION, VET_FLOAT3))
+			return nullptr;
+
+		bool hasNormal = hasElement(VES_NORMAL, VET_UBYTE4_NORM);
+		if (!hasNormal && vertexDesc->hasElement(VES_NORMAL))
+			return nullptr;
+
+		bool hasTangent = hasElement(VES_TANGENT, VET_UBYTE4_NORM);
+		if (!hasTangent && vertexDesc->hasElement(VES_TANGENT))
+			return nullptr;
+
+		bool hasBlendData = hasElement(VES_BLEND_INDICES, VET_UBYTE4) && hasElement(VES_BLEND_WEIGHTS, VET_FLOAT4);
+
+		SPtr<SourceMesh> source = bs_shared_ptr_new<SourceMesh>();
+		source->mesh = mesh;
+		source->numVertices = mesh->getProperties().getNumVertices();
+		source->stride = vertexDesc->getVertexStride(0);
+		source->positionOffset = vertexDesc->getElementOffsetFromStream(VES_POSITION);
+
+		if (hasNormal)
+			source->normalOffset = vertexDesc->getElementOffsetFromStream(VES_NORMAL);
+
+		if (hasTangent)
+			source->tangentOffset = vertexDesc->getElementOffsetFromStream(VES_TANGENT);
+
+		if (hasBlendData)
+		{
+			source->blendIndicesOffset = vertexDesc->getElementOffsetFromStream(VES_BLEND_INDICES);
+			source->blendWeightsOffset = vertexDesc->getElementOffsetFromStream(VES_BLEND_WEIGHTS);
+		}
+
+		source->meshData = meshData;
+		source->vertices = meshData->getElementData(VES_POSITION) - source->positionOffset;
+
+		return source;
+	}
+
+	void PreSkinning::evaluate(AnimatedObject& object)
+	{
+		const SourceMesh& source = *object.source;
+
+		const UINT8* morphPositions = nullptr;
+		const UINT8* morphNormals = nullptr;
+		UINT32 morphStride = 0;
+		UINT32 numMorphVertices = 0;
+
+		if (object.morph && object.morphShapes != nullptr)
+		{
+			morphPositions = object.morphShapes->getElementData(VES_POSITION, 1, 1);
+			morphNormals = object.morphShapes->getElementData(VES_NORMAL, 1, 1);
+			morphStride = object.morphShapes->getVertexDesc()->getVertexStride(1);
+			numMorphVertices = std::min(object.morphShapes->getNumVertices(), source.numVertices);
+		}
+
+		const Matrix4* bones = object.pose.data();
+		UINT32 numBones = (UINT32)object.pose.size();
+		bool skinned = object.skinned && numBones > 0 && source.blendIndicesOffset != (UINT32)-1;
+
+		PixelSIMDLevel simdLevel = PixelUtil::_getSIMDLevel();
+
+		SkinningBlock block;
+		block.hasNormal = source.normalOffset != (UINT32)-1;
+		block.hasTangent = source.tangentOffset != (UINT32)-1;
+
+		for (UINT32 blockStart = 0; blockStart < source.numVertices; blockStart += VERTICES_PER_BLOCK)
+		{
+			block.numVertices = std::min(VERTICES_PER_BLOCK, source.numVertices - blockStart);
+
+			// Decode the animated elements and apply morph shapes, matching the logic in the SkinnedVertexInput shader
+			// include
+			const UINT8* srcVertex = source.vertices + blockStart * source.stride;
+			for (UINT32 i = 0; i < block.numVertices; i++)
+			{
+				UINT32 vertexIdx = blockStart + i;
+
+				Vector3 position = *(const Vector3*)(srcVertex + source.positionOffset);
+
+				Vector3 normal;
+				if (block.hasNormal)
+					normal = unpackNormal(srcVertex + source.normalOffset);
+
+				Vector3 tangent;
+				if (block.hasTangent)
+					tangent = unpackNormal(srcVertex + source.tangentOffset);
+
+				if (vertexIdx < numMorphVertices)
+				{
+					position += *(const Vector3*)(morphPositions + vertexIdx * morphStride);
+
+					if (block.hasNormal)
+					{
+						const UINT8* packedDelta = morphNormals + vertexIdx * morphStride;
+
+						Vector3 deltaNormal = unpackNormal(packedDelta) * 2.0f;
+						float weight = packedDelta[3] / 255.0f;
+
+						normal = Vector3::normalize(normal + deltaNormal * weight);
+
+						if (block.hasTangent)
+							tangent = Vector3::normalize(tangent - normal * tangent.dot(normal));
+					}
+				}
+
+				memcpy(block.positions[i], &position, sizeof(position));
+				block.positions[i][3] = 1.0f;
+
+				memcpy(block.normals[i], &normal, sizeof(normal));
+				block.normals[i][3] = 0.0f;
+
+				memcpy(block.tangents[i], &tangent, sizeof(tangent));
+				block.tangents[i][3] = 0.0f;
+
+				if (skinned)
+				{
+					const UINT8* blendIndices = srcVertex + source.blendIndicesOffset;
+					const float* blendWeights = (const float*)(srcVertex + source.blendWeightsOffset);
+
+					// Bones outside of the pose don't affect the vertex
+					for (UINT32 j = 0; j < 4; j++)
+					{
+						bool valid = blendIndices[j] < numBones;
+
+						block.blendIndices[i][j] = valid ? blendIndices[j] : 0;
+						block.blendWeights[i][j] = valid ? blendWeights[j] : 0.0f;
+					}
+				}
+
+				srcVertex += source.stride;
+			}
+
+			if (skinned)
+			{
+				UINT32 i = 0;
+
+#if BS_SIMD_SSE2
+				if (simdLevel >= PixelSIMDLevel::AVX2)
+					i = skinVerticesAVX2(block, bones);
+
+				if (simdLevel >= PixelSIMDLevel::SSE2)
+				{
+					for (; i < block.numVertices; i++)
+						skinVertexSSE2(block, i, bones);
+				}
+#endif
+
+				for (; i < block.numVertices; i++)
+					skinVertex(block, i, bones);
+			}
+
+			// Encode the animated elements. Whole vertices are written in order, as the destination is locked GPU
+			// memory that is best written sequentially.
+			srcVertex = source.vertices + blockStart * source.stride;
+			UINT8* dstVertex = object.mappedVertices + blockStart * source.stride;
+			for (UINT32 i = 0; i < block.numVertices; i++)
+			{
+				memcpy(dstVertex, srcVertex, source.stride);
+				memcpy(dstVertex + source.positionOffset, block.positions[i], sizeof(Vector3));
+
+				if (block.hasNormal)
+				{
+					Vector3 normal(block.normals[i][0], block.normals[i][1], block.normals[i][2]);
+					if (skinned)
+						normal.normalize();
+
+					packNormal(normal, dstVertex + source.normalOffset);
+				}
+
+				if (block.hasTangent)
+				{
+					Vector3 tangent(block.tangents[i][0], block.tangents[i][1], block.tangents[i][2]);
+					if (skinned)
+						tangent.normalize();
+
+					packNormal(tangent, dstVertex + source.tangentOffset);
+				}
+
+				srcVertex += source.stride;
+				dstVertex += source.stride;
+			}
+		}
+	}
+}}
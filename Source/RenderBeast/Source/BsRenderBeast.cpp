@@ -36,6 +36,8 @@
 #include "BsSkybox.h"
 #include "BsShadowRendering.h"
 #include "BsStandardDeferredLighting.h"
+#include "BsPreSkinning.h"
+#include "BsTextureStreamingManager.h"
 
 using namespace std::placeholders;
 
@@ -94,6 +96,7 @@ namespace bs { namespace ct
 		PostProcessing::startUp();
 		ShadowRendering::startUp(mCoreOptions->shadowMapSize);
 		StandardDeferred::startUp();
+		PreSkinning::startUp();
 	}
 
 	void RenderBeast::destroyCore()
@@ -108,6 +111,7 @@ namespace bs { namespace ct
 		mSkyboxFilteredReflections = nullptr;
 		mSkyboxIrradiance = nullptr;
 
+		PreSkinning::shutDown();
 		StandardDeferred::shutDown();
 		ShadowRendering::shutDown();
 		PostProcessing::shutDown();
@@ -136,16 +140,39 @@ namespace bs { namespace ct
 
 		for(auto& entry : rendererObject->elements)
 			mObjectRenderer->initElement(*rendererObject, entry);
+
+		if (renderable->getMobility() != ObjectMobility::Movable)
+		{
+			const Sphere& bounds = sceneInfo.renderableCullInfos[renderable->getRendererId()].bounds.getSphere();
+			ShadowRendering::instance().notifyStaticCasterChanged(bounds);
+		}
 	}
 
 	void RenderBeast::notifyRenderableRemoved(Renderable* renderable)
 	{
+		// Mobility changes are reported as a removal followed by an addition, at which point the mobility has already 
+		// changed, so static shadows are always refreshed on removal
+		const SceneInfo& sceneInfo = mScene->getSceneInfo();
+		const Sphere& bounds = sceneInfo.renderableCullInfos[renderable->getRendererId()].bounds.getSphere();
+		ShadowRendering::instance().notifyStaticCasterChanged(bounds);
+
 		mScene->unregisterRenderable(renderable);
 	}
 
 	void RenderBeast::notifyRenderableUpdated(Renderable* renderable)
 	{
+		const SceneInfo& sceneInfo = mScene->getSceneInfo();
+		Sphere oldBounds = sceneInfo.renderableCullInfos[renderable->getRendererId()].bounds.getSphere();
+
 		mScene->updateRenderable(renderable);
+
+		if (renderable->getMobility() != ObjectMobility::Movable)
+		{
+			const Sphere& newBounds = sceneInfo.renderableCullInfos[renderable->getRendererId()].bounds.getSphere();
+
+			ShadowRendering::instance().notifyStaticCasterChanged(oldBounds);
+			ShadowRendering::instance().notifyStaticCasterChanged(newBounds);
+		}
 	}
 
 	void RenderBeast::notifyLightAdded(Light* light)
@@ -156,11 +183,15 @@ namespace bs { namespace ct
 	void RenderBeast::notifyLightUpdated(Light* light)
 	{
 		mScene->updateLight(light);
+
+		ShadowRendering::instance().notifyLightUpdated(light);
 	}
 
 	void RenderBeast::notifyLightRemoved(Light* light)
 	{
 		mScene->unregisterLight(light);
+
+		ShadowRendering::instance().notifyLightRemoved(light);
 	}
 
 	void RenderBeast::notifyCameraAdded(Camera* camera)
@@ -303,10 +334,30 @@ namespace bs { namespace ct
 		if (filteringChanged)
 			mScene->refreshSamplerOverrides(true);
 
+		bool preSkinningChanged = mCoreOptions->preSkinning != options.preSkinning;
+
 		*mCoreOptions = options;
 
 		mScene->setOptions(mCoreOptions);
 		ShadowRendering::instance().setShadowMapSize(mCoreOptions->shadowMapSize);
+
+		// Animated renderables need to be re-registered in order to switch between pre-skinning and animating in the
+		// vertex program
+		if (preSkinningChanged)
+		{
+			Vector<Renderable*> animatedRenderables;
+			for (auto& entry : mScene->getSceneInfo().renderables)
+			{
+				if (entry->renderable->getAnimType() != RenderableAnimType::None)
+					animatedRenderables.push_back(entry->renderable);
+			}
+
+			for (auto& renderable : animatedRenderables)
+			{
+				notifyRenderableRemoved(renderable);
+				notifyRenderableAdded(renderable);
+			}
+		}
 	}
 
 	void RenderBeast::renderAll() 
@@ -340,9 +391,15 @@ namespace bs { namespace ct
 		// Update global per-frame hardware buffers
 		mObjectRenderer->setParamFrameParams(time);
 
+		// Free pooled resources that are no longer being re-used
+		GpuResourcePool::instance().update();
+
 		// Retrieve animation data
 		AnimationManager::instance().waitUntilComplete();
 		const RendererAnimationData& animData = AnimationManager::instance().getRendererData();
+
+		// Apply animation to vertices of pre-skinned renderables, before they are rendered by any of the passes below
+		PreSkinning::instance().update(animData);
 		
 		sceneInfo.renderableReady.resize(sceneInfo.renderables.size(), false);
 		sceneInfo.renderableReady.assign(sceneInfo.renderables.size(), false);
@@ -367,6 +424,7 @@ namespace bs { namespace ct
 
 		mMainViewGroup.setViews(views.data(), (UINT32)views.size());
 		mMainViewGroup.determineVisibility(sceneInfo);
+		notifyStreamedTextureUsage(mMainViewGroup);
 
 		// Render shadow maps
 		ShadowRendering::instance().renderShadowMaps(*mScene, mMainViewGroup, frameInfo);
@@ -389,6 +447,68 @@ namespace bs { namespace ct
 		gProfilerCPU().endSample("renderAllCore");
 	}
 
+	void RenderBeast::notifyStreamedTextureUsage(const RendererViewGroup& viewGroup)
+	{
+		// Nothing to report if no textures are being streamed
+		if (TextureStreamingManager::instance().getNumTextures() == 0)
+			return;
+
+		const SceneInfo& sceneInfo = mScene->getSceneInfo();
+
+		// Largest size, in pixels, each streamed texture appears at in any of the views, indexed by streaming identifier.
+		// Negative for textures that weren't seen yet.
+		UINT32 numViews = viewGroup.getNumViews();
+		for (UINT32 i = 0; i < numViews; i++)
+		{
+			RendererView* view = viewGroup.getView(i);
+			const RendererViewProperties& viewProps = view->getProperties();
+			if (viewProps.isOverlay)
+				continue;
+
+			const VisibilityInfo& visibility = view->getVisibilityMasks();
+			const Vector<UINT32>& lods = view->getRenderableLODs();
+			const Vector<float>& screenSizes = view->getRenderableScreenSizes();
+
+			for (UINT32 j = 0; j < (UINT32)visibility.renderables.size(); j++)
+			{
+				if (!visibility.renderables[j])
+					continue;
+
+				float size = screenSizes[j] * viewProps.viewRect.height;
+				for (auto& element : sceneInfo.renderables[j]->elements)
+				{
+					if (element.lod != lods[j] || element.material == nullptr)
+						continue;
+
+					for (auto& streamingId : element.material->_getStreamedTextures())
+					{
+						if (streamingId >= (UINT32)mStreamedTextureSizes.size())
+							mStreamedTextureSizes.resize(streamingId + 1, -1.0f);
+
+						float& textureSize = mStreamedTextureSizes[streamingId];
+						if (textureSize < 0.0f)
+							mUsedStreamedTextures.push_back(streamingId);
+
+						textureSize = std::max(textureSize, size);
+					}
+				}
+			}
+		}
+
+		if (mUsedStreamedTextures.empty())
+			return;
+
+		mStreamedTextureUsage.clear();
+		for (auto& streamingId : mUsedStreamedTextures)
+		{
+			mStreamedTextureUsage.push_back({ streamingId, mStreamedTextureSizes[streamingId] });
+			mStreamedTextureSizes[streamingId] = -1.0f;
+		}
+
+		mUsedStreamedTextures.clear();
+		TextureStreamingManager::instance()._notifyUsage(mStreamedTextureUsage);
+	}
+
 	void RenderBeast::renderViews(const RendererViewGroup& viewGroup, const FrameInfo& frameInfo)
 	{
 		const SceneInfo& sceneInfo = mScene->getSceneInfo();
@@ -549,11 +669,7 @@ namespace bs { namespace ct
 
 		// Render base pass
 		const Vector<RenderQueueElement>& opaqueElements = viewInfo->getOpaqueQueue()->getSortedElements();
-		for (auto iter = opaqueElements.begin(); iter != opaqueElements.end(); ++iter)
-		{
-			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(iter->renderElem);
-			renderElement(*renderElem, iter->passIdx, iter->applyPass, viewProj);
-		}
+		renderElements(opaqueElements, false, viewProj);
 
 		// Build HiZ buffer
 		bool isMSAA = numSamples > 1;
@@ -689,11 +805,7 @@ namespace bs { namespace ct
 		// for all lights affecting this object into a single (or a few) textures. I can likely use texture arrays for this,
 		// or to avoid sampling many textures, perhaps just jam it all in one or few texture channels. 
 		const Vector<RenderQueueElement>& transparentElements = viewInfo->getTransparentQueue()->getSortedElements();
-		for (auto iter = transparentElements.begin(); iter != transparentElements.end(); ++iter)
-		{
-			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(iter->renderElem);
-			renderElement(*renderElem, iter->passIdx, iter->applyPass, viewProj);
-		}
+		renderElements(transparentElements, true, viewProj);
 
 		// Trigger post-light-pass callbacks
 		if (viewProps.triggerCallbacks)
@@ -813,8 +925,34 @@ namespace bs { namespace ct
 		gProfilerCPU().endSample("RenderOverlay");
 	}
 	
+	void RenderBeast::renderElements(const Vector<RenderQueueElement>& elements, bool preserveOrder, 
+									 const Matrix4& viewProj)
+	{
+		const SceneInfo& sceneInfo = mScene->getSceneInfo();
+		mObjectRenderer->batchElements(elements, sceneInfo.renderables, preserveOrder, mRenderBatches);
+
+		for (auto& batch : mRenderBatches)
+		{
+			const BeastRenderableElement& element = *batch.element;
+			if (batch.numInstances == 1)
+			{
+				renderElement(element, batch.passIdx, batch.applyPass, viewProj);
+				continue;
+			}
+
+			element.perInstanceDataParam.set(batch.instanceBuffer);
+			renderElement(element, batch.passIdx, batch.applyPass, viewProj, batch.numInstances);
+
+			// Restore the element's own instance data for when it gets rendered on its own
+			const RendererObject* rendererObject = sceneInfo.renderables[element.renderableId];
+			element.perInstanceDataParam.set(rendererObject->perInstanceBuffer);
+		}
+
+		mRenderBatches.clear();
+	}
+
 	void RenderBeast::renderElement(const BeastRenderableElement& element, UINT32 passIdx, bool bindPass, 
-									const Matrix4& viewProj)
+									const Matrix4& viewProj, UINT32 numInstances)
 	{
 		SPtr<Material> material = element.material;
 
@@ -823,11 +961,7 @@ namespace bs { namespace ct
 
 		gRendererUtility().setPassParams(element.params, passIdx);
 
-		if(element.morphVertexDeclaration == nullptr)
-			gRendererUtility().draw(element.mesh, element.subMesh);
-		else
-			gRendererUtility().drawMorph(element.mesh, element.subMesh, element.morphShapeBuffer, 
-				element.morphVertexDeclaration);
+		element.draw(numInstances);
 	}
 
 	void RenderBeast::updateLightProbes(const FrameInfo& frameInfo)
@@ -1,12 +1,26 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsRendererObject.h"
+#include "BsGpuBuffer.h"
+#include "BsRenderAPI.h"
+#include "BsRendererUtility.h"
+#include "BsMesh.h"
 
 namespace bs { namespace ct
 {
 	PerObjectParamDef gPerObjectParamDef;
 	PerCallParamDef gPerCallParamDef;
 
+	void BeastRenderableElement::draw(UINT32 numInstances) const
+	{
+		if (skinnedVertexBuffer != nullptr)
+			gRendererUtility().drawSkinned(mesh, subMesh, skinnedVertexBuffer, numInstances);
+		else if (morphVertexDeclaration != nullptr)
+			gRendererUtility().drawMorph(mesh, subMesh, morphShapeBuffer, morphVertexDeclaration);
+		else
+			gRendererUtility().draw(mesh, subMesh, numInstances);
+	}
+
 	RendererObject::RendererObject()
 	{
 		perObjectParamBuffer = gPerObjectParamDef.createBuffer();
@@ -16,13 +30,39 @@ namespace bs { namespace ct
 	void RendererObject::updatePerObjectBuffer()
 	{
 		Matrix4 worldTransform = renderable->getTransform();
+		Matrix4 invWorldTransform = worldTransform.inverseAffine();
 		Matrix4 worldNoScaleTransform = renderable->getTransformNoScale();
+		Matrix4 invWorldNoScaleTransform = worldNoScaleTransform.inverseAffine();
+		float worldDeterminantSign = worldTransform.determinant3x3() >= 0.0f ? 1.0f : -1.0f;
 
 		gPerObjectParamDef.gMatWorld.set(perObjectParamBuffer, worldTransform);
-		gPerObjectParamDef.gMatInvWorld.set(perObjectParamBuffer, worldTransform.inverseAffine());
+		gPerObjectParamDef.gMatInvWorld.set(perObjectParamBuffer, invWorldTransform);
 		gPerObjectParamDef.gMatWorldNoScale.set(perObjectParamBuffer, worldNoScaleTransform);
-		gPerObjectParamDef.gMatInvWorldNoScale.set(perObjectParamBuffer, worldNoScaleTransform.inverseAffine());
-		gPerObjectParamDef.gWorldDeterminantSign.set(perObjectParamBuffer, worldTransform.determinant3x3() >= 0.0f ? 1.0f : -1.0f);
+		gPerObjectParamDef.gMatInvWorldNoScale.set(perObjectParamBuffer, invWorldNoScaleTransform);
+		gPerObjectParamDef.gWorldDeterminantSign.set(perObjectParamBuffer, worldDeterminantSign);
+
+		// Param blocks transpose matrices for column major APIs, but structured buffers are written as-is so the 
+		// per-instance data needs to be transposed manually
+		bool transposeMatrices = RenderAPI::instance().getAPIInfo().isFlagSet(RenderAPIFeatureFlag::ColumnMajorMatrices);
+		if(transposeMatrices)
+		{
+			instanceData.worldTransform = worldTransform.transpose();
+			instanceData.invWorldTransform = invWorldTransform.transpose();
+			instanceData.worldNoScaleTransform = worldNoScaleTransform.transpose();
+			instanceData.invWorldNoScaleTransform = invWorldNoScaleTransform.transpose();
+		}
+		else
+		{
+			instanceData.worldTransform = worldTransform;
+			instanceData.invWorldTransform = invWorldTransform;
+			instanceData.worldNoScaleTransform = worldNoScaleTransform;
+			instanceData.invWorldNoScaleTransform = invWorldNoScaleTransform;
+		}
+
+		instanceData.worldDeterminantSign = worldDeterminantSign;
+
+		if(perInstanceBuffer != nullptr)
+			perInstanceBuffer->writeData(0, sizeof(PerInstanceData), &instanceData, BWT_DISCARD);
 	}
 
 	void RendererObject::updatePerCallBuffer(const Matrix4& viewProj, bool flush)
@@ -11,6 +11,7 @@
 #include "BsGpuParamsSet.h"
 #include "BsRenderBeastOptions.h"
 #include "BsRenderBeast.h"
+#include "BsPreSkinning.h"
 
 namespace bs {	namespace ct
 {
@@ -228,13 +229,33 @@ namespace bs {	namespace ct
 			const MeshProperties& meshProps = mesh->getProperties();
 			SPtr<VertexDeclaration> vertexDecl = mesh->getVertexData()->vertexDeclaration;
 
-			for (UINT32 i = 0; i < meshProps.getNumSubMeshes(); i++)
+			SPtr<VertexBuffer> skinnedVertexBuffer;
+			if (mOptions->preSkinning)
+				skinnedVertexBuffer = PreSkinning::instance().registerObject(rendererObject);
+
+			rendererObject->preSkinned = skinnedVertexBuffer != nullptr;
+
+			UINT32 numLODs = meshProps.getNumLODs();
+			for (UINT32 i = 1; i < numLODs; i++)
+				rendererObject->lodScreenSizes.push_back(meshProps.getLODScreenSize(i));
+
+			// Elements for all levels of detail are created up front, and views pick the ones to render each frame
+			UINT32 numSubMeshes = meshProps.getNumSubMeshes();
+			for (UINT32 i = 0; i < numSubMeshes * numLODs; i++)
 			{
+				UINT32 subMeshIdx = i % numSubMeshes;
+				UINT32 lod = i / numSubMeshes;
+
+				const SubMesh& subMesh = meshProps.getSubMesh(subMeshIdx, lod);
+				if (lod > 0 && subMesh.indexCount == 0)
+					continue;
+
 				rendererObject->elements.push_back(BeastRenderableElement());
 				BeastRenderableElement& renElement = rendererObject->elements.back();
 
 				renElement.mesh = mesh;
-				renElement.subMesh = meshProps.getSubMesh(i);
+				renElement.subMesh = subMesh;
+				renElement.lod = lod;
 				renElement.renderableId = renderableId;
 				renElement.animType = renderable->getAnimType();
 				renElement.animationId = renderable->getAnimationId();
@@ -243,7 +264,16 @@ namespace bs {	namespace ct
 				renElement.boneMatrixBuffer = renderable->getBoneMatrixBuffer();
 				renElement.morphVertexDeclaration = renderable->getMorphVertexDeclaration();
 
-				renElement.material = renderable->getMaterial(i);
+				// Vertices already have animation applied, so the element can be rendered as a non-animated one
+				if (rendererObject->preSkinned)
+				{
+					renElement.skinnedVertexBuffer = skinnedVertexBuffer;
+					renElement.morphShapeBuffer = nullptr;
+					renElement.boneMatrixBuffer = nullptr;
+					renElement.morphVertexDeclaration = nullptr;
+				}
+
+				renElement.material = renderable->getMaterial(subMeshIdx);
 				if (renElement.material == nullptr)
 					renElement.material = renderable->getMaterial(0);
 
@@ -260,6 +290,9 @@ namespace bs {	namespace ct
 
 				UINT32 techniqueIdx = -1;
 				RenderableAnimType animType = renderable->getAnimType();
+				if (rendererObject->preSkinned)
+					animType = RenderableAnimType::None;
+
 				if (animType != RenderableAnimType::None)
 					techniqueIdx = renElement.material->findTechnique(techniqueIDLookup[(int)animType]);
 
@@ -268,8 +301,8 @@ namespace bs {	namespace ct
 
 				renElement.techniqueIdx = techniqueIdx;
 
-				// Validate mesh <-> shader vertex bindings
-				if (renElement.material != nullptr)
+				// Validate mesh <-> shader vertex bindings (all levels of detail share the same vertices and materials)
+				if (renElement.material != nullptr && lod == 0)
 				{
 					UINT32 numPasses = renElement.material->getNumPasses(techniqueIdx);
 					for (UINT32 j = 0; j < numPasses; j++)
@@ -385,6 +418,9 @@ namespace bs {	namespace ct
 		mInfo.renderables.erase(mInfo.renderables.end() - 1);
 		mInfo.renderableCullInfos.erase(mInfo.renderableCullInfos.end() - 1);
 
+		if (rendererObject->preSkinned)
+			PreSkinning::instance().unregisterObject(rendererObject);
+
 		bs_delete(rendererObject);
 	}
 
@@ -682,7 +718,9 @@ namespace bs {	namespace ct
 			return;
 		
 		// Note: Before uploading bone matrices perhaps check if they has actually been changed since last frame
-		mInfo.renderables[idx]->renderable->updateAnimationBuffers(frameInfo.animData);
+		// Pre-skinned objects have their animation applied by PreSkinning, and don't use the animation buffers
+		if (!mInfo.renderables[idx]->preSkinned)
+			mInfo.renderables[idx]->renderable->updateAnimationBuffers(frameInfo.animData);
 		
 		// Note: Could this step be moved in notifyRenderableUpdated, so it only triggers when material actually gets
 		// changed? Although it shouldn't matter much because if the internal versions keeping track of dirty params.
@@ -16,6 +16,12 @@ namespace bs { namespace ct
 	PerCameraParamDef gPerCameraParamDef;
 	SkyboxParamDef gSkyboxParamDef;
 
+	/** 
+	 * Relative amount by which an object's screen size needs to go past the threshold of a level of detail before the
+	 * level is switched. Prevents objects near the threshold from constantly switching between levels.
+	 */
+	static const float LOD_HYSTERESIS = 0.1f;
+
 	template<bool SOLID_COLOR>
 	SkyboxMat<SOLID_COLOR>::SkyboxMat()
 	{
@@ -173,12 +179,50 @@ namespace bs { namespace ct
 	{
 		mVisibility.renderables.clear();
 		mVisibility.renderables.resize(renderables.size(), false);
+		mRenderableLODs.resize(renderables.size(), 0);
+		mRenderableScreenSizes.resize(renderables.size(), 0.0f);
 
 		if (mProperties.isOverlay)
 			return;
 
 		calculateVisibility(cullInfos, mVisibility.renderables);
 
+		// Select levels of detail. This is done for objects outside of the view as well, as they can still cast shadows
+		// onto visible objects.
+		bool isOrtho = mProperties.projType == PT_ORTHOGRAPHIC;
+		float projScale = Math::abs(mProperties.projTransform[1][1]);
+		for (UINT32 i = 0; i < (UINT32)renderables.size(); i++)
+		{
+			// Ratio of the bounding sphere's diameter to the view height
+			const Sphere& boundingSphere = cullInfos[i].bounds.getSphere();
+			float screenSize = boundingSphere.getRadius() * projScale;
+			if (!isOrtho)
+			{
+				float distance = (mProperties.viewOrigin - boundingSphere.getCenter()).length();
+				screenSize /= std::max(distance, mProperties.nearPlane);
+			}
+
+			mRenderableScreenSizes[i] = screenSize;
+
+			const Vector<float>& lodScreenSizes = renderables[i]->lodScreenSizes;
+			UINT32 numLODs = (UINT32)lodScreenSizes.size() + 1;
+			if (numLODs == 1)
+			{
+				mRenderableLODs[i] = 0;
+				continue;
+			}
+
+			// Start from the level used last frame, and only switch once the size is past the threshold by a margin
+			UINT32 lod = std::min(mRenderableLODs[i], numLODs - 1);
+			while (lod < (numLODs - 1) && screenSize < lodScreenSizes[lod] * (1.0f - LOD_HYSTERESIS))
+				lod++;
+
+			while (lod > 0 && screenSize > lodScreenSizes[lod - 1] * (1.0f + LOD_HYSTERESIS))
+				lod--;
+
+			mRenderableLODs[i] = lod;
+		}
+
 		// Update per-object param buffers and queue render elements
 		for(UINT32 i = 0; i < (UINT32)cullInfos.size(); i++)
 		{
@@ -190,6 +234,9 @@ namespace bs { namespace ct
 
 			for (auto& renderElem : renderables[i]->elements)
 			{
+				if (renderElem.lod != mRenderableLODs[i])
+					continue;
+
 				// Note: I could keep opaque and transparent renderables in two separate arrays, so I don't need to do the
 				// check here
 				bool isTransparent = (renderElem.material->getShader()->getFlags() & (UINT32)ShaderFlags::Transparent) != 0;
@@ -501,6 +548,19 @@ namespace bs { namespace ct
 		for(UINT32 i = 0; i < numViews; i++)
 			mViews[i]->determineVisible(sceneInfo.renderables, sceneInfo.renderableCullInfos, &mVisibility.renderables);
 
+		// Render shadows with the most detailed level of detail used by any of the views
+		for (UINT32 i = 0; i < (UINT32)sceneInfo.renderables.size(); i++)
+		{
+			UINT32 shadowLOD = (UINT32)-1;
+			for (UINT32 j = 0; j < numViews; j++)
+			{
+				if (!mViews[j]->getProperties().isOverlay)
+					shadowLOD = std::min(shadowLOD, mViews[j]->getRenderableLODs()[i]);
+			}
+
+			sceneInfo.renderables[i]->shadowLOD = shadowLOD != (UINT32)-1 ? shadowLOD : 0;
+		}
+
 		// Calculate light visibility for all views
 		UINT32 numRadialLights = (UINT32)sceneInfo.radialLights.size();
 		mVisibility.radialLights.resize(numRadialLights, false);
@@ -86,6 +86,28 @@ namespace bs { namespace ct
 		gRendererUtility().setPassParams(mParamsSet);
 	}
 
+	ShadowDepthCopyMat::ShadowDepthCopyMat()
+	{
+		mParamsSet->getGpuParams()->getTextureParam(GPT_FRAGMENT_PROGRAM, "gSource", mSourceParam);
+	}
+
+	void ShadowDepthCopyMat::_initDefines(ShaderDefines& defines)
+	{
+		// No defines
+	}
+
+	void ShadowDepthCopyMat::execute(const SPtr<Texture>& source)
+	{
+		mSourceParam.set(source);
+
+		gRendererUtility().setPass(mMaterial);
+		gRendererUtility().setPassParams(mParamsSet);
+
+		const TextureProperties& props = source->getProperties();
+		Rect2 area(0.0f, 0.0f, (float)props.getWidth(), (float)props.getHeight());
+		gRendererUtility().drawScreenQuad(area);
+	}
+
 	ShadowProjectParamsDef gShadowProjectParamsDef;
 	ShadowProjectVertParamsDef gShadowProjectVertParamsDef;
 
@@ -469,6 +491,12 @@ namespace bs { namespace ct
 
 		mPositionOnlyVD = VertexDeclaration::create(vertexDesc);
 
+		mShadowParamsBuffer = gShadowParamsDef.createBuffer();
+		mShadowCubeMatricesBuffer = gShadowCubeMatricesDef.createBuffer();
+		mShadowCubeMasksBuffer = gShadowCubeMasksDef.createBuffer();
+		mShadowProjectParamsBuffer = gShadowProjectParamsDef.createBuffer();
+		mShadowProjectOmniParamsBuffer = gShadowProjectOmniParamsDef.createBuffer();
+
 		// Create plane index and vertex buffers
 		{
 			VERTEX_BUFFER_DESC vbDesc;
@@ -516,23 +544,62 @@ namespace bs { namespace ct
 		}
 	}
 
+	ShadowRendering::~ShadowRendering()
+	{
+		for (auto& entry : mStaticShadowMaps)
+			GpuResourcePool::instance().release(entry.second.texture);
+	}
+
 	void ShadowRendering::setShadowMapSize(UINT32 size)
 	{
 		if (mShadowMapSize == size)
 			return;
 
+		mShadowMapSize = size;
+
 		mCascadedShadowMaps.clear();
 		mDynamicShadowMaps.clear();
 		mShadowCubemaps.clear();
+
+		for (auto& entry : mStaticShadowMaps)
+			GpuResourcePool::instance().release(entry.second.texture);
+
+		mStaticShadowMaps.clear();
+	}
+
+	void ShadowRendering::notifyLightUpdated(const Light* light)
+	{
+		auto iterFind = mStaticShadowMaps.find(light);
+		if (iterFind != mStaticShadowMaps.end())
+			iterFind->second.isDirty = true;
+	}
+
+	void ShadowRendering::notifyLightRemoved(const Light* light)
+	{
+		auto iterFind = mStaticShadowMaps.find(light);
+		if (iterFind == mStaticShadowMaps.end())
+			return;
+
+		GpuResourcePool::instance().release(iterFind->second.texture);
+		mStaticShadowMaps.erase(iterFind);
+	}
+
+	void ShadowRendering::notifyStaticCasterChanged(const Sphere& bounds)
+	{
+		for (auto& entry : mStaticShadowMaps)
+		{
+			if (entry.first->getBounds().intersects(bounds))
+				entry.second.isDirty = true;
+		}
 	}
 
 	void ShadowRendering::renderShadowMaps(RendererScene& scene, const RendererViewGroup& viewGroup, 
 		const FrameInfo& frameInfo)
 	{
-		// Note: Currently all shadows are dynamic and are rebuilt every frame. I should later added support for static
-		// shadow maps which can be used for immovable lights. Such a light can then maintain a set of shadow maps,
-		// one of which is static and only effects the static geometry, while the rest are per-object shadow maps used
-		// for dynamic objects. Then only a small subset of geometry needs to be redrawn, instead of everything.
+		// Note: Spot and radial lights that cannot move keep a static shadow map containing only the casters that
+		// cannot move, which gets re-rendered only when those change. Every frame the static map is copied into the
+		// dynamic one, and only the movable casters are rendered on top. Cascaded shadow maps depend on the view and
+		// are always fully re-rendered.
 
 		// Note: Add support for per-object shadows and a way to force a renderable to use per-object shadows. This can be
 		// used for adding high quality shadows on specific objects (e.g. important characters during cinematics).
@@ -648,6 +715,21 @@ namespace bs { namespace ct
 				++iter;
 		}
 
+		for(auto iter = mStaticShadowMaps.begin(); iter != mStaticShadowMaps.end();)
+		{
+			StaticShadowMap& staticMap = iter->second;
+			if (staticMap.lastUsedCounter >= MAX_UNUSED_FRAMES)
+			{
+				GpuResourcePool::instance().release(staticMap.texture);
+				iter = mStaticShadowMaps.erase(iter);
+			}
+			else
+			{
+				staticMap.lastUsedCounter++;
+				++iter;
+			}
+		}
+
 		// Render shadow maps
 		for (UINT32 i = 0; i < (UINT32)sceneInfo.directionalLights.size(); ++i)
 		{
@@ -774,8 +856,8 @@ namespace bs { namespace ct
 		const RenderAPIInfo& rapiInfo = rapi.getAPIInfo();
 		// TODO - Calculate and set a scissor rectangle for the light
 
-		SPtr<GpuParamBlockBuffer> shadowParamBuffer = gShadowProjectParamsDef.createBuffer();
-		SPtr<GpuParamBlockBuffer> shadowOmniParamBuffer = gShadowProjectOmniParamsDef.createBuffer();
+		const SPtr<GpuParamBlockBuffer>& shadowParamBuffer = mShadowProjectParamsBuffer;
+		const SPtr<GpuParamBlockBuffer>& shadowOmniParamBuffer = mShadowProjectOmniParamsBuffer;
 
 		Vector<const ShadowInfo*> shadowInfos;
 
@@ -959,7 +1041,7 @@ namespace bs { namespace ct
 		const RenderAPIInfo& rapiInfo = rapi.getAPIInfo();
 
 		Vector3 lightDir = -light->getRotation().zAxis();
-		SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.createBuffer();
+		const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer = mShadowParamsBuffer;
 
 		ShadowInfo shadowInfo;
 		shadowInfo.lightIdx = lightIdx;
@@ -1059,11 +1141,8 @@ namespace bs { namespace ct
 
 				for (auto& element : renderable->elements)
 				{
-					if (element.morphVertexDeclaration == nullptr)
-						gRendererUtility().draw(element.mesh, element.subMesh);
-					else
-						gRendererUtility().drawMorph(element.mesh, element.subMesh, element.morphShapeBuffer,
-							element.morphVertexDeclaration);
+					if (element.lod == renderable->shadowLOD)
+						element.draw();
 				}
 			}
 
@@ -1079,7 +1158,7 @@ namespace bs { namespace ct
 		Light* light = rendererLight.internal;
 
 		const SceneInfo& sceneInfo = scene.getSceneInfo();
-		SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.createBuffer();
+		const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer = mShadowParamsBuffer;
 
 		ShadowInfo mapInfo;
 		mapInfo.fadePerView = options.fadePercents;
@@ -1112,11 +1191,6 @@ namespace bs { namespace ct
 		mapInfo.updateNormArea(MAX_ATLAS_SIZE);
 		ShadowMapAtlas& atlas = mDynamicShadowMaps[mapInfo.textureIdx];
 
-		RenderAPI& rapi = RenderAPI::instance();
-		rapi.setRenderTarget(atlas.getTarget());
-		rapi.setViewport(mapInfo.normArea);
-		rapi.clearViewport(FBT_DEPTH);
-
 		mapInfo.depthNear = 0.05f;
 		mapInfo.depthFar = light->getAttenuationRadius();
 		mapInfo.depthFade = mapInfo.depthFar;
@@ -1141,8 +1215,6 @@ namespace bs { namespace ct
 		gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, mapInfo.shadowVPTransform);
 		gShadowParamsDef.gNDCZToDeviceZ.set(shadowParamsBuffer, RendererView::getNDCZToDeviceZ());
 
-		mDepthNormalMat.bind(shadowParamsBuffer);
-
 		const Vector<Plane>& frustumPlanes = localFrustum.getPlanes();
 		Matrix4 worldMatrix = view.transpose();
 
@@ -1155,24 +1227,57 @@ namespace bs { namespace ct
 		}
 
 		ConvexVolume worldFrustum(worldPlanes);
-		for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
+		auto drawCasters = [&](CasterFilter filter)
 		{
-			if (!worldFrustum.intersects(sceneInfo.renderableCullInfos[i].bounds.getSphere()))
-				continue;
+			mDepthNormalMat.bind(shadowParamsBuffer);
+
+			for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
+			{
+				RendererObject* renderable = sceneInfo.renderables[i];
+				if (!isCasterIncluded(*renderable, filter))
+					continue;
 
-			scene.prepareRenderable(i, frameInfo);
+				if (!worldFrustum.intersects(sceneInfo.renderableCullInfos[i].bounds.getSphere()))
+					continue;
+
+				scene.prepareRenderable(i, frameInfo);
+				mDepthNormalMat.setPerObjectBuffer(renderable->perObjectParamBuffer);
 
-			RendererObject* renderable = sceneInfo.renderables[i];
-			mDepthNormalMat.setPerObjectBuffer(renderable->perObjectParamBuffer);
+				UINT32 lod = getCasterLOD(*renderable, filter);
+				for (auto& element : renderable->elements)
+				{
+					if (element.lod == lod)
+						element.draw();
+				}
+			}
+		};
 
-			for (auto& element : renderable->elements)
+		RenderAPI& rapi = RenderAPI::instance();
+		if (light->getMobility() != ObjectMobility::Movable)
+		{
+			StaticShadowMap& staticMap = getStaticShadowMap(*light, options.mapSize);
+			if (staticMap.isDirty)
 			{
-				if (element.morphVertexDeclaration == nullptr)
-					gRendererUtility().draw(element.mesh, element.subMesh);
-				else
-					gRendererUtility().drawMorph(element.mesh, element.subMesh, element.morphShapeBuffer,
-						element.morphVertexDeclaration);
+				rapi.setRenderTarget(staticMap.texture->renderTexture);
+				rapi.clearRenderTarget(FBT_DEPTH);
+
+				drawCasters(CasterFilter::Static);
+				staticMap.isDirty = false;
 			}
+
+			rapi.setRenderTarget(atlas.getTarget());
+			rapi.setViewport(mapInfo.normArea);
+
+			mDepthCopyMat.execute(staticMap.texture->texture);
+			drawCasters(CasterFilter::Dynamic);
+		}
+		else
+		{
+			rapi.setRenderTarget(atlas.getTarget());
+			rapi.setViewport(mapInfo.normArea);
+			rapi.clearViewport(FBT_DEPTH);
+
+			drawCasters(CasterFilter::All);
 		}
 
 		// Restore viewport
@@ -1190,9 +1295,9 @@ namespace bs { namespace ct
 		Light* light = rendererLight.internal;
 
 		const SceneInfo& sceneInfo = scene.getSceneInfo();
-		SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.createBuffer();
-		SPtr<GpuParamBlockBuffer> shadowCubeMatricesBuffer = gShadowCubeMatricesDef.createBuffer();
-		SPtr<GpuParamBlockBuffer> shadowCubeMasksBuffer = gShadowCubeMasksDef.createBuffer();
+		const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer = mShadowParamsBuffer;
+		const SPtr<GpuParamBlockBuffer>& shadowCubeMatricesBuffer = mShadowCubeMatricesBuffer;
+		const SPtr<GpuParamBlockBuffer>& shadowCubeMasksBuffer = mShadowCubeMasksBuffer;
 
 		ShadowInfo mapInfo;
 		mapInfo.lightIdx = options.lightIdx;
@@ -1321,38 +1426,66 @@ namespace bs { namespace ct
 			boundingPlanes.push_back(worldPlanes.back());
 		}
 
-		rapi.setRenderTarget(cubemap.getTarget());
-		rapi.clearRenderTarget(FBT_DEPTH);
-
-		mDepthCubeMat.bind(shadowParamsBuffer, shadowCubeMatricesBuffer);
-
-		// First cull against a global volume
 		ConvexVolume boundingVolume(boundingPlanes);
-		for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
+		auto drawCasters = [&](CasterFilter filter)
 		{
-			const Sphere& bounds = sceneInfo.renderableCullInfos[i].bounds.getSphere();
-			if (!boundingVolume.intersects(bounds))
-				continue;
-
-			scene.prepareRenderable(i, frameInfo);
+			mDepthCubeMat.bind(shadowParamsBuffer, shadowCubeMatricesBuffer);
 
-			for(UINT32 j = 0; j < 6; j++)
+			for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
 			{
-				int mask = frustums[j].intersects(bounds) ? 1 : 0;
-				gShadowCubeMasksDef.gFaceMasks.set(shadowCubeMasksBuffer, mask, j);
-			}
+				RendererObject* renderable = sceneInfo.renderables[i];
+				if (!isCasterIncluded(*renderable, filter))
+					continue;
+
+				// First cull against a global volume
+				const Sphere& bounds = sceneInfo.renderableCullInfos[i].bounds.getSphere();
+				if (!boundingVolume.intersects(bounds))
+					continue;
+
+				scene.prepareRenderable(i, frameInfo);
+
+				for(UINT32 j = 0; j < 6; j++)
+				{
+					int mask = frustums[j].intersects(bounds) ? 1 : 0;
+					gShadowCubeMasksDef.gFaceMasks.set(shadowCubeMasksBuffer, mask, j);
+				}
+
+				mDepthCubeMat.setPerObjectBuffer(renderable->perObjectParamBuffer, shadowCubeMasksBuffer);
 
-			RendererObject* renderable = sceneInfo.renderables[i];
-			mDepthCubeMat.setPerObjectBuffer(renderable->perObjectParamBuffer, shadowCubeMasksBuffer);
+				UINT32 lod = getCasterLOD(*renderable, filter);
+				for (auto& element : renderable->elements)
+				{
+					if (element.lod == lod)
+						element.draw();
+				}
+			}
+		};
 
-			for (auto& element : renderable->elements)
+		if (light->getMobility() != ObjectMobility::Movable)
+		{
+			StaticShadowMap& staticMap = getStaticShadowMap(*light, options.mapSize);
+			if (staticMap.isDirty)
 			{
-				if (element.morphVertexDeclaration == nullptr)
-					gRendererUtility().draw(element.mesh, element.subMesh);
-				else
-					gRendererUtility().drawMorph(element.mesh, element.subMesh, element.morphShapeBuffer,
-						element.morphVertexDeclaration);
+				rapi.setRenderTarget(staticMap.texture->renderTexture);
+				rapi.clearRenderTarget(FBT_DEPTH);
+
+				drawCasters(CasterFilter::Static);
+				staticMap.isDirty = false;
 			}
+
+			SPtr<Texture> cubemapTex = cubemap.getTexture();
+			for (UINT32 i = 0; i < 6; i++)
+				staticMap.texture->texture->copy(cubemapTex, i, 0, i, 0);
+
+			rapi.setRenderTarget(cubemap.getTarget());
+			drawCasters(CasterFilter::Dynamic);
+		}
+		else
+		{
+			rapi.setRenderTarget(cubemap.getTarget());
+			rapi.clearRenderTarget(FBT_DEPTH);
+
+			drawCasters(CasterFilter::All);
 		}
 
 		LightShadows& lightShadows = mRadialLightShadows[options.lightIdx];
@@ -1414,6 +1547,47 @@ namespace bs { namespace ct
 		size = std::max(effectiveMapSize - 2 * border, 1u);
 	}
 
+	ShadowRendering::StaticShadowMap& ShadowRendering::getStaticShadowMap(const Light& light, UINT32 size)
+	{
+		StaticShadowMap& staticMap = mStaticShadowMaps[&light];
+		staticMap.lastUsedCounter = 0;
+
+		if (staticMap.texture != nullptr && staticMap.size == size)
+			return staticMap;
+
+		if (staticMap.texture != nullptr)
+			GpuResourcePool::instance().release(staticMap.texture);
+
+		POOLED_RENDER_TEXTURE_DESC desc;
+		if (light.getType() == LightType::Radial)
+			desc = POOLED_RENDER_TEXTURE_DESC::createCube(SHADOW_MAP_FORMAT, size, size, TU_DEPTHSTENCIL);
+		else
+			desc = POOLED_RENDER_TEXTURE_DESC::create2D(SHADOW_MAP_FORMAT, size, size, TU_DEPTHSTENCIL);
+
+		staticMap.texture = GpuResourcePool::instance().get(desc);
+		staticMap.size = size;
+		staticMap.isDirty = true;
+
+		return staticMap;
+	}
+
+	bool ShadowRendering::isCasterIncluded(const RendererObject& renderable, CasterFilter filter)
+	{
+		if (filter == CasterFilter::All)
+			return true;
+
+		bool isStatic = renderable.renderable->getMobility() != ObjectMobility::Movable;
+		return (filter == CasterFilter::Static) == isStatic;
+	}
+
+	UINT32 ShadowRendering::getCasterLOD(const RendererObject& renderable, CasterFilter filter)
+	{
+		if (filter == CasterFilter::Static)
+			return 0;
+
+		return renderable.shadowLOD;
+	}
+
 	void ShadowRendering::drawNearFarPlanes(float near, float far, bool drawNear)
 	{
 		RenderAPI& rapi = RenderAPI::instance();
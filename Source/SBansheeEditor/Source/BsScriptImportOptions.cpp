@@ -425,6 +425,10 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_SetBold", &ScriptFontImportOptions::internal_SetBold);
 		metaData.scriptClass->addInternalCall("Internal_GetItalic", &ScriptFontImportOptions::internal_GetItalic);
 		metaData.scriptClass->addInternalCall("Internal_SetItalic", &ScriptFontImportOptions::internal_SetItalic);
+		metaData.scriptClass->addInternalCall("Internal_GetDynamic", &ScriptFontImportOptions::internal_GetDynamic);
+		metaData.scriptClass->addInternalCall("Internal_SetDynamic", &ScriptFontImportOptions::internal_SetDynamic);
+		metaData.scriptClass->addInternalCall("Internal_GetSDF", &ScriptFontImportOptions::internal_GetSDF);
+		metaData.scriptClass->addInternalCall("Internal_SetSDF", &ScriptFontImportOptions::internal_SetSDF);
 		metaData.scriptClass->addInternalCall("Internal_GetCharRanges", &ScriptFontImportOptions::internal_GetCharRanges);
 		metaData.scriptClass->addInternalCall("Internal_SetCharRanges", &ScriptFontImportOptions::internal_SetCharRanges);
 	}
@@ -515,6 +519,26 @@ namespace bs
 		thisPtr->getFontImportOptions()->setItalic(value);
 	}
 
+	bool ScriptFontImportOptions::internal_GetDynamic(ScriptFontImportOptions* thisPtr)
+	{
+		return thisPtr->getFontImportOptions()->getDynamic();
+	}
+
+	void ScriptFontImportOptions::internal_SetDynamic(ScriptFontImportOptions* thisPtr, bool value)
+	{
+		thisPtr->getFontImportOptions()->setDynamic(value);
+	}
+
+	bool ScriptFontImportOptions::internal_GetSDF(ScriptFontImportOptions* thisPtr)
+	{
+		return thisPtr->getFontImportOptions()->getSDF();
+	}
+
+	void ScriptFontImportOptions::internal_SetSDF(ScriptFontImportOptions* thisPtr, bool value)
+	{
+		thisPtr->getFontImportOptions()->setSDF(value);
+	}
+
 	MonoArray* ScriptFontImportOptions::internal_GetCharRanges(ScriptFontImportOptions* thisPtr)
 	{
 		Vector<std::pair<UINT32, UINT32>> charRanges = thisPtr->getFontImportOptions()->getCharIndexRanges();